@@ -0,0 +1,89 @@
+#include <stdlib.h>
+#include <math.h>
+#include "raylib.h"
+#include "benchmark.h"
+
+#define AUDIO_SAMPLE_RATE       48000   // Same as device sample rate, required for direct mixing
+#define AUDIO_SOUND_SECONDS     4       // Sound length, longer than every measure
+#define AUDIO_MAX_VOICES        64      // Maximum number of voices mixed at once
+#define AUDIO_MEASURE_TIME      0.25f   // Time mix cost is sampled per test (in seconds)
+
+// Mix N voices and report average mixing cost per output frame
+static void RunVoicesMixBenchmark(Sound *aliases, int voiceCount, float pitch)
+{
+    for (int i = 0; i < voiceCount; i++)
+    {
+        SetSoundPitch(aliases[i], pitch);
+        SetSoundVolume(aliases[i], 0.1f);
+        PlaySound(aliases[i]);
+    }
+
+    // Let mixer apply commands before sampling
+    WaitTime(0.1);
+
+    float mixTime = 0.0f;
+    int samples = 0;
+    int mixedVoices = 0;
+
+    for (float t = 0.0f; t < AUDIO_MEASURE_TIME; t += 0.01f, samples++)
+    {
+        WaitTime(0.01);
+        mixTime += GetAudioFrameMixTime();
+        if (GetAudioVoiceCount() > mixedVoices) mixedVoices = GetAudioVoiceCount();
+    }
+
+    for (int i = 0; i < voiceCount; i++) StopSound(aliases[i]);
+    WaitTime(0.05);
+
+    AddBenchmarkResult("    %2i voices (%2i mixed): %8.1f ns/frame, %6.1f ns/frame per voice", voiceCount, mixedVoices,
+        mixTime/samples, mixTime/samples/voiceCount);
+}
+
+// Audio mixing benchmark: time spent mixing one frame with N playing voices
+void RunAudioMixBenchmark(void)
+{
+    InitAudioDevice();
+
+    if (!IsAudioDeviceReady())
+    {
+        AddBenchmarkResult("AUDIO MIX: audio device not available");
+        return;
+    }
+
+    // Stereo float sound at device rate, already in mixing format
+    Wave wave = { 0 };
+    wave.frameCount = AUDIO_SAMPLE_RATE*AUDIO_SOUND_SECONDS;
+    wave.sampleRate = AUDIO_SAMPLE_RATE;
+    wave.sampleSize = 32;
+    wave.channels = 2;
+    wave.data = MemAlloc(wave.frameCount*wave.channels*sizeof(float));
+
+    for (unsigned int i = 0; i < wave.frameCount; i++)
+    {
+        float sample = sinf(2.0f*PI*440.0f*i/AUDIO_SAMPLE_RATE);
+
+        ((float *)wave.data)[i*2 + 0] = sample;
+        ((float *)wave.data)[i*2 + 1] = sample*0.5f;
+    }
+
+    Sound sound = LoadSoundFromWave(wave);
+    UnloadWave(wave);
+
+    Sound aliases[AUDIO_MAX_VOICES] = { 0 };
+    for (int i = 0; i < AUDIO_MAX_VOICES; i++) aliases[i] = LoadSoundAlias(sound);
+
+    const int voiceCounts[] = { 1, 8, 32, AUDIO_MAX_VOICES };
+    const int testCount = sizeof(voiceCounts)/sizeof(voiceCounts[0]);
+
+    // Pitch 1.0 sounds are mixed directly from sound data, other pitch values go through the converter
+    AddBenchmarkResult("AUDIO MIX: direct path (pitch 1.0)");
+    for (int i = 0; i < testCount; i++) RunVoicesMixBenchmark(aliases, voiceCounts[i], 1.0f);
+
+    AddBenchmarkResult("AUDIO MIX: converter path (pitch 1.1)");
+    for (int i = 0; i < testCount; i++) RunVoicesMixBenchmark(aliases, voiceCounts[i], 1.1f);
+
+    for (int i = 0; i < AUDIO_MAX_VOICES; i++) UnloadSoundAlias(aliases[i]);
+    UnloadSound(sound);
+
+    CloseAudioDevice();
+}
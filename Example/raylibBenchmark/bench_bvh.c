@@ -0,0 +1,118 @@
+#include <stdlib.h>
+#include <math.h>
+#include "raylib.h"
+#include "raymath.h"
+#include "benchmark.h"
+
+#define BVH_RAY_COUNT           256     // Rays tested against every mesh
+
+// Reference brute force ray collision, same as GetRayCollisionMesh() before BVH support
+static RayCollision GetRayCollisionMeshBruteForce(Ray ray, Mesh mesh, Matrix transform)
+{
+    RayCollision collision = { 0 };
+    Vector3 *vertdata = (Vector3 *)mesh.vertices;
+
+    for (int i = 0; i < mesh.triangleCount; i++)
+    {
+        Vector3 a, b, c;
+
+        if (mesh.indices)
+        {
+            a = vertdata[mesh.indices[i*3 + 0]];
+            b = vertdata[mesh.indices[i*3 + 1]];
+            c = vertdata[mesh.indices[i*3 + 2]];
+        }
+        else
+        {
+            a = vertdata[i*3 + 0];
+            b = vertdata[i*3 + 1];
+            c = vertdata[i*3 + 2];
+        }
+
+        a = Vector3Transform(a, transform);
+        b = Vector3Transform(b, transform);
+        c = Vector3Transform(c, transform);
+
+        RayCollision triHitInfo = GetRayCollisionTriangle(ray, a, b, c);
+
+        if (triHitInfo.hit)
+        {
+            // Save the closest hit triangle
+            if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+        }
+    }
+
+    return collision;
+}
+
+// Run ray queries on a mesh, brute force reference vs BVH (single and batched)
+static void RunMeshRaysBenchmark(const char *name, Mesh mesh, Matrix transform, Vector3 size)
+{
+    Ray *rays = (Ray *)MemAlloc(BVH_RAY_COUNT*sizeof(Ray));
+    RayCollision *reference = (RayCollision *)MemAlloc(BVH_RAY_COUNT*sizeof(RayCollision));
+    RayCollision *collisions = (RayCollision *)MemAlloc(BVH_RAY_COUNT*sizeof(RayCollision));
+
+    // Rays cast from above the mesh, most of them hit
+    for (int i = 0; i < BVH_RAY_COUNT; i++)
+    {
+        Vector3 target = { GetRandomValue(0, 1000)*size.x/1000.0f, 0.0f, GetRandomValue(0, 1000)*size.z/1000.0f };
+
+        rays[i].position = (Vector3){ size.x*0.5f, size.y*4.0f, size.z*0.5f };
+        rays[i].direction = Vector3Normalize(Vector3Subtract(target, rays[i].position));
+    }
+
+    double start = GetTime();
+    for (int i = 0; i < BVH_RAY_COUNT; i++) reference[i] = GetRayCollisionMeshBruteForce(rays[i], mesh, transform);
+    double bruteTime = GetTime() - start;
+
+    start = GetTime();
+    GenMeshBVH(&mesh);
+    double buildTime = GetTime() - start;
+
+    start = GetTime();
+    for (int i = 0; i < BVH_RAY_COUNT; i++) collisions[i] = GetRayCollisionMesh(rays[i], mesh, transform);
+    double bvhTime = GetTime() - start;
+
+    int mismatches = 0;
+    int hits = 0;
+    for (int i = 0; i < BVH_RAY_COUNT; i++)
+    {
+        if (reference[i].hit) hits++;
+        if ((collisions[i].hit != reference[i].hit) ||
+            (reference[i].hit && (fabsf(collisions[i].distance - reference[i].distance) > 0.001f*reference[i].distance))) mismatches++;
+    }
+
+    start = GetTime();
+    GetRayCollisionMeshBatch(rays, BVH_RAY_COUNT, mesh, transform, collisions);
+    double batchTime = GetTime() - start;
+
+    for (int i = 0; i < BVH_RAY_COUNT; i++)
+    {
+        if ((collisions[i].hit != reference[i].hit) ||
+            (reference[i].hit && (fabsf(collisions[i].distance - reference[i].distance) > 0.001f*reference[i].distance))) mismatches++;
+    }
+
+    AddBenchmarkResult("BVH %s: %i triangles, %i rays (%i hits), build %.2f ms", name, mesh.triangleCount, BVH_RAY_COUNT, hits, buildTime*1000.0);
+    AddBenchmarkResult("    brute force: %.0f rays/s", BVH_RAY_COUNT/bruteTime);
+    AddBenchmarkResult("    BVH: %.0f rays/s (x%.1f), batch: %.0f rays/s, mismatches %i", BVH_RAY_COUNT/bvhTime, bruteTime/bvhTime, BVH_RAY_COUNT/batchTime, mismatches);
+
+    MemFree(collisions);
+    MemFree(reference);
+    MemFree(rays);
+    UnloadMesh(mesh);
+}
+
+// BVH benchmark: ray queries per second on generated heightmap and cubicmap meshes
+void RunBVHBenchmark(void)
+{
+    Vector3 size = { 32.0f, 4.0f, 32.0f };
+    Matrix transform = MatrixMultiply(MatrixScale(1.0f, 1.5f, 1.0f), MatrixTranslate(-1.0f, 0.0f, 2.0f));
+
+    Image heightmap = GenImagePerlinNoise(64, 64, 0, 0, 4.0f);
+    RunMeshRaysBenchmark("heightmap", GenMeshHeightmap(heightmap, size), transform, size);
+    UnloadImage(heightmap);
+
+    Image cubicmap = GenImageChecked(32, 32, 3, 5, WHITE, BLACK);
+    RunMeshRaysBenchmark("cubicmap", GenMeshCubicmap(cubicmap, (Vector3){ 1.0f, 1.0f, 1.0f }), transform, size);
+    UnloadImage(cubicmap);
+}
@@ -0,0 +1,175 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "raylib.h"
+#include "benchmark.h"
+
+#define IMAGE_SIZE              512     // Converted image width and height
+#define IMAGE_ITERATIONS        4       // Conversions timed per pair and path
+
+#define PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD  50  // Same as rtextures.c default
+
+// Formats with direct conversions, every ordered pair is tested
+static const int formats[] = {
+    PIXELFORMAT_UNCOMPRESSED_GRAYSCALE,
+    PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA,
+    PIXELFORMAT_UNCOMPRESSED_R5G6B5,
+    PIXELFORMAT_UNCOMPRESSED_R8G8B8,
+    PIXELFORMAT_UNCOMPRESSED_R5G5B5A1,
+    PIXELFORMAT_UNCOMPRESSED_R4G4B4A4,
+    PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+};
+
+static const char *formatNames[] = { "GRAY", "GRAY_ALPHA", "R5G6B5", "R8G8B8", "R5G5B5A1", "R4G4B4A4", "R8G8B8A8" };
+
+// Reference conversion, same as ImageFormat() generic path: full image expanded to normalized Vector4
+static void ImageFormatReference(Image *image, int newFormat)
+{
+    int pixelCount = image->width*image->height;
+    Vector4 *pixels = (Vector4 *)MemAlloc(pixelCount*sizeof(Vector4));
+    const unsigned char *src8 = (const unsigned char *)image->data;
+    const unsigned short *src16 = (const unsigned short *)image->data;
+
+    for (int i = 0; i < pixelCount; i++)
+    {
+        switch (image->format)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: pixels[i] = (Vector4){ src8[i]/255.0f, src8[i]/255.0f, src8[i]/255.0f, 1.0f }; break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: pixels[i] = (Vector4){ src8[i*2]/255.0f, src8[i*2]/255.0f, src8[i*2]/255.0f, src8[i*2 + 1]/255.0f }; break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            {
+                unsigned short pixel = src16[i];
+                pixels[i] = (Vector4){ (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31), (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31),
+                                       (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31), ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f };
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+            {
+                unsigned short pixel = src16[i];
+                pixels[i] = (Vector4){ (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31), (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63),
+                                       (float)(pixel & 0b0000000000011111)*(1.0f/31), 1.0f };
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                unsigned short pixel = src16[i];
+                pixels[i] = (Vector4){ (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15), (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15),
+                                       (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15), (float)(pixel & 0b0000000000001111)*(1.0f/15) };
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: pixels[i] = (Vector4){ src8[i*4]/255.0f, src8[i*4 + 1]/255.0f, src8[i*4 + 2]/255.0f, src8[i*4 + 3]/255.0f }; break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: pixels[i] = (Vector4){ src8[i*3]/255.0f, src8[i*3 + 1]/255.0f, src8[i*3 + 2]/255.0f, 1.0f }; break;
+            default: break;
+        }
+    }
+
+    MemFree(image->data);
+    image->data = MemAlloc(GetPixelDataSize(image->width, image->height, newFormat));
+    image->format = newFormat;
+
+    unsigned char *dst8 = (unsigned char *)image->data;
+    unsigned short *dst16 = (unsigned short *)image->data;
+
+    for (int i = 0; i < pixelCount; i++)
+    {
+        switch (newFormat)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: dst8[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f); break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            {
+                dst8[i*2] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
+                dst8[i*2 + 1] = (unsigned char)(pixels[i].w*255.0f);
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+            {
+                dst16[i] = (unsigned short)((unsigned char)round(pixels[i].x*31.0f)) << 11 | (unsigned short)((unsigned char)round(pixels[i].y*63.0f)) << 5 |
+                           (unsigned short)((unsigned char)round(pixels[i].z*31.0f));
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            {
+                dst8[i*3] = (unsigned char)(pixels[i].x*255.0f);
+                dst8[i*3 + 1] = (unsigned char)(pixels[i].y*255.0f);
+                dst8[i*3 + 2] = (unsigned char)(pixels[i].z*255.0f);
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            {
+                unsigned char a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+                dst16[i] = (unsigned short)((unsigned char)round(pixels[i].x*31.0f)) << 11 | (unsigned short)((unsigned char)round(pixels[i].y*31.0f)) << 6 |
+                           (unsigned short)((unsigned char)round(pixels[i].z*31.0f)) << 1 | (unsigned short)a;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                dst16[i] = (unsigned short)((unsigned char)round(pixels[i].x*15.0f)) << 12 | (unsigned short)((unsigned char)round(pixels[i].y*15.0f)) << 8 |
+                           (unsigned short)((unsigned char)round(pixels[i].z*15.0f)) << 4 | (unsigned short)((unsigned char)round(pixels[i].w*15.0f));
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+            {
+                dst8[i*4] = (unsigned char)(pixels[i].x*255.0f);
+                dst8[i*4 + 1] = (unsigned char)(pixels[i].y*255.0f);
+                dst8[i*4 + 2] = (unsigned char)(pixels[i].z*255.0f);
+                dst8[i*4 + 3] = (unsigned char)(pixels[i].w*255.0f);
+            } break;
+            default: break;
+        }
+    }
+
+    MemFree(pixels);
+}
+
+// Image format benchmark: per pair conversion throughput, ImageFormat() output checked against reference conversion
+void RunImageFormatBenchmark(void)
+{
+    const int formatCount = sizeof(formats)/sizeof(formats[0]);
+    const double pixels = (double)IMAGE_SIZE*IMAGE_SIZE*IMAGE_ITERATIONS;
+    int identicalCount = 0;
+    int pairCount = 0;
+
+    // Random colors and alpha, every source format gets all its values covered
+    Image base = GenImageColor(IMAGE_SIZE, IMAGE_SIZE, BLANK);
+    for (int i = 0; i < IMAGE_SIZE*IMAGE_SIZE*4; i++) ((unsigned char *)base.data)[i] = (unsigned char)GetRandomValue(0, 255);
+
+    AddBenchmarkResult("IMAGE FORMAT: %ix%i, reference vs ImageFormat() (Mpixels/s)", IMAGE_SIZE, IMAGE_SIZE);
+
+    for (int s = 0; s < formatCount; s++)
+    {
+        Image source = ImageCopy(base);
+        ImageFormat(&source, formats[s]);
+
+        for (int d = 0; d < formatCount; d++)
+        {
+            if (d == s) continue;
+
+            double referenceTime = 0.0;
+            double directTime = 0.0;
+            bool identical = true;
+
+            for (int i = 0; i < IMAGE_ITERATIONS; i++)
+            {
+                Image reference = ImageCopy(source);
+                Image direct = ImageCopy(source);
+
+                double start = GetTime();
+                ImageFormatReference(&reference, formats[d]);
+                referenceTime += GetTime() - start;
+
+                start = GetTime();
+                ImageFormat(&direct, formats[d]);
+                directTime += GetTime() - start;
+
+                if (memcmp(reference.data, direct.data, GetPixelDataSize(IMAGE_SIZE, IMAGE_SIZE, formats[d])) != 0) identical = false;
+
+                UnloadImage(reference);
+                UnloadImage(direct);
+            }
+
+            if (identical) identicalCount++;
+            pairCount++;
+
+            AddBenchmarkResult("    %s -> %s: %.1f vs %.1f (x%.1f) %s", formatNames[s], formatNames[d],
+                pixels/referenceTime/1000000.0, pixels/directTime/1000000.0, referenceTime/directTime, identical? "identical" : "MISMATCH");
+        }
+
+        UnloadImage(source);
+    }
+
+    UnloadImage(base);
+
+    AddBenchmarkResult("IMAGE FORMAT: %i/%i pairs bit-identical to reference", identicalCount, pairCount);
+}
@@ -0,0 +1,99 @@
+#include <stdlib.h>
+#include <string.h>
+#include "raylib.h"
+#include "benchmark.h"
+
+#define JOBS_IMAGE_SIZE         512     // Processed image width and height
+#define JOBS_OPERATION_COUNT    4       // Image operations timed per workers count
+
+static const char *operationNames[JOBS_OPERATION_COUNT] = { "blur", "conv", "resize", "mipmaps" };
+
+// Get image data size, including mipmaps
+static int GetImageDataSize(Image image)
+{
+    int size = 0;
+
+    for (int i = 0, width = image.width, height = image.height; i < image.mipmaps; i++)
+    {
+        size += GetPixelDataSize(width, height, image.format);
+        if (width > 1) width /= 2;
+        if (height > 1) height /= 2;
+    }
+
+    return size;
+}
+
+// Run image operation on a copy of source image, returns time spent (in seconds)
+static double RunImageOperation(Image source, int operation, Image *result)
+{
+    static const float sharpen[9] = { 0.0f, -1.0f, 0.0f, -1.0f, 5.0f, -1.0f, 0.0f, -1.0f, 0.0f };
+
+    *result = ImageCopy(source);
+
+    double start = GetTime();
+
+    switch (operation)
+    {
+        case 0: ImageBlurGaussian(result, 8); break;
+        case 1: ImageKernelConvolution(result, sharpen, 9); break;
+        case 2: ImageResize(result, source.width*3/4, source.height*3/4); break;
+        case 3: ImageMipmaps(result); break;
+        default: break;
+    }
+
+    return GetTime() - start;
+}
+
+// Image jobs benchmark: image processing scaling with job workers, results checked against serial processing
+void RunImageJobsBenchmark(void)
+{
+    const int workerCounts[] = { 0, 1, 2, 3, 4, 8, 16 };
+    const int testCount = sizeof(workerCounts)/sizeof(workerCounts[0]);
+
+    Image source = GenImagePerlinNoise(JOBS_IMAGE_SIZE, JOBS_IMAGE_SIZE, 0, 0, 8.0f);
+    for (int i = 0; i < JOBS_IMAGE_SIZE*JOBS_IMAGE_SIZE*4; i += 4) ((unsigned char *)source.data)[i] = (unsigned char)GetRandomValue(0, 255);
+
+    Image serial[JOBS_OPERATION_COUNT] = { 0 };
+    double serialTime = 0.0;
+
+    // NOTE: Image processing is only split across workers with raylib built with SUPPORT_IMAGE_JOBS,
+    // workers count is limited by MAX_JOB_WORKERS, calling thread also processes jobs
+    AddBenchmarkResult("IMAGE JOBS: %ix%i RGBA, time per workers count (SUPPORT_IMAGE_JOBS)", JOBS_IMAGE_SIZE, JOBS_IMAGE_SIZE);
+
+    for (int t = 0; t < testCount; t++)
+    {
+        SetJobWorkerCount(workerCounts[t]);
+
+        double times[JOBS_OPERATION_COUNT] = { 0 };
+        double totalTime = 0.0;
+        bool identical = true;
+
+        for (int op = 0; op < JOBS_OPERATION_COUNT; op++)
+        {
+            Image result = { 0 };
+            times[op] = RunImageOperation(source, op, &result);
+            totalTime += times[op];
+
+            // Serial results are kept as reference for other workers counts
+            if (t == 0) serial[op] = result;
+            else
+            {
+                if ((result.width != serial[op].width) || (result.height != serial[op].height) || (result.mipmaps != serial[op].mipmaps) ||
+                    (memcmp(result.data, serial[op].data, GetImageDataSize(result)) != 0)) identical = false;
+
+                UnloadImage(result);
+            }
+        }
+
+        if (t == 0) serialTime = totalTime;
+
+        AddBenchmarkResult("    %2i workers: %s %.1f, %s %.1f, %s %.1f, %s %.1f ms (x%.2f) %s", workerCounts[t],
+            operationNames[0], times[0]*1000.0, operationNames[1], times[1]*1000.0, operationNames[2], times[2]*1000.0,
+            operationNames[3], times[3]*1000.0, serialTime/totalTime, (t == 0)? "serial" : (identical? "identical" : "MISMATCH"));
+    }
+
+    for (int op = 0; op < JOBS_OPERATION_COUNT; op++) UnloadImage(serial[op]);
+    UnloadImage(source);
+
+    SetJobWorkerCount(DEFAULT_JOB_WORKERS);
+}
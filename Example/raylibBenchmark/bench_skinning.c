@@ -0,0 +1,210 @@
+#include <stdlib.h>
+#include <math.h>
+#include "raylib.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include "benchmark.h"
+
+#define SKINNING_VERTEX_COUNT   16384   // Vertices of the skinned mesh
+#define SKINNING_BONE_COUNT     32      // Bones of the skeleton
+#define SKINNING_FRAME_COUNT    16      // Frames of the animation
+#define SKINNING_ITERATIONS     64      // Animation updates timed per path
+
+// Reference scalar skinning, same as UpdateModelAnimation() before vectorization
+static void UpdateModelAnimationScalar(Model model, ModelAnimation anim, int frame)
+{
+    UpdateModelAnimationBones(model, anim, frame);
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        Mesh mesh = model.meshes[m];
+        Vector3 animVertex = { 0 };
+        Vector3 animNormal = { 0 };
+        int boneId = 0;
+        int boneCounter = 0;
+        float boneWeight = 0.0;
+        bool updated = false;
+        const int vValues = mesh.vertexCount*3;
+
+        for (int vCounter = 0; vCounter < vValues; vCounter += 3)
+        {
+            mesh.animVertices[vCounter] = 0;
+            mesh.animVertices[vCounter + 1] = 0;
+            mesh.animVertices[vCounter + 2] = 0;
+
+            if (mesh.animNormals != NULL)
+            {
+                mesh.animNormals[vCounter] = 0;
+                mesh.animNormals[vCounter + 1] = 0;
+                mesh.animNormals[vCounter + 2] = 0;
+            }
+
+            // Iterates over 4 bones per vertex
+            for (int j = 0; j < 4; j++, boneCounter++)
+            {
+                boneWeight = mesh.boneWeights[boneCounter];
+                boneId = mesh.boneIds[boneCounter];
+
+                // Early stop when no transformation will be applied
+                if (boneWeight == 0.0f) continue;
+
+                animVertex = (Vector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
+                animVertex = Vector3Transform(animVertex, mesh.boneMatrices[boneId]);
+                mesh.animVertices[vCounter] += animVertex.x*boneWeight;
+                mesh.animVertices[vCounter + 1] += animVertex.y*boneWeight;
+                mesh.animVertices[vCounter + 2] += animVertex.z*boneWeight;
+                updated = true;
+
+                if (mesh.normals != NULL)
+                {
+                    animNormal = (Vector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
+                    animNormal = Vector3Transform(animNormal, mesh.boneMatrices[boneId]);
+                    mesh.animNormals[vCounter] += animNormal.x*boneWeight;
+                    mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
+                    mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
+                }
+            }
+        }
+
+        if (updated)
+        {
+            rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0);
+            rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);
+        }
+    }
+}
+
+// Generate a skinned model with random vertices, up to 4 weighted bones per vertex
+static Model GenSkinnedModel(void)
+{
+    Model model = { 0 };
+    Mesh mesh = { 0 };
+
+    mesh.vertexCount = SKINNING_VERTEX_COUNT;
+    mesh.triangleCount = SKINNING_VERTEX_COUNT/3;
+    mesh.boneCount = SKINNING_BONE_COUNT;
+    mesh.vertices = (float *)MemAlloc(mesh.vertexCount*3*sizeof(float));
+    mesh.normals = (float *)MemAlloc(mesh.vertexCount*3*sizeof(float));
+    mesh.animVertices = (float *)MemAlloc(mesh.vertexCount*3*sizeof(float));
+    mesh.animNormals = (float *)MemAlloc(mesh.vertexCount*3*sizeof(float));
+    mesh.boneIds = (unsigned char *)MemAlloc(mesh.vertexCount*4*sizeof(unsigned char));
+    mesh.boneWeights = (float *)MemAlloc(mesh.vertexCount*4*sizeof(float));
+    mesh.boneMatrices = (Matrix *)MemAlloc(mesh.boneCount*sizeof(Matrix));
+
+    for (int v = 0; v < mesh.vertexCount; v++)
+    {
+        Vector3 normal = Vector3Normalize((Vector3){ GetRandomValue(-100, 100)/100.0f, GetRandomValue(-100, 100)/100.0f, 1.0f });
+
+        mesh.vertices[v*3 + 0] = GetRandomValue(-1000, 1000)/1000.0f;
+        mesh.vertices[v*3 + 1] = GetRandomValue(0, 2000)/1000.0f;
+        mesh.vertices[v*3 + 2] = GetRandomValue(-1000, 1000)/1000.0f;
+        mesh.normals[v*3 + 0] = normal.x;
+        mesh.normals[v*3 + 1] = normal.y;
+        mesh.normals[v*3 + 2] = normal.z;
+
+        // Usual skinned meshes mix 1 to 4 bones per vertex, unused slots have zero weight
+        int influences = GetRandomValue(1, 4);
+        float total = 0.0f;
+
+        for (int j = 0; j < 4; j++)
+        {
+            mesh.boneIds[v*4 + j] = (unsigned char)GetRandomValue(0, SKINNING_BONE_COUNT - 1);
+            mesh.boneWeights[v*4 + j] = (j < influences)? GetRandomValue(1, 100)/100.0f : 0.0f;
+            total += mesh.boneWeights[v*4 + j];
+        }
+
+        for (int j = 0; j < 4; j++) mesh.boneWeights[v*4 + j] /= total;
+    }
+
+    UploadMesh(&mesh, true);
+
+    model.transform = MatrixIdentity();
+    model.meshCount = 1;
+    model.meshes = (Mesh *)MemAlloc(sizeof(Mesh));
+    model.meshes[0] = mesh;
+    model.materialCount = 1;
+    model.materials = (Material *)MemAlloc(sizeof(Material));
+    model.materials[0] = LoadMaterialDefault();
+    model.meshMaterial = (int *)MemAlloc(sizeof(int));
+
+    model.boneCount = SKINNING_BONE_COUNT;
+    model.bones = (BoneInfo *)MemAlloc(model.boneCount*sizeof(BoneInfo));
+    model.bindPose = (Transform *)MemAlloc(model.boneCount*sizeof(Transform));
+
+    for (int b = 0; b < model.boneCount; b++)
+    {
+        model.bones[b].parent = b - 1;
+        model.bindPose[b].translation = (Vector3){ 0.0f, b*2.0f/SKINNING_BONE_COUNT, 0.0f };
+        model.bindPose[b].rotation = QuaternionIdentity();
+        model.bindPose[b].scale = Vector3One();
+    }
+
+    return model;
+}
+
+// Generate an animation bending the skeleton over time
+static ModelAnimation GenSkinnedAnimation(Model model)
+{
+    ModelAnimation anim = { 0 };
+
+    anim.boneCount = model.boneCount;
+    anim.frameCount = SKINNING_FRAME_COUNT;
+    anim.bones = (BoneInfo *)MemAlloc(anim.boneCount*sizeof(BoneInfo));
+    anim.framePoses = (Transform **)MemAlloc(anim.frameCount*sizeof(Transform *));
+
+    for (int b = 0; b < anim.boneCount; b++) anim.bones[b] = model.bones[b];
+
+    for (int f = 0; f < anim.frameCount; f++)
+    {
+        anim.framePoses[f] = (Transform *)MemAlloc(anim.boneCount*sizeof(Transform));
+
+        for (int b = 0; b < anim.boneCount; b++)
+        {
+            float angle = sinf(f*2.0f*PI/SKINNING_FRAME_COUNT + b*0.2f)*0.5f;
+
+            anim.framePoses[f][b].translation = Vector3Add(model.bindPose[b].translation, (Vector3){ angle*0.1f, 0.0f, 0.0f });
+            anim.framePoses[f][b].rotation = QuaternionFromAxisAngle((Vector3){ 0.0f, 0.0f, 1.0f }, angle);
+            anim.framePoses[f][b].scale = (Vector3){ 1.0f, 1.0f + angle*0.1f, 1.0f };
+        }
+    }
+
+    return anim;
+}
+
+// Skinning benchmark: vertices skinned per second on a single core, scalar reference vs UpdateModelAnimation()
+void RunSkinningBenchmark(void)
+{
+    Model model = GenSkinnedModel();
+    ModelAnimation anim = GenSkinnedAnimation(model);
+    Mesh mesh = model.meshes[0];
+    float *reference = (float *)MemAlloc(mesh.vertexCount*3*sizeof(float));
+
+    // Job system runs all jobs on calling thread, measuring single core throughput
+    SetJobWorkerCount(0);
+
+    double start = GetTime();
+    for (int i = 0; i < SKINNING_ITERATIONS; i++) UpdateModelAnimationScalar(model, anim, i);
+    double scalarTime = GetTime() - start;
+
+    for (int i = 0; i < mesh.vertexCount*3; i++) reference[i] = mesh.animVertices[i];
+
+    start = GetTime();
+    for (int i = 0; i < SKINNING_ITERATIONS; i++) UpdateModelAnimation(model, anim, i);
+    double vectorTime = GetTime() - start;
+
+    // Both paths end on the same frame, skinned positions must match
+    float maxError = 0.0f;
+    for (int i = 0; i < mesh.vertexCount*3; i++) maxError = fmaxf(maxError, fabsf(mesh.animVertices[i] - reference[i]));
+
+    double vertices = (double)mesh.vertexCount*SKINNING_ITERATIONS;
+
+    AddBenchmarkResult("SKINNING: %i vertices, %i bones, 1 core", mesh.vertexCount, mesh.boneCount);
+    AddBenchmarkResult("    scalar reference: %.2f Mverts/s", vertices/scalarTime/1000000.0);
+    AddBenchmarkResult("    UpdateModelAnimation: %.2f Mverts/s (x%.2f, max error %.6f)", vertices/vectorTime/1000000.0, scalarTime/vectorTime, maxError);
+
+    SetJobWorkerCount(DEFAULT_JOB_WORKERS);
+
+    MemFree(reference);
+    UnloadModelAnimation(anim);
+    UnloadModel(model);
+}
@@ -0,0 +1,17 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#define MAX_BENCHMARK_RESULTS   256 // Maximum number of result lines kept for display
+#define DEFAULT_JOB_WORKERS     2   // Job system default workers (raylib config.h), restored after benchmarks
+
+// Add a result line, logged and shown on screen
+void AddBenchmarkResult(const char *text, ...);
+
+// Benchmarks, run once after window creation
+void RunSkinningBenchmark(void);
+void RunBVHBenchmark(void);
+void RunImageFormatBenchmark(void);
+void RunImageJobsBenchmark(void);
+void RunAudioMixBenchmark(void);
+
+#endif // BENCHMARK_H
@@ -0,0 +1,92 @@
+#include <stdio.h>
+#include <stdarg.h>
+#include <psp2/kernel/clib.h>
+#include "raylib.h"
+#include "benchmark.h"
+
+int _newlib_heap_size_user = 64 * 1024 * 1024;
+
+#define RESULT_LINE_HEIGHT 22
+
+static char results[MAX_BENCHMARK_RESULTS][128] = { 0 };
+static int resultCount = 0;
+
+// Add a result line, logged and shown on screen
+void AddBenchmarkResult(const char *text, ...)
+{
+    if (resultCount >= MAX_BENCHMARK_RESULTS) return;
+
+    va_list args;
+    va_start(args, text);
+    vsnprintf(results[resultCount], sizeof(results[0]), text, args);
+    va_end(args);
+
+    TraceLog(LOG_INFO, "BENCH: %s", results[resultCount]);
+    resultCount++;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 960;
+    const int screenHeight = 544;
+
+    InitWindow(screenWidth, screenHeight, "raylib benchmark");
+
+    BeginDrawing();
+        ClearBackground(RAYWHITE);
+        DrawText("Running benchmarks...", 10, 10, 20, DARKGRAY);
+    EndDrawing();
+
+    // Run all benchmarks once, results are kept for display
+    RunSkinningBenchmark();
+    RunBVHBenchmark();
+    RunImageFormatBenchmark();
+    RunImageJobsBenchmark();
+#if defined(BENCHMARK_AUDIO)
+    RunAudioMixBenchmark();
+#endif
+
+    int scroll = 0;
+    const int visibleLines = (screenHeight - 50)/RESULT_LINE_HEIGHT;
+
+    SetTargetFPS(60); // Set our game to run at 60 frames-per-second
+    //---------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose()) // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if ((IsKeyDown(KEY_DOWN) || IsGamepadButtonDown(0, GAMEPAD_BUTTON_LEFT_FACE_DOWN)) && (scroll < resultCount - visibleLines)) scroll++;
+        if ((IsKeyDown(KEY_UP) || IsGamepadButtonDown(0, GAMEPAD_BUTTON_LEFT_FACE_UP)) && (scroll > 0)) scroll--;
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText("BENCHMARK RESULTS (d-pad to scroll)", 10, 10, 20, MAROON);
+
+            for (int i = scroll; (i < resultCount) && (i < scroll + visibleLines); i++)
+            {
+                DrawText(results[i], 10, 40 + (i - scroll)*RESULT_LINE_HEIGHT, 20, DARKGRAY);
+            }
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    CloseWindow(); // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
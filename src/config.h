@@ -70,6 +70,10 @@
 // By default EndDrawing() does this job: draws everything + SwapScreenBuffer() + manage frame timing + PollInputEvents()
 // Enabling this flag allows manual control of the frame processes, use at your own risk
 //#define SUPPORT_CUSTOM_FRAME_CONTROL    1
+// Support internal job system, a small pool of worker threads used to split CPU heavy work
+// (models animation skinning...) across cores, if not defined all work runs on calling thread
+// NOTE: Requires POSIX threads (pthread library must be linked)
+#define SUPPORT_JOB_SYSTEM              1
 
 
 // rcore: Configuration values
@@ -91,6 +95,9 @@
 
 #define MAX_AUTOMATION_EVENTS       16384       // Maximum number of automation events to record
 
+#define MAX_JOB_WORKERS                 8       // Maximum number of job system worker threads
+#define DEFAULT_JOB_WORKERS             2       // Default number of job system worker threads (PSVita: 3 user cores, main thread included)
+
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration values
 //------------------------------------------------------------------------------------
@@ -107,6 +114,8 @@
 #define RL_DEFAULT_BATCH_BUFFERS               1      // Default number of batch buffers (multi-buffering)
 #define RL_DEFAULT_BATCH_DRAWCALLS           256      // Default number of batch draw calls (by state changes: mode, texture)
 #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS     4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+#define RL_DEFAULT_BATCH_TEXTURE_SLOTS         4      // Maximum number of textures per batch draw call with default shader (1 to 4, 1 disables multi-texture draws)
+#define RL_DEFAULT_BATCH_STREAM_BUFFERS        3      // Number of GPU vertex buffers streamed round-robin by each batch buffer
 
 #define RL_MAX_MATRIX_STACK_SIZE              32      // Maximum size of internal Matrix stack
 
@@ -127,6 +136,7 @@
     #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS     7
     #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS 8
 #endif
+#define RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT     9
 
 // Default shader vertex attribute names to set location points
 // NOTE: When a new shader is loaded, the following locations are tried to be set for convenience
@@ -136,6 +146,7 @@
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR        "vertexColor"       // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT      "vertexTangent"     // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2
+#define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT      "vertexTexSlot"     // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT
 
 #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
@@ -186,6 +197,10 @@
 // Support multiple image editing functions to scale, adjust colors, flip, draw on images, crop...
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
+// Support splitting CPU heavy image processing [ImageResize(), ImageBlurGaussian(), ImageKernelConvolution(), ImageMipmaps()]
+// in bands of rows across job system worker threads, results are identical to single threaded processing
+// NOTE: Requires SUPPORT_JOB_SYSTEM, otherwise work runs on calling thread
+//#define SUPPORT_IMAGE_JOBS              1
 
 
 //------------------------------------------------------------------------------------
@@ -209,11 +224,23 @@
 // drawing text and shapes with a single draw call [SetShapesTexture()].
 #define SUPPORT_FONT_ATLAS_WHITE_REC    1
 
+// Cache the layout (positioned glyph quads and size) of recently drawn/measured strings,
+// DrawTextEx() and MeasureTextEx() reuse it when same text is requested with same font and parameters
+#define SUPPORT_TEXT_LAYOUT_CACHE       1
+
+// Dynamic fonts [LoadFontDynamic()] rasterize glyphs on first use into a fixed size atlas texture,
+// atlas is split into pages and least recently used page is evicted when no space is available
+#define SUPPORT_FONT_DYNAMIC            1
+
 // rtext: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TEXT_BUFFER_LENGTH       1024       // Size of internal static buffers used on some functions:
                                                 // TextFormat(), TextSubtext(), TextToUpper(), TextToLower(), TextToPascal(), TextSplit()
 #define MAX_TEXTSPLIT_COUNT           128       // Maximum number of substrings to split: TextSplit()
+#define MAX_TEXT_LAYOUT_CACHE          32       // Maximum number of text layouts cached: DrawTextEx(), MeasureTextEx()
+#define FONT_DYNAMIC_ATLAS_SIZE      1024       // Dynamic font atlas texture size (width and height), limits font memory
+#define FONT_DYNAMIC_ATLAS_PAGES        4       // Dynamic font atlas pages, evicted as a whole (max 32)
+#define MAX_FONT_DYNAMIC_GLYPHS      1024       // Maximum number of glyphs resident on a dynamic font atlas
 
 
 //------------------------------------------------------------------------------------
@@ -252,6 +279,10 @@
 //#define SUPPORT_FILEFORMAT_XM           1
 //#define SUPPORT_FILEFORMAT_MOD          1
 
+// Decode music streams on a dedicated thread into a ring of decoded frames,
+// UpdateMusicStream() does not call decoders anymore, only updates music state
+//#define SUPPORT_MUSIC_DECODE_THREAD     1
+
 // raudio: Configuration values
 //------------------------------------------------------------------------------------
 #define AUDIO_DEVICE_FORMAT    ma_format_f32    // Device output format (miniaudio: float-32bit)
@@ -259,6 +290,8 @@
 #define AUDIO_DEVICE_SAMPLE_RATE           48000    // Device sample rate (device default)
 
 #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels
+#define MAX_AUDIO_VOICES                   0    // Maximum number of voices mixed, lower priority voices become virtual (0 = unlimited)
+#define AUDIO_VOICE_MIN_VOLUME        0.001f    // Minimum volume for a voice to be mixed, quieter voices become virtual
 
 //------------------------------------------------------------------------------------
 // Module: utils - Configuration Flags
@@ -269,10 +302,21 @@
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG                1
 //#define SUPPORT_TRACELOG_DEBUG          1
+// Support asset packs (.rpak), files are loaded from mounted packs transparently (single file, indexed)
+// NOTE: Compressed packed files require SUPPORT_COMPRESSION_API
+#define SUPPORT_ASSET_PACK              1
+// Support async assets loading: files are loaded and decoded on a loading thread,
+// GPU uploads are processed on main thread by EndDrawing() within a per-frame time budget
+// NOTE: Requires POSIX threads (pthread library must be linked)
+#define SUPPORT_ASYNC_LOADING           1
 
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define MAX_ASSET_PACKS                 8       // Maximum number of asset packs mounted at the same time
+#define ASSET_PACK_ALIGNMENT           64       // Uncompressed packed files data alignment, for direct access when mapped
+#define MAX_ASYNC_LOADS                64       // Maximum number of async loads in progress (or not retrieved)
+#define ASYNC_UPLOAD_BUDGET          2.0f       // Default per-frame time budget for async loads GPU uploads (milliseconds)
 
 
 // Enable partial support for clipboard image, only working on SDL3 or
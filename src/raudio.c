@@ -107,6 +107,18 @@
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>                     // Required for: strcmp() [Used in IsFileExtension(), LoadWaveFromMemory(), LoadMusicStreamFromMemory()]
 
+// Audio mixing SIMD path: SSE on x86/x64, NEON on ARM, scalar fallback otherwise
+// NOTE: Define AUDIO_MIX_DISABLE_SIMD to force the scalar path
+#if !defined(AUDIO_MIX_DISABLE_SIMD)
+    #if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #define AUDIO_MIX_SSE
+        #include <xmmintrin.h>          // Required for: SSE intrinsics [Used in MixAudioSamples()]
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define AUDIO_MIX_NEON
+        #include <arm_neon.h>           // Required for: NEON intrinsics [Used in MixAudioSamples()]
+    #endif
+#endif
+
 #if defined(RAUDIO_STANDALONE)
     #ifndef TRACELOG
         #define TRACELOG(level, ...)    printf(__VA_ARGS__)
@@ -221,6 +233,18 @@
 #ifndef MAX_AUDIO_BUFFER_POOL_CHANNELS
     #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
 #endif
+#ifndef MAX_AUDIO_COMMANDS
+    #define MAX_AUDIO_COMMANDS               256    // Audio mixer commands queue size (power of 2)
+#endif
+#ifndef MAX_AUDIO_VOICES
+    #define MAX_AUDIO_VOICES                   0    // Maximum number of voices mixed, lower priority voices become virtual (0 = unlimited)
+#endif
+#ifndef AUDIO_VOICE_MIN_VOLUME
+    #define AUDIO_VOICE_MIN_VOLUME        0.001f    // Minimum volume for a voice to be mixed, quieter voices become virtual
+#endif
+#ifndef MUSIC_DECODE_RING_SUBBUFFERS
+    #define MUSIC_DECODE_RING_SUBBUFFERS       4    // Music decoder ring size, in music stream sub-buffers
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -261,6 +285,31 @@ typedef enum {
     AUDIO_BUFFER_USAGE_STREAM
 } AudioBufferUsage;
 
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+// Music decoder, decodes music on a dedicated thread into a PCM ring read by the mixer
+// NOTE: Ring has a single producer (decoder thread) and a single consumer (mixer),
+// program thread only accesses music context while holding decoder lock
+typedef struct rMusicDecoder {
+    Music music;                    // Music decoded, context data shared with program
+    ma_thread thread;               // Decoder thread
+    ma_mutex lock;                  // Decoder lock, held by decoder thread while decoding and by program thread while seeking
+    ma_uint32 quit;                 // Decoder thread exit request (atomic access)
+    ma_uint32 looping;              // Music looping, updated from program music calls (atomic access)
+    ma_uint32 ended;                // Music end decoded, mixer stops music once ring is drained (atomic access)
+    unsigned int framesDecoded;     // Music frames decoded, decoder position in music
+    unsigned int sleepTime;         // Decoder thread sleep time while ring is full (milliseconds)
+
+    ma_pcm_rb ring;                 // Decoded frames ring, in music stream format
+    unsigned char *chunk;           // Decoded frames chunk, one music stream sub-buffer
+    unsigned int chunkSizeInFrames; // Decoded frames chunk size
+    unsigned int frameSize;         // Decoded frame size in bytes
+    unsigned int framesWritten;     // Frames written to ring counter
+    ma_uint32 framesRead;           // Frames read from ring counter (atomic access)
+    ma_uint32 discardPos;           // Frames written before last seek, skipped by mixer (atomic access)
+    ma_uint32 discard;              // Discard request, frames up to discardPos are skipped (atomic access)
+} rMusicDecoder;
+#endif
+
 // Audio buffer struct
 struct rAudioBuffer {
     ma_data_converter converter;    // Audio data converter
@@ -272,18 +321,26 @@ struct rAudioBuffer {
     float pitch;                    // Audio buffer pitch
     float pan;                      // Audio buffer pan (0.0f to 1.0f)
 
-    bool playing;                   // Audio buffer state: AUDIO_PLAYING
-    bool paused;                    // Audio buffer state: AUDIO_PAUSED
+    ma_bool32 playing;              // Audio buffer state: AUDIO_PLAYING (atomic access)
+    ma_bool32 paused;               // Audio buffer state: AUDIO_PAUSED (atomic access)
     bool looping;                   // Audio buffer looping, default to true for AudioStreams
     int usage;                      // Audio buffer usage mode: STATIC or STREAM
 
-    bool isSubBufferProcessed[2];   // SubBuffer processed (virtual double buffer)
+    ma_bool32 isSubBufferProcessed[2]; // SubBuffer processed (virtual double buffer) (atomic access)
     unsigned int sizeInFrames;      // Total buffer size in frames
     unsigned int frameCursorPos;    // Frame cursor position
     unsigned int framesProcessed;   // Total frames processed in this buffer (required for play timing)
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
 
+    int priority;                   // Voice priority, higher priority voices are mixed first when voices are limited
+    bool isVoice;                   // Audio buffer is on the mixer active voices list
+    rAudioBuffer *nextVoice;        // Next voice on the active voices list (sorted by priority)
+    rAudioBuffer *prevVoice;        // Previous voice on the active voices list
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    rMusicDecoder *decoder;         // Music decoder, stream frames are read from decoder ring (optional)
+#endif
+
     rAudioBuffer *next;             // Next audio buffer on the list
     rAudioBuffer *prev;             // Previous audio buffer on the list
 };
@@ -298,24 +355,72 @@ struct rAudioProcessor {
 
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+// Audio mixer command type
+// NOTE: Commands are pushed by program threads and applied by the mixer on the audio thread
+typedef enum {
+    AUDIO_COMMAND_TRACK = 0,        // Add audio buffer to mixer list
+    AUDIO_COMMAND_UNTRACK,          // Remove audio buffer from mixer list
+    AUDIO_COMMAND_UNLOAD,           // Remove audio buffer from mixer list, freed once applied
+    AUDIO_COMMAND_PLAY,             // Play audio buffer from the start
+    AUDIO_COMMAND_STOP,             // Stop audio buffer
+    AUDIO_COMMAND_VOLUME,           // Set audio buffer volume
+    AUDIO_COMMAND_PITCH,            // Set audio buffer pitch
+    AUDIO_COMMAND_PAN,              // Set audio buffer pan
+    AUDIO_COMMAND_PRIORITY,         // Set audio buffer voice priority
+    AUDIO_COMMAND_CALLBACK,         // Set audio buffer callback
+    AUDIO_COMMAND_ATTACH_PROCESSOR, // Attach processor to audio buffer (or mixed output)
+    AUDIO_COMMAND_DETACH_PROCESSOR  // Detach processor from audio buffer (or mixed output), freed once applied
+} AudioCommandType;
+
+// Audio mixer command
+typedef struct AudioCommand {
+    int type;                       // Command type: AudioCommandType
+    AudioBuffer *buffer;            // Command audio buffer (NULL for mixed output processors)
+    float value;                    // Command value: volume, pitch, pan, priority; unload data freeing
+    AudioCallback callback;         // Command callback: buffer callback, processor callback
+    rAudioProcessor *processor;     // Command processor: attached processor, detached processors (set by mixer)
+} AudioCommand;
+
 // Audio data context
 typedef struct AudioData {
     struct {
         ma_context context;         // miniaudio context data
         ma_device device;           // miniaudio device
-        ma_mutex lock;              // miniaudio mutex lock
+        ma_mutex lock;              // miniaudio mutex lock (serializes program threads commands, never locked by mixer)
         bool isReady;               // Check if audio device is ready
         size_t pcmBufferSize;       // Pre-allocated buffer size
         void *pcmBuffer;            // Pre-allocated buffer to read audio data from file/memory
     } System;
     struct {
-        AudioBuffer *first;         // Pointer to first AudioBuffer in the list
-        AudioBuffer *last;          // Pointer to last AudioBuffer in the list
+        AudioBuffer *first;         // Pointer to first AudioBuffer in the list (owned by mixer)
+        AudioBuffer *last;          // Pointer to last AudioBuffer in the list (owned by mixer)
         int defaultSize;            // Default audio buffer size for audio streams
     } Buffer;
-    rAudioProcessor *mixedProcessor;
+    struct {
+        AudioBuffer *first;         // Pointer to first playing or paused AudioBuffer, sorted by priority (owned by mixer)
+        ma_uint32 limit;            // Maximum number of voices mixed, 0 for unlimited (atomic access)
+        ma_uint32 realCount;        // Voices mixed on last audio callback (atomic access)
+        ma_uint32 virtualCount;     // Voices not mixed on last audio callback, cursor advancing only (atomic access)
+        float frameMixTime;         // Average time spent mixing one frame on last audio callback, in nanoseconds (atomic access)
+    } Voice;
+    struct {
+        AudioCommand queue[MAX_AUDIO_COMMANDS]; // Commands ring buffer, single producer (locked) and single consumer (mixer)
+        ma_uint32 head;             // Commands pushed counter (atomic access)
+        ma_uint32 tail;             // Commands applied counter (atomic access)
+        ma_uint32 collected;        // Commands applied and collected counter, resources freed by program thread
+    } Command;
+    rAudioProcessor *mixedProcessor; // Mixed output processors (owned by mixer)
 } AudioData;
 
+#if defined(SUPPORT_ASYNC_LOADING) && !defined(RAUDIO_STANDALONE)
+// Sound async load data
+typedef struct SoundAsyncLoad {
+    char *fileName;             // File name, stored after struct
+    Wave wave;                  // Wave loaded and decoded on loading thread
+    Sound sound;                // Sound loaded on main thread
+} SoundAsyncLoad;
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -326,6 +431,7 @@ static AudioData AUDIO = {          // Global AUDIO context
     // standard double-buffering system, a 4096 samples buffer has been chosen, it should be enough
     // In case of music-stalls, just increase this number
     .Buffer.defaultSize = 0,
+    .Voice.limit = MAX_AUDIO_VOICES,
     .mixedProcessor = NULL
 };
 
@@ -340,10 +446,41 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
 
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
+static void MixAudioSamples(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float levelEven, float levelOdd); // Accumulate samples scaled by alternating levels (SIMD)
+static bool IsAudioBufferDirectMix(AudioBuffer *buffer);    // Check if audio buffer data can be mixed directly (no conversion nor processing)
+static ma_uint32 MixAudioBufferDirect(AudioBuffer *buffer, float *framesOut, ma_uint32 frameCount); // Mix audio buffer data directly into output
+
+static void StopAudioBufferInMixer(AudioBuffer *buffer);
+
+// Audio mixer active voices, only playing or paused buffers are visited on every callback
+static void InsertAudioVoice(AudioBuffer *buffer);          // Insert audio buffer into active voices list, after higher priority voices
+static void RemoveAudioVoice(AudioBuffer *buffer);          // Remove audio buffer from active voices list
+static bool IsAudioBufferVirtualizable(AudioBuffer *buffer); // Check if audio buffer can be virtual (static data, no callback nor processing)
+static void AdvanceAudioBufferVirtual(AudioBuffer *buffer, ma_uint32 frameCount); // Advance audio buffer cursor without reading nor mixing
+
+// Audio mixer commands queue, lock-free on the audio thread side
+static void PushAudioCommand(AudioCommand command);         // Push command to mixer (program thread)
+static void SyncAudioCommands(void);                        // Wait for all pushed commands to be applied by mixer (program thread)
+static void ApplyAudioCommands(void);                       // Apply pending commands (mixer)
+static void CollectAudioCommands(void);                     // Free resources released by applied commands (program thread)
+
+static void DecodeMusicFrames(Music music, void *pcm, unsigned int framesToStream); // Decode music frames in music stream format, looping to start if required
+static void RewindMusicContext(Music music);                // Rewind music context to the start
+
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+// Music decoder thread, program thread never calls decoders and mixer only reads decoded frames ring
+static rMusicDecoder *LoadMusicDecoder(Music music);         // Load music decoder and start decoder thread
+static void UnloadMusicDecoder(rMusicDecoder *decoder);     // Stop decoder thread and unload music decoder
+static ma_thread_result MA_THREADCALL MusicDecoderThread(void *userData); // Music decoder thread entry point
+static bool DecodeMusicChunk(rMusicDecoder *decoder);       // Decode one music chunk into ring, if space available
+static ma_uint32 ReadMusicDecoderFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount); // Read decoded frames from ring (mixer)
+#endif
 
-static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer);
-static void StopAudioBufferInLockedState(AudioBuffer *buffer);
-static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount);
+#if defined(SUPPORT_ASYNC_LOADING) && !defined(RAUDIO_STANDALONE)
+static bool LoadSoundAsyncData(void *data);                 // Load and decode sound wave (loading thread)
+static bool UploadSoundAsyncData(void *data, AsyncUploads *uploads);    // Load sound from wave (main thread)
+static void UnloadSoundAsyncData(void *data, bool uploaded);    // Unload sound async load data not retrieved (main thread)
+#endif
 
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
@@ -371,6 +508,7 @@ void ResumeAudioBuffer(AudioBuffer *buffer);
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume);
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch);
 void SetAudioBufferPan(AudioBuffer *buffer, float pan);
+void SetAudioBufferPriority(AudioBuffer *buffer, int priority);
 void TrackAudioBuffer(AudioBuffer *buffer);
 void UntrackAudioBuffer(AudioBuffer *buffer);
 
@@ -413,8 +551,8 @@ void InitAudioDevice(void)
         return;
     }
 
-    // Mixing happens on a separate thread which means we need to synchronize. I'm using a mutex here to make things simple, but may
-    // want to look at something a bit smarter later on to keep everything real-time, if that's necessary
+    // Mixing happens on a separate thread, program threads send commands to the mixer through a lock-free queue,
+    // this mutex only serializes the program threads pushing commands, mixer never waits on it
     if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
     {
         TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for mixing");
@@ -449,11 +587,18 @@ void CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
-        ma_mutex_uninit(&AUDIO.System.lock);
         ma_device_uninit(&AUDIO.System.device);
+        AUDIO.System.isReady = false;
+
+        // Mixer is not running anymore, pending commands are applied on this thread
+        ma_mutex_lock(&AUDIO.System.lock);
+        ApplyAudioCommands();
+        CollectAudioCommands();
+        ma_mutex_unlock(&AUDIO.System.lock);
+
+        ma_mutex_uninit(&AUDIO.System.lock);
         ma_context_uninit(&AUDIO.System.context);
 
-        AUDIO.System.isReady = false;
         RL_FREE(AUDIO.System.pcmBuffer);
         AUDIO.System.pcmBuffer = NULL;
         AUDIO.System.pcmBufferSize = 0;
@@ -483,6 +628,31 @@ float GetMasterVolume(void)
     return volume;
 }
 
+// Set maximum number of voices mixed (0 = unlimited)
+// NOTE: Exceeding voices with lower priority become virtual, their playback position keeps advancing
+void SetAudioVoiceLimit(int count)
+{
+    ma_atomic_store_32(&AUDIO.Voice.limit, (count > 0)? (ma_uint32)count : 0);
+}
+
+// Get number of voices mixed on last audio update
+int GetAudioVoiceCount(void)
+{
+    return (int)ma_atomic_load_32(&AUDIO.Voice.realCount);
+}
+
+// Get number of virtual voices on last audio update (playing but not mixed)
+int GetAudioVirtualVoiceCount(void)
+{
+    return (int)ma_atomic_load_32(&AUDIO.Voice.virtualCount);
+}
+
+// Get average time spent mixing one frame on last audio update (in nanoseconds)
+float GetAudioFrameMixTime(void)
+{
+    return ma_atomic_load_f32(&AUDIO.Voice.frameMixTime);
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Audio Buffer management
 //----------------------------------------------------------------------------------
@@ -541,99 +711,60 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
 }
 
 // Delete an audio buffer
+// NOTE: Buffer is removed from the mixer list and freed once the mixer is not using it
 void UnloadAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        UntrackAudioBuffer(buffer);
-        ma_data_converter_uninit(&buffer->converter, NULL);
-        RL_FREE(buffer->data);
-        RL_FREE(buffer);
-    }
+    if (buffer != NULL) PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_UNLOAD, .buffer = buffer, .value = 1.0f });
 }
 
-// Check if an audio buffer is playing from a program state without lock
+// Check if an audio buffer is playing from a program state
 bool IsAudioBufferPlaying(AudioBuffer *buffer)
 {
     bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = IsAudioBufferPlayingInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+
+    if (buffer != NULL) result = (ma_atomic_load_32(&buffer->playing) && !ma_atomic_load_32(&buffer->paused));
+
     return result;
 }
 
 // Play an audio buffer
 // NOTE: Buffer is restarted to the start
 // Use PauseAudioBuffer() and ResumeAudioBuffer() if the playback position should be maintained
+// WARNING: Playing state and cursor are set by the mixer, IsAudioBufferPlaying() reports it on next audio update
 void PlayAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->playing = true;
-        buffer->paused = false;
-        buffer->frameCursorPos = 0;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (buffer != NULL) PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PLAY, .buffer = buffer });
 }
 
-// Stop an audio buffer from a program state without lock
+// Stop an audio buffer
+// NOTE: Stop is always queued, a play command may still be pending on the mixer
 void StopAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    StopAudioBufferInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+    if (buffer != NULL) PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_STOP, .buffer = buffer });
 }
 
 // Pause an audio buffer
 void PauseAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->paused = true;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (buffer != NULL) ma_atomic_store_32(&buffer->paused, MA_TRUE);
 }
 
 // Resume an audio buffer
 void ResumeAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->paused = false;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (buffer != NULL) ma_atomic_store_32(&buffer->paused, MA_FALSE);
 }
 
 // Set volume for an audio buffer
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume)
 {
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->volume = volume;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (buffer != NULL) PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_VOLUME, .buffer = buffer, .value = volume });
 }
 
 // Set pitch for an audio buffer
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
 {
-    if ((buffer != NULL) && (pitch > 0.0f))
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        // Pitching is just an adjustment of the sample rate
-        // Note that this changes the duration of the sound:
-        //  - higher pitches will make the sound faster
-        //  - lower pitches make it slower
-        ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/pitch);
-        ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
-
-        buffer->pitch = pitch;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if ((buffer != NULL) && (pitch > 0.0f)) PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PITCH, .buffer = buffer, .value = pitch });
 }
 
 // Set pan for an audio buffer
@@ -642,46 +773,27 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan)
     if (pan < 0.0f) pan = 0.0f;
     else if (pan > 1.0f) pan = 1.0f;
 
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->pan = pan;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (buffer != NULL) PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PAN, .buffer = buffer, .value = pan });
+}
+
+// Set voice priority for an audio buffer
+void SetAudioBufferPriority(AudioBuffer *buffer, int priority)
+{
+    if (buffer != NULL) PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PRIORITY, .buffer = buffer, .value = (float)priority });
 }
 
 // Track audio buffer to linked list next position
 void TrackAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
-        else
-        {
-            AUDIO.Buffer.last->next = buffer;
-            buffer->prev = AUDIO.Buffer.last;
-        }
-
-        AUDIO.Buffer.last = buffer;
-    }
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_TRACK, .buffer = buffer });
 }
 
 // Untrack audio buffer from linked list
+// NOTE: Waits for the mixer to release the buffer
 void UntrackAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
-        else buffer->prev->next = buffer->next;
-
-        if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
-        else buffer->next->prev = buffer->prev;
-
-        buffer->prev = NULL;
-        buffer->next = NULL;
-    }
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_UNTRACK, .buffer = buffer });
+    SyncAudioCommands();
 }
 
 //----------------------------------------------------------------------------------
@@ -693,6 +805,7 @@ Wave LoadWave(const char *fileName)
 {
     Wave wave = { 0 };
 
+#if defined(RAUDIO_STANDALONE)
     // Loading file to memory
     int dataSize = 0;
     unsigned char *fileData = LoadFileData(fileName, &dataSize);
@@ -701,6 +814,17 @@ Wave LoadWave(const char *fileName)
     if (fileData != NULL) wave = LoadWaveFromMemory(GetFileExtension(fileName), fileData, dataSize);
 
     UnloadFileData(fileData);
+#else
+    // Loading wave straight from file view (memory mapped when supported), PCM data is copied once
+    FileView fileView = LoadFileView(fileName);
+
+    if ((fileView.data != NULL) && (fileView.size <= 2147483647))
+    {
+        wave = LoadWaveFromMemory(GetFileExtension(fileName), fileView.data, (int)fileView.size);
+    }
+
+    UnloadFileView(fileView);
+#endif
 
     return wave;
 }
@@ -842,6 +966,53 @@ Sound LoadSound(const char *fileName)
     return sound;
 }
 
+#if !defined(RAUDIO_STANDALONE)
+// Load sound from file asynchronously, returns async load handle (0 on failure)
+// NOTE: File is loaded and decoded on loading thread, sound buffer is created on main thread (EndDrawing())
+unsigned int LoadSoundAsync(const char *fileName, AsyncLoadCallback callback, void *userData)
+{
+    unsigned int handle = 0;
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    if (fileName == NULL) return 0;
+
+    SoundAsyncLoad *load = (SoundAsyncLoad *)RL_CALLOC(1, sizeof(SoundAsyncLoad) + strlen(fileName) + 1);
+    load->fileName = (char *)(load + 1);
+    strcpy(load->fileName, fileName);
+
+    handle = QueueAsyncLoad(ASYNC_ASSET_SOUND, load, LoadSoundAsyncData, UploadSoundAsyncData, UnloadSoundAsyncData, callback, userData);
+    if (handle == 0) RL_FREE(load);
+#else
+    (void)callback;
+    (void)userData;
+    TRACELOG(LOG_WARNING, "SOUND: [%s] Async loading not supported", fileName);
+#endif
+
+    return handle;
+}
+
+// Get sound loaded asynchronously, handle is released
+// NOTE: An empty sound is returned if load is not ready (or failed)
+Sound GetAsyncSound(unsigned int handle)
+{
+    Sound sound = { 0 };
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    SoundAsyncLoad *load = (SoundAsyncLoad *)TakeAsyncLoadResult(handle, ASYNC_ASSET_SOUND);
+
+    if (load != NULL)
+    {
+        sound = load->sound;
+        RL_FREE(load);
+    }
+#else
+    (void)handle;
+#endif
+
+    return sound;
+}
+#endif
+
 // Load sound from wave data
 // NOTE: Wave data must be unallocated manually
 Sound LoadSoundFromWave(Wave wave)
@@ -947,12 +1118,7 @@ void UnloadSound(Sound sound)
 void UnloadSoundAlias(Sound alias)
 {
     // Untrack and unload just the sound buffer, not the sample data, it is shared with the source for the alias
-    if (alias.stream.buffer != NULL)
-    {
-        UntrackAudioBuffer(alias.stream.buffer);
-        ma_data_converter_uninit(&alias.stream.buffer->converter, NULL);
-        RL_FREE(alias.stream.buffer);
-    }
+    if (alias.stream.buffer != NULL) PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_UNLOAD, .buffer = alias.stream.buffer, .value = 0.0f });
 }
 
 // Update sound buffer with new data
@@ -961,6 +1127,7 @@ void UpdateSound(Sound sound, const void *data, int frameCount)
     if (sound.stream.buffer != NULL)
     {
         StopAudioBuffer(sound.stream.buffer);
+        SyncAudioCommands();    // Make sure mixer is not reading buffer data
 
         memcpy(sound.stream.buffer->data, data, frameCount*ma_get_bytes_per_frame(sound.stream.buffer->converter.formatIn, sound.stream.buffer->converter.channelsIn));
     }
@@ -1143,6 +1310,12 @@ void SetSoundPan(Sound sound, float pan)
     SetAudioBufferPan(sound.stream.buffer, pan);
 }
 
+// Set priority for a sound (higher priority sounds keep being mixed when voices are limited)
+void SetSoundPriority(Sound sound, int priority)
+{
+    SetAudioBufferPriority(sound.stream.buffer, priority);
+}
+
 // Convert wave data to desired format
 void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
 {
@@ -1419,6 +1592,11 @@ Music LoadMusicStream(const char *fileName)
 #endif
     else TRACELOG(LOG_WARNING, "STREAM: [%s] File format not supported", fileName);
 
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    // Music decoded on a dedicated thread, UpdateMusicStream() decoding is used as fallback
+    if (musicLoaded) music.stream.buffer->decoder = LoadMusicDecoder(music);
+#endif
+
     if (!musicLoaded)
     {
         TRACELOG(LOG_WARNING, "FILEIO: [%s] Music file could not be opened", fileName);
@@ -1632,6 +1810,11 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
 #endif
     else TRACELOG(LOG_WARNING, "STREAM: Data format not supported");
 
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    // Music decoded on a dedicated thread, UpdateMusicStream() decoding is used as fallback
+    if (musicLoaded) music.stream.buffer->decoder = LoadMusicDecoder(music);
+#endif
+
     if (!musicLoaded)
     {
         TRACELOG(LOG_WARNING, "FILEIO: Music data could not be loaded");
@@ -1662,8 +1845,21 @@ bool IsMusicValid(Music music)
 // Unload music stream
 void UnloadMusicStream(Music music)
 {
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    rMusicDecoder *decoder = (music.stream.buffer != NULL)? music.stream.buffer->decoder : NULL;
+#endif
+
     UnloadAudioStream(music.stream);
 
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    // Decoder is unloaded once mixer released the stream, before closing music context
+    if (decoder != NULL)
+    {
+        SyncAudioCommands();
+        UnloadMusicDecoder(decoder);
+    }
+#endif
+
     if (music.ctxData != NULL)
     {
         if (false) { }
@@ -1694,6 +1890,19 @@ void UnloadMusicStream(Music music)
 // Start music playing (open stream) from beginning
 void PlayMusicStream(Music music)
 {
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->decoder != NULL))
+    {
+        rMusicDecoder *decoder = music.stream.buffer->decoder;
+
+        // Decoder resumes decoding in case music end was reached
+        ma_mutex_lock(&decoder->lock);
+        ma_atomic_store_32(&decoder->looping, music.looping);
+        ma_atomic_store_32(&decoder->ended, MA_FALSE);
+        ma_mutex_unlock(&decoder->lock);
+    }
+#endif
+
     PlayAudioStream(music.stream);
 }
 
@@ -1714,31 +1923,29 @@ void StopMusicStream(Music music)
 {
     StopAudioStream(music.stream);
 
-    switch (music.ctxType)
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->decoder != NULL))
     {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOA)
-        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_XM)
-        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MOD)
-        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
-#endif
-        default: break;
+        rMusicDecoder *decoder = music.stream.buffer->decoder;
+
+        // Mixer does not read decoder ring once stop is applied, ring restarts empty
+        SyncAudioCommands();
+
+        ma_mutex_lock(&decoder->lock);
+        RewindMusicContext(music);
+        ma_pcm_rb_reset(&decoder->ring);
+        decoder->framesDecoded = 0;
+        decoder->framesWritten = 0;
+        ma_atomic_store_32(&decoder->framesRead, 0);
+        ma_atomic_store_32(&decoder->discard, MA_FALSE);
+        ma_atomic_store_32(&decoder->ended, MA_FALSE);
+        ma_mutex_unlock(&decoder->lock);
+
+        return;
     }
+#endif
+
+    RewindMusicContext(music);
 }
 
 // Seek music to a certain position (in seconds)
@@ -1749,6 +1956,11 @@ void SeekMusicStream(Music music, float position)
 
     unsigned int positionInFrames = (unsigned int)(position*music.stream.sampleRate);
 
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    rMusicDecoder *decoder = (music.stream.buffer != NULL)? music.stream.buffer->decoder : NULL;
+    if (decoder != NULL) ma_mutex_lock(&decoder->lock);
+#endif
+
     switch (music.ctxType)
     {
 #if defined(SUPPORT_FILEFORMAT_WAV)
@@ -1776,9 +1988,19 @@ void SeekMusicStream(Music music, float position)
         default: break;
     }
 
-    ma_mutex_lock(&AUDIO.System.lock);
-    music.stream.buffer->framesProcessed = positionInFrames;
-    ma_mutex_unlock(&AUDIO.System.lock);
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    if (decoder != NULL)
+    {
+        // Frames decoded before seeking are skipped by mixer
+        decoder->framesDecoded = positionInFrames;
+        ma_atomic_store_32(&decoder->ended, MA_FALSE);
+        ma_atomic_store_32(&decoder->discardPos, decoder->framesWritten);
+        ma_atomic_store_32(&decoder->discard, MA_TRUE);
+        ma_mutex_unlock(&decoder->lock);
+    }
+#endif
+
+    ma_atomic_store_32(&music.stream.buffer->framesProcessed, positionInFrames);
 }
 
 // Update (re-fill) music buffers if data already processed
@@ -1786,8 +2008,17 @@ void UpdateMusicStream(Music music)
 {
     if (music.stream.buffer == NULL) return;
 
-    ma_mutex_lock(&AUDIO.System.lock);
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    // Music decoded on decoder thread, only looping state is updated
+    if (music.stream.buffer->decoder != NULL)
+    {
+        ma_atomic_store_32(&music.stream.buffer->decoder->looping, music.looping);
+        return;
+    }
+#endif
 
+    // NOTE: Decoding runs on the calling thread without blocking the mixer,
+    // sub-buffers are handed to the mixer through their processed state
     unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
 
     // On first call of this function we lazily pre-allocated a temp buffer to read audio files/memory data in
@@ -1804,142 +2035,30 @@ void UpdateMusicStream(Music music)
     // Check both sub-buffers to check if they require refilling
     for (int i = 0; i < 2; i++)
     {
-        if (!music.stream.buffer->isSubBufferProcessed[i]) continue; // No refilling required, move to next sub-buffer
+        if (!ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[i])) continue; // No refilling required, move to next sub-buffer
 
-        unsigned int framesLeft = music.frameCount - music.stream.buffer->framesProcessed;  // Frames left to be processed
+        unsigned int framesLeft = music.frameCount - ma_atomic_load_32(&music.stream.buffer->framesProcessed);  // Frames left to be processed
         unsigned int framesToStream = 0;                 // Total frames to be streamed
 
         if ((framesLeft >= subBufferSizeInFrames) || music.looping) framesToStream = subBufferSizeInFrames;
         else framesToStream = framesLeft;
 
-        int frameCountStillNeeded = framesToStream;
-        int frameCountReadTotal = 0;
-
-        switch (music.ctxType)
-        {
-        #if defined(SUPPORT_FILEFORMAT_WAV)
-            case MUSIC_AUDIO_WAV:
-            {
-                if (music.stream.sampleSize == 16)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-                else if (music.stream.sampleSize == 32)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_OGG)
-            case MUSIC_AUDIO_OGG:
-            {
-                while (true)
-                {
-                    int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MP3)
-            case MUSIC_AUDIO_MP3:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_QOA)
-            case MUSIC_AUDIO_QOA:
-            {
-                unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                frameCountReadTotal += frameCountRead;
-                /*
-                while (true)
-                {
-                    int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize),  frameCountStillNeeded);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else qoaplay_rewind((qoaplay_desc *)music.ctxData);
-                }
-                */
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_FLAC)
-            case MUSIC_AUDIO_FLAC:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drflac__seek_to_first_frame((drflac *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_XM)
-            case MUSIC_MODULE_XM:
-            {
-                // NOTE: Internally we consider 2 channels generation, so sampleCount/2
-                if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)AUDIO.System.pcmBuffer, framesToStream);
-                //jar_xm_reset((jar_xm_context_t *)music.ctxData);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MOD)
-            case MUSIC_MODULE_MOD:
-            {
-                // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
-                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream, 0);
-                //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
-
-            } break;
-        #endif
-            default: break;
-        }
+        DecodeMusicFrames(music, AUDIO.System.pcmBuffer, framesToStream);
 
-        UpdateAudioStreamInLockedState(music.stream, AUDIO.System.pcmBuffer, framesToStream);
+        UpdateAudioStream(music.stream, AUDIO.System.pcmBuffer, framesToStream);
 
-        music.stream.buffer->framesProcessed = music.stream.buffer->framesProcessed%music.frameCount;
+        ma_atomic_store_32(&music.stream.buffer->framesProcessed, ma_atomic_load_32(&music.stream.buffer->framesProcessed)%music.frameCount);
 
         if (framesLeft <= subBufferSizeInFrames)
         {
             if (!music.looping)
             {
-                ma_mutex_unlock(&AUDIO.System.lock);
                 // Streaming is ending, we filled latest frames from input
                 StopMusicStream(music);
                 return;
             }
         }
     }
-
-    ma_mutex_unlock(&AUDIO.System.lock);
 }
 
 // Check if any music is playing
@@ -1982,6 +2101,14 @@ float GetMusicTimePlayed(Music music)
     float secondsPlayed = 0.0f;
     if (music.stream.buffer != NULL)
     {
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+        if (music.stream.buffer->decoder != NULL)
+        {
+            // Frames played are counted by mixer as they are read from decoder ring
+            secondsPlayed = (float)(ma_atomic_load_32(&music.stream.buffer->framesProcessed)%music.frameCount)/music.stream.sampleRate;
+        }
+        else
+#endif
 #if defined(SUPPORT_FILEFORMAT_XM)
         if (music.ctxType == MUSIC_MODULE_XM)
         {
@@ -1993,17 +2120,16 @@ float GetMusicTimePlayed(Music music)
         else
 #endif
         {
-            ma_mutex_lock(&AUDIO.System.lock);
+            // NOTE: Mixer state is read without locking, played time is an approximation anyway
             //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
-            int framesProcessed = (int)music.stream.buffer->framesProcessed;
+            int framesProcessed = (int)ma_atomic_load_32(&music.stream.buffer->framesProcessed);
             int subBufferSize = (int)music.stream.buffer->sizeInFrames/2;
-            int framesInFirstBuffer = music.stream.buffer->isSubBufferProcessed[0]? 0 : subBufferSize;
-            int framesInSecondBuffer = music.stream.buffer->isSubBufferProcessed[1]? 0 : subBufferSize;
-            int framesSentToMix = music.stream.buffer->frameCursorPos%subBufferSize;
+            int framesInFirstBuffer = ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[0])? 0 : subBufferSize;
+            int framesInSecondBuffer = ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[1])? 0 : subBufferSize;
+            int framesSentToMix = ma_atomic_load_32(&music.stream.buffer->frameCursorPos)%subBufferSize;
             int framesPlayed = (framesProcessed - framesInFirstBuffer - framesInSecondBuffer + framesSentToMix)%(int)music.frameCount;
             if (framesPlayed < 0) framesPlayed += music.frameCount;
             secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
-            ma_mutex_unlock(&AUDIO.System.lock);
         }
     }
 
@@ -2062,22 +2188,67 @@ void UnloadAudioStream(AudioStream stream)
 // Update audio stream buffers with data
 // NOTE 1: Only updates one buffer of the stream source: dequeue -> update -> queue
 // NOTE 2: To dequeue a buffer it needs to be processed: IsAudioStreamProcessed()
+// NOTE 3: Processed sub-buffers are not read by the mixer, they are handed back once filled
 void UpdateAudioStream(AudioStream stream, const void *data, int frameCount)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    UpdateAudioStreamInLockedState(stream, data, frameCount);
-    ma_mutex_unlock(&AUDIO.System.lock);
-}
+    if (stream.buffer != NULL)
+    {
+        bool isSubBufferProcessed[2] = { ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[0]), ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[1]) };
 
-// Check if any audio stream buffers requires refill
-bool IsAudioStreamProcessed(AudioStream stream)
-{
-    if (stream.buffer == NULL) return false;
+        if (isSubBufferProcessed[0] || isSubBufferProcessed[1])
+        {
+            ma_uint32 subBufferToUpdate = 0;
 
-    bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1];
-    ma_mutex_unlock(&AUDIO.System.lock);
+            if (isSubBufferProcessed[0] && isSubBufferProcessed[1])
+            {
+                // Both buffers are available for updating
+                // Update the first one and make sure the cursor is moved back to the front
+                // NOTE: Mixer does not move the cursor while both sub-buffers are processed
+                subBufferToUpdate = 0;
+                ma_atomic_store_32(&stream.buffer->frameCursorPos, 0);
+            }
+            else
+            {
+                // Just update whichever sub-buffer is processed
+                subBufferToUpdate = (isSubBufferProcessed[0])? 0 : 1;
+            }
+
+            ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
+            unsigned char *subBuffer = stream.buffer->data + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
+
+            // Total frames processed in buffer is always the complete size, filled with 0 if required
+            ma_atomic_fetch_add_32(&stream.buffer->framesProcessed, subBufferSizeInFrames);
+
+            // Does this API expect a whole buffer to be updated in one go?
+            // Assuming so, but if not will need to change this logic
+            if (subBufferSizeInFrames >= (ma_uint32)frameCount)
+            {
+                ma_uint32 framesToWrite = (ma_uint32)frameCount;
+
+                ma_uint32 bytesToWrite = framesToWrite*stream.channels*(stream.sampleSize/8);
+                memcpy(subBuffer, data, bytesToWrite);
+
+                // Any leftover frames should be filled with zeros
+                ma_uint32 leftoverFrameCount = subBufferSizeInFrames - framesToWrite;
+
+                if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
+
+                // Hand sub-buffer back to the mixer once data is written
+                ma_atomic_store_32(&stream.buffer->isSubBufferProcessed[subBufferToUpdate], MA_FALSE);
+            }
+            else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
+        }
+        else TRACELOG(LOG_WARNING, "STREAM: Buffer not available for updating");
+    }
+}
+
+// Check if any audio stream buffers requires refill
+bool IsAudioStreamProcessed(AudioStream stream)
+{
+    if (stream.buffer == NULL) return false;
+
+    bool result = false;
+    result = ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[0]) || ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[1]);
     return result;
 }
 
@@ -2138,12 +2309,7 @@ void SetAudioStreamBufferSizeDefault(int size)
 // Audio thread callback to request new data
 void SetAudioStreamCallback(AudioStream stream, AudioCallback callback)
 {
-    if (stream.buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        stream.buffer->callback = callback;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (stream.buffer != NULL) PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_CALLBACK, .buffer = stream.buffer, .callback = callback });
 }
 
 // Add processor to audio stream. Contrary to buffers, the order of processors is important
@@ -2151,52 +2317,16 @@ void SetAudioStreamCallback(AudioStream stream, AudioCallback callback)
 // a given stream, we iterate through the list to find the end. That way we don't need a pointer to the last element
 void AttachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = stream.buffer->processor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else stream.buffer->processor = processor;
-
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_ATTACH_PROCESSOR, .buffer = stream.buffer, .processor = processor });
 }
 
 // Remove processor from audio stream
 void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
-    rAudioProcessor *processor = stream.buffer->processor;
-
-    while (processor)
-    {
-        rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
-
-        if (processor->process == process)
-        {
-            if (stream.buffer->processor == processor) stream.buffer->processor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
-
-            RL_FREE(processor);
-        }
-
-        processor = next;
-    }
-
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_DETACH_PROCESSOR, .buffer = stream.buffer, .callback = process });
 }
 
 // Add processor to audio pipeline. Order of processors is important
@@ -2204,52 +2334,16 @@ void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 // these two work on the already mixed output just before sending it to the sound hardware
 void AttachAudioMixedProcessor(AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = AUDIO.mixedProcessor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else AUDIO.mixedProcessor = processor;
-
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_ATTACH_PROCESSOR, .buffer = NULL, .processor = processor });
 }
 
 // Remove processor from audio pipeline
 void DetachAudioMixedProcessor(AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
-    rAudioProcessor *processor = AUDIO.mixedProcessor;
-
-    while (processor)
-    {
-        rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
-
-        if (processor->process == process)
-        {
-            if (AUDIO.mixedProcessor == processor) AUDIO.mixedProcessor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
-
-            RL_FREE(processor);
-        }
-
-        processor = next;
-    }
-
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_DETACH_PROCESSOR, .buffer = NULL, .callback = process });
 }
 
 
@@ -2275,16 +2369,22 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         return frameCount;
     }
 
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    // Using music decoder ring
+    if (audioBuffer->decoder != NULL) return ReadMusicDecoderFrames(audioBuffer, framesOut, frameCount);
+#endif
+
     ma_uint32 subBufferSizeInFrames = (audioBuffer->sizeInFrames > 1)? audioBuffer->sizeInFrames/2 : audioBuffer->sizeInFrames;
-    ma_uint32 currentSubBufferIndex = audioBuffer->frameCursorPos/subBufferSizeInFrames;
+    ma_uint32 frameCursorPos = ma_atomic_load_32(&audioBuffer->frameCursorPos);
+    ma_uint32 currentSubBufferIndex = frameCursorPos/subBufferSizeInFrames;
 
     if (currentSubBufferIndex > 1) return 0;
 
     // Another thread can update the processed state of buffers, so
     // we just take a copy here to try and avoid potential synchronization problems
     bool isSubBufferProcessed[2] = { 0 };
-    isSubBufferProcessed[0] = audioBuffer->isSubBufferProcessed[0];
-    isSubBufferProcessed[1] = audioBuffer->isSubBufferProcessed[1];
+    isSubBufferProcessed[0] = ma_atomic_load_32(&audioBuffer->isSubBufferProcessed[0]);
+    isSubBufferProcessed[1] = ma_atomic_load_32(&audioBuffer->isSubBufferProcessed[1]);
 
     ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
 
@@ -2311,25 +2411,27 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         ma_uint32 framesRemainingInOutputBuffer;
         if (audioBuffer->usage == AUDIO_BUFFER_USAGE_STATIC)
         {
-            framesRemainingInOutputBuffer = audioBuffer->sizeInFrames - audioBuffer->frameCursorPos;
+            framesRemainingInOutputBuffer = audioBuffer->sizeInFrames - frameCursorPos;
         }
         else
         {
             ma_uint32 firstFrameIndexOfThisSubBuffer = subBufferSizeInFrames*currentSubBufferIndex;
-            framesRemainingInOutputBuffer = subBufferSizeInFrames - (audioBuffer->frameCursorPos - firstFrameIndexOfThisSubBuffer);
+            framesRemainingInOutputBuffer = subBufferSizeInFrames - (frameCursorPos - firstFrameIndexOfThisSubBuffer);
         }
 
         ma_uint32 framesToRead = totalFramesRemaining;
         if (framesToRead > framesRemainingInOutputBuffer) framesToRead = framesRemainingInOutputBuffer;
 
-        memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), audioBuffer->data + (audioBuffer->frameCursorPos*frameSizeInBytes), framesToRead*frameSizeInBytes);
-        audioBuffer->frameCursorPos = (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames;
+        memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), audioBuffer->data + (frameCursorPos*frameSizeInBytes), framesToRead*frameSizeInBytes);
+        frameCursorPos = (frameCursorPos + framesToRead)%audioBuffer->sizeInFrames;
+        ma_atomic_store_32(&audioBuffer->frameCursorPos, frameCursorPos);
         framesRead += framesToRead;
 
         // If we've read to the end of the buffer, mark it as processed
         if (framesToRead == framesRemainingInOutputBuffer)
         {
-            audioBuffer->isSubBufferProcessed[currentSubBufferIndex] = true;
+            // NOTE: Sub-buffer is handed to the program for refilling, it is not accessed anymore
+            ma_atomic_store_32(&audioBuffer->isSubBufferProcessed[currentSubBufferIndex], MA_TRUE);
             isSubBufferProcessed[currentSubBufferIndex] = true;
 
             currentSubBufferIndex = (currentSubBufferIndex + 1)%2;
@@ -2337,7 +2439,7 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
             // We need to break from this loop if we're not looping
             if (!audioBuffer->looping)
             {
-                StopAudioBufferInLockedState(audioBuffer);
+                StopAudioBufferInMixer(audioBuffer);
                 break;
             }
         }
@@ -2365,7 +2467,7 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
     // should be defined by the output format of the data converter. We do this until frameCount frames have been output. The important
     // detail to remember here is that we never, ever attempt to read more input data than is required for the specified number of output
     // frames. This can be achieved with ma_data_converter_get_required_input_frame_count()
-    ma_uint8 inputBuffer[4096] = { 0 };
+    ma_uint8 inputBuffer[4096];         // NOTE: Not initialized, only frames read are converted
     ma_uint32 inputBufferFrameCap = sizeof(inputBuffer)/ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
 
     ma_uint32 totalOutputFramesProcessed = 0;
@@ -2411,17 +2513,51 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
 {
     (void)pDevice;
 
+    ma_timer mixTimer = { 0 };
+    ma_timer_init(&mixTimer);
+
     // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
     memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
 
-    // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
-    ma_mutex_lock(&AUDIO.System.lock);
+    // Apply program commands queued since last callback, mixer never blocks on program threads
+    ApplyAudioCommands();
     {
-        for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
+        ma_uint32 voiceLimit = ma_atomic_load_32(&AUDIO.Voice.limit);
+        ma_uint32 realCount = 0;
+        ma_uint32 virtualCount = 0;
+
+        // NOTE: Active voices are sorted by priority, higher priority voices take the available real voices
+        AudioBuffer *nextBuffer = NULL;
+        for (AudioBuffer *audioBuffer = AUDIO.Voice.first; audioBuffer != NULL; audioBuffer = nextBuffer)
         {
-            // Ignore stopped or paused sounds
-            if (!audioBuffer->playing || audioBuffer->paused) continue;
+            nextBuffer = audioBuffer->nextVoice;
+
+            // Stopped sounds leave the active voices, paused sounds are kept but ignored
+            if (!ma_atomic_load_32(&audioBuffer->playing))
+            {
+                RemoveAudioVoice(audioBuffer);
+                continue;
+            }
+            if (ma_atomic_load_32(&audioBuffer->paused)) continue;
+
+            // Inaudible voices and voices exceeding the limit become virtual, only their cursor advances
+            // NOTE: Streams, callbacks and processors require data to be consumed, they are always mixed
+            if (IsAudioBufferVirtualizable(audioBuffer) &&
+                ((audioBuffer->volume < AUDIO_VOICE_MIN_VOLUME) || ((voiceLimit > 0) && (realCount >= voiceLimit))))
+            {
+                AdvanceAudioBufferVirtual(audioBuffer, frameCount);
+                virtualCount++;
+                continue;
+            }
+
+            realCount++;
+
+            // Fast path: sound data already in device format, mixed with no temporary copies
+            if (IsAudioBufferDirectMix(audioBuffer))
+            {
+                MixAudioBufferDirect(audioBuffer, (float *)pFramesOut, frameCount);
+                continue;
+            }
 
             ma_uint32 framesRead = 0;
 
@@ -2434,7 +2570,7 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
 
                 while (framesToRead > 0)
                 {
-                    float tempBuffer[1024] = { 0 }; // Frames for stereo
+                    float tempBuffer[1024];     // Frames for stereo, only frames read are mixed
 
                     ma_uint32 framesToReadRightNow = framesToRead;
                     if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
@@ -2462,7 +2598,7 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
                         framesRead += framesJustRead;
                     }
 
-                    if (!audioBuffer->playing)
+                    if (!ma_atomic_load_32(&audioBuffer->playing))
                     {
                         framesRead = frameCount;
                         break;
@@ -2473,14 +2609,14 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
                     {
                         if (!audioBuffer->looping)
                         {
-                            StopAudioBufferInLockedState(audioBuffer);
+                            StopAudioBufferInMixer(audioBuffer);
                             break;
                         }
                         else
                         {
                             // Should never get here, but just for safety,
                             // move the cursor position back to the start and continue the loop
-                            audioBuffer->frameCursorPos = 0;
+                            ma_atomic_store_32(&audioBuffer->frameCursorPos, 0);
                             continue;
                         }
                     }
@@ -2491,6 +2627,9 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
                 if (framesToRead > 0) break;
             }
         }
+
+        ma_atomic_store_32(&AUDIO.Voice.realCount, realCount);
+        ma_atomic_store_32(&AUDIO.Voice.virtualCount, virtualCount);
     }
 
     rAudioProcessor *processor = AUDIO.mixedProcessor;
@@ -2500,7 +2639,7 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
         processor = processor->next;
     }
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    if (frameCount > 0) ma_atomic_store_f32(&AUDIO.Voice.frameMixTime, (float)(ma_timer_get_time_in_seconds(&mixTimer)*1000000000.0/frameCount));
 }
 
 // Main mixing function, pretty simple in this project, just an accumulation
@@ -2518,112 +2657,737 @@ static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 fr
         // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
         const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
 
-        float *frameOut = framesOut;
-        const float *frameIn = framesIn;
+        MixAudioSamples(framesOut, framesIn, frameCount*2, levels[0], levels[1]);
+    }
+    else  // We do not consider panning
+    {
+        // Output accumulates input multiplied by volume to provided output (usually 0)
+        MixAudioSamples(framesOut, framesIn, frameCount*channels, localVolume, localVolume);
+    }
+}
+
+// Accumulate samples scaled by alternating levels: even samples by levelEven, odd samples by levelOdd
+// NOTE: On interleaved stereo data even samples are left channel and odd samples are right channel
+static void MixAudioSamples(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float levelEven, float levelOdd)
+{
+    ma_uint32 i = 0;
 
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
+#if defined(AUDIO_MIX_SSE)
+    const __m128 levels = _mm_setr_ps(levelEven, levelOdd, levelEven, levelOdd);
 
-            frameOut += 2;
-            frameIn += 2;
-        }
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        __m128 out0 = _mm_add_ps(_mm_loadu_ps(samplesOut + i), _mm_mul_ps(_mm_loadu_ps(samplesIn + i), levels));
+        __m128 out1 = _mm_add_ps(_mm_loadu_ps(samplesOut + i + 4), _mm_mul_ps(_mm_loadu_ps(samplesIn + i + 4), levels));
+        _mm_storeu_ps(samplesOut + i, out0);
+        _mm_storeu_ps(samplesOut + i + 4, out1);
     }
-    else  // We do not consider panning
+#elif defined(AUDIO_MIX_NEON)
+    const float levelsData[4] = { levelEven, levelOdd, levelEven, levelOdd };
+    const float32x4_t levels = vld1q_f32(levelsData);
+
+    for (; (i + 8) <= sampleCount; i += 8)
     {
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            for (ma_uint32 c = 0; c < channels; c++)
-            {
-                float *frameOut = framesOut + (frame*channels);
-                const float *frameIn = framesIn + (frame*channels);
+        float32x4_t out0 = vmlaq_f32(vld1q_f32(samplesOut + i), vld1q_f32(samplesIn + i), levels);
+        float32x4_t out1 = vmlaq_f32(vld1q_f32(samplesOut + i + 4), vld1q_f32(samplesIn + i + 4), levels);
+        vst1q_f32(samplesOut + i, out0);
+        vst1q_f32(samplesOut + i + 4, out1);
+    }
+#endif
 
-                // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
-            }
-        }
+    // Remaining samples (all samples on scalar path), i is even at this point
+    for (; (i + 2) <= sampleCount; i += 2)
+    {
+        samplesOut[i] += samplesIn[i]*levelEven;
+        samplesOut[i + 1] += samplesIn[i + 1]*levelOdd;
     }
+
+    if (i < sampleCount) samplesOut[i] += samplesIn[i]*levelEven;
 }
 
-// Check if an audio buffer is playing, assuming the audio system mutex has been locked
-static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer)
+// Check if audio buffer data can be mixed directly (no conversion nor processing)
+// NOTE: Sounds are converted to device format on loading, only pitch changes require the converter
+static bool IsAudioBufferDirectMix(AudioBuffer *buffer)
 {
-    bool result = false;
+    return ((buffer->usage == AUDIO_BUFFER_USAGE_STATIC) &&
+            (buffer->callback == NULL) && (buffer->processor == NULL) &&
+            (buffer->data != NULL) && (buffer->sizeInFrames > 0) && (buffer->pitch == 1.0f) &&
+            (buffer->converter.formatIn == ma_format_f32) &&
+            (buffer->converter.channelsIn == AUDIO.System.device.playback.channels) &&
+            (buffer->converter.sampleRateIn == buffer->converter.sampleRateOut));
+}
 
-    if (buffer != NULL) result = (buffer->playing && !buffer->paused);
+// Mix audio buffer data directly into output, returns frames mixed
+// NOTE: Same cursor behaviour as ReadAudioBufferFramesInInternalFormat() for static buffers
+static ma_uint32 MixAudioBufferDirect(AudioBuffer *buffer, float *framesOut, ma_uint32 frameCount)
+{
+    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+    ma_uint32 frameCursorPos = ma_atomic_load_32(&buffer->frameCursorPos);
+    ma_uint32 framesMixed = 0;
 
-    return result;
+    if (frameCursorPos >= buffer->sizeInFrames) frameCursorPos = 0;
+
+    while (framesMixed < frameCount)
+    {
+        ma_uint32 framesToMix = frameCount - framesMixed;
+        ma_uint32 framesRemaining = buffer->sizeInFrames - frameCursorPos;
+        if (framesToMix > framesRemaining) framesToMix = framesRemaining;
+
+        MixAudioFrames(framesOut + framesMixed*channels, (const float *)buffer->data + frameCursorPos*channels, framesToMix, buffer);
+
+        frameCursorPos = (frameCursorPos + framesToMix)%buffer->sizeInFrames;
+        framesMixed += framesToMix;
+        ma_atomic_store_32(&buffer->frameCursorPos, frameCursorPos);
+
+        // End of sound reached, stop unless looping
+        if ((framesToMix == framesRemaining) && !buffer->looping)
+        {
+            StopAudioBufferInMixer(buffer);
+            break;
+        }
+    }
+
+    return framesMixed;
 }
 
-// Stop an audio buffer, assuming the audio system mutex has been locked
-static void StopAudioBufferInLockedState(AudioBuffer *buffer)
+// Stop an audio buffer, from the mixer
+static void StopAudioBufferInMixer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
-        if (IsAudioBufferPlayingInLockedState(buffer))
+        ma_atomic_store_32(&buffer->playing, MA_FALSE);
+        ma_atomic_store_32(&buffer->paused, MA_FALSE);
+        ma_atomic_store_32(&buffer->frameCursorPos, 0);
+        ma_atomic_store_32(&buffer->framesProcessed, 0);
+        ma_atomic_store_32(&buffer->isSubBufferProcessed[0], MA_TRUE);
+        ma_atomic_store_32(&buffer->isSubBufferProcessed[1], MA_TRUE);
+    }
+}
+
+// Insert audio buffer into active voices list, after higher priority voices
+// NOTE: Voice is placed first among same priority voices, most recently played voices are kept mixed
+static void InsertAudioVoice(AudioBuffer *buffer)
+{
+    AudioBuffer *prev = NULL;
+    AudioBuffer *next = AUDIO.Voice.first;
+
+    while ((next != NULL) && (next->priority > buffer->priority))
+    {
+        prev = next;
+        next = next->nextVoice;
+    }
+
+    buffer->prevVoice = prev;
+    buffer->nextVoice = next;
+
+    if (prev == NULL) AUDIO.Voice.first = buffer;
+    else prev->nextVoice = buffer;
+
+    if (next != NULL) next->prevVoice = buffer;
+
+    buffer->isVoice = true;
+}
+
+// Remove audio buffer from active voices list
+static void RemoveAudioVoice(AudioBuffer *buffer)
+{
+    if (!buffer->isVoice) return;
+
+    if (buffer->prevVoice == NULL) AUDIO.Voice.first = buffer->nextVoice;
+    else buffer->prevVoice->nextVoice = buffer->nextVoice;
+
+    if (buffer->nextVoice != NULL) buffer->nextVoice->prevVoice = buffer->prevVoice;
+
+    buffer->prevVoice = NULL;
+    buffer->nextVoice = NULL;
+    buffer->isVoice = false;
+}
+
+// Check if audio buffer can be virtual (static data, no callback nor processing)
+static bool IsAudioBufferVirtualizable(AudioBuffer *buffer)
+{
+    return ((buffer->usage == AUDIO_BUFFER_USAGE_STATIC) &&
+            (buffer->callback == NULL) &&
+            (buffer->processor == NULL) &&
+            (buffer->data != NULL) &&
+            (buffer->sizeInFrames > 0));
+}
+
+// Advance audio buffer cursor without reading nor mixing
+// NOTE: Frames consumed from buffer data follow the resampler current rate, pitch included,
+// converter rate fields keep the initial rates because ma_data_converter_set_rate() only updates the resampler
+static void AdvanceAudioBufferVirtual(AudioBuffer *buffer, ma_uint32 frameCount)
+{
+    ma_uint32 sampleRateIn = buffer->converter.hasResampler? buffer->converter.resampler.sampleRateIn : buffer->converter.sampleRateIn;
+    ma_uint32 sampleRateOut = buffer->converter.hasResampler? buffer->converter.resampler.sampleRateOut : buffer->converter.sampleRateOut;
+
+    ma_uint32 frameCursorPos = ma_atomic_load_32(&buffer->frameCursorPos);
+    ma_uint64 framesToAdvance = (ma_uint64)frameCount*sampleRateIn/sampleRateOut;
+    ma_uint64 framesRemaining = buffer->sizeInFrames - frameCursorPos;
+
+    // End of sound reached, stop unless looping
+    if ((framesToAdvance >= framesRemaining) && !buffer->looping) StopAudioBufferInMixer(buffer);
+    else ma_atomic_store_32(&buffer->frameCursorPos, (ma_uint32)((frameCursorPos + framesToAdvance)%buffer->sizeInFrames));
+}
+
+// Push command to mixer (program thread)
+// NOTE: Program threads are serialized by AUDIO.System.lock, mixer consumes commands without locking,
+// if mixer is not running (device not ready) commands are applied on the calling thread
+static void PushAudioCommand(AudioCommand command)
+{
+    ma_mutex_lock(&AUDIO.System.lock);
+
+    CollectAudioCommands();
+
+    // Wait for mixer to free some space in case queue is full
+    // NOTE: Queue entries are reused once applied and collected
+    while ((AUDIO.Command.head - AUDIO.Command.collected) >= MAX_AUDIO_COMMANDS)
+    {
+        if (!AUDIO.System.isReady || !ma_device_is_started(&AUDIO.System.device)) ApplyAudioCommands();
+        else ma_sleep(1);
+
+        CollectAudioCommands();
+    }
+
+    AUDIO.Command.queue[AUDIO.Command.head%MAX_AUDIO_COMMANDS] = command;
+    ma_atomic_store_32(&AUDIO.Command.head, AUDIO.Command.head + 1);    // Publish command to mixer
+
+    if (!AUDIO.System.isReady)
+    {
+        ApplyAudioCommands();
+        CollectAudioCommands();
+    }
+
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Wait for all pushed commands to be applied by mixer (program thread)
+// NOTE: Mixer applies pending commands at the start of every audio callback
+static void SyncAudioCommands(void)
+{
+    ma_mutex_lock(&AUDIO.System.lock);
+
+    while (ma_atomic_load_32(&AUDIO.Command.tail) != AUDIO.Command.head)
+    {
+        if (!AUDIO.System.isReady || !ma_device_is_started(&AUDIO.System.device)) ApplyAudioCommands();
+        else ma_sleep(1);
+    }
+
+    CollectAudioCommands();
+
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Apply pending commands (mixer)
+// NOTE: Mixer owns buffers list and processors lists, they are only modified here
+static void ApplyAudioCommands(void)
+{
+    ma_uint32 head = ma_atomic_load_32(&AUDIO.Command.head);
+    ma_uint32 tail = AUDIO.Command.tail;
+
+    while (tail != head)
+    {
+        AudioCommand *command = &AUDIO.Command.queue[tail%MAX_AUDIO_COMMANDS];
+        AudioBuffer *buffer = command->buffer;
+
+        switch (command->type)
         {
-            buffer->playing = false;
-            buffer->paused = false;
-            buffer->frameCursorPos = 0;
-            buffer->framesProcessed = 0;
-            buffer->isSubBufferProcessed[0] = true;
-            buffer->isSubBufferProcessed[1] = true;
+            case AUDIO_COMMAND_TRACK:
+            {
+                if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
+                else
+                {
+                    AUDIO.Buffer.last->next = buffer;
+                    buffer->prev = AUDIO.Buffer.last;
+                }
+
+                AUDIO.Buffer.last = buffer;
+            } break;
+            case AUDIO_COMMAND_UNTRACK:
+            case AUDIO_COMMAND_UNLOAD:
+            {
+                RemoveAudioVoice(buffer);
+
+                if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
+                else buffer->prev->next = buffer->next;
+
+                if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
+                else buffer->next->prev = buffer->prev;
+
+                buffer->prev = NULL;
+                buffer->next = NULL;
+            } break;
+            case AUDIO_COMMAND_PLAY:
+            {
+                ma_atomic_store_32(&buffer->playing, MA_TRUE);
+                ma_atomic_store_32(&buffer->paused, MA_FALSE);
+                ma_atomic_store_32(&buffer->frameCursorPos, 0);
+
+                // Restarted voice is placed first among same priority voices
+                RemoveAudioVoice(buffer);
+                InsertAudioVoice(buffer);
+            } break;
+            case AUDIO_COMMAND_STOP: StopAudioBufferInMixer(buffer); break;
+            case AUDIO_COMMAND_VOLUME: buffer->volume = command->value; break;
+            case AUDIO_COMMAND_PITCH:
+            {
+                // Pitching is just an adjustment of the sample rate
+                // Note that this changes the duration of the sound:
+                //  - higher pitches will make the sound faster
+                //  - lower pitches make it slower
+                ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/command->value);
+                ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
+
+                buffer->pitch = command->value;
+            } break;
+            case AUDIO_COMMAND_PAN: buffer->pan = command->value; break;
+            case AUDIO_COMMAND_PRIORITY:
+            {
+                buffer->priority = (int)command->value;
+
+                // Keep active voices list sorted
+                if (buffer->isVoice)
+                {
+                    RemoveAudioVoice(buffer);
+                    InsertAudioVoice(buffer);
+                }
+            } break;
+            case AUDIO_COMMAND_CALLBACK: buffer->callback = command->callback; break;
+            case AUDIO_COMMAND_ATTACH_PROCESSOR:
+            {
+                // Processors order is important, new processor is added at the end
+                rAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+                rAudioProcessor *last = *first;
+
+                while (last && last->next) last = last->next;
+
+                if (last)
+                {
+                    command->processor->prev = last;
+                    last->next = command->processor;
+                }
+                else *first = command->processor;
+            } break;
+            case AUDIO_COMMAND_DETACH_PROCESSOR:
+            {
+                // Detached processors are kept on the command to be freed by the program thread
+                rAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+                rAudioProcessor *processor = *first;
+                command->processor = NULL;
+
+                while (processor)
+                {
+                    rAudioProcessor *next = processor->next;
+                    rAudioProcessor *prev = processor->prev;
+
+                    if (processor->process == command->callback)
+                    {
+                        if (*first == processor) *first = next;
+                        if (prev) prev->next = next;
+                        if (next) next->prev = prev;
+
+                        processor->prev = NULL;
+                        processor->next = command->processor;
+                        command->processor = processor;
+                    }
+
+                    processor = next;
+                }
+            } break;
+            default: break;
         }
+
+        tail++;
+        ma_atomic_store_32(&AUDIO.Command.tail, tail);  // Release command (and its results) to program thread
     }
 }
 
-// Update audio stream, assuming the audio system mutex has been locked
-static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount)
+// Free resources released by applied commands (program thread)
+// NOTE: Requires AUDIO.System.lock, applied commands queue entries are not reused before being collected
+static void CollectAudioCommands(void)
 {
-    if (stream.buffer != NULL)
+    ma_uint32 tail = ma_atomic_load_32(&AUDIO.Command.tail);
+
+    while (AUDIO.Command.collected != tail)
     {
-        if (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1])
+        AudioCommand *command = &AUDIO.Command.queue[AUDIO.Command.collected%MAX_AUDIO_COMMANDS];
+
+        if (command->type == AUDIO_COMMAND_UNLOAD)
         {
-            ma_uint32 subBufferToUpdate = 0;
+            // NOTE: Sound alias buffers share data with the source sound, data is not freed
+            ma_data_converter_uninit(&command->buffer->converter, NULL);
+            if (command->value != 0.0f) RL_FREE(command->buffer->data);
+            RL_FREE(command->buffer);
+        }
+        else if (command->type == AUDIO_COMMAND_DETACH_PROCESSOR)
+        {
+            rAudioProcessor *processor = command->processor;
 
-            if (stream.buffer->isSubBufferProcessed[0] && stream.buffer->isSubBufferProcessed[1])
+            while (processor)
             {
-                // Both buffers are available for updating
-                // Update the first one and make sure the cursor is moved back to the front
-                subBufferToUpdate = 0;
-                stream.buffer->frameCursorPos = 0;
+                rAudioProcessor *next = processor->next;
+                RL_FREE(processor);
+                processor = next;
             }
-            else
+        }
+
+        AUDIO.Command.collected++;
+    }
+}
+
+// Decode music frames in music stream format, looping to start if required
+static void DecodeMusicFrames(Music music, void *pcm, unsigned int framesToStream)
+{
+    int frameSize = music.stream.channels*music.stream.sampleSize/8;
+
+    int frameCountStillNeeded = framesToStream;
+    int frameCountReadTotal = 0;
+
+    switch (music.ctxType)
+    {
+    #if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV:
+        {
+            if (music.stream.sampleSize == 16)
             {
-                // Just update whichever sub-buffer is processed
-                subBufferToUpdate = (stream.buffer->isSubBufferProcessed[0])? 0 : 1;
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)pcm + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
             }
+            else if (music.stream.sampleSize == 32)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)pcm + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG:
+        {
+            while (true)
+            {
+                int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)pcm + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)pcm + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA:
+        {
+            unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)pcm, framesToStream);
+            frameCountReadTotal += frameCountRead;
+            /*
+            while (true)
+            {
+                int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)pcm + frameCountReadTotal*frameSize),  frameCountStillNeeded);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else qoaplay_rewind((qoaplay_desc *)music.ctxData);
+            }
+            */
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)pcm + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drflac__seek_to_first_frame((drflac *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM:
+        {
+            // NOTE: Internally we consider 2 channels generation, so sampleCount/2
+            if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)pcm, framesToStream);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)pcm, framesToStream);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)pcm, framesToStream);
+            //jar_xm_reset((jar_xm_context_t *)music.ctxData);
 
-            ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
-            unsigned char *subBuffer = stream.buffer->data + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD:
+        {
+            // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
+            jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)pcm, framesToStream, 0);
+            //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
 
-            // Total frames processed in buffer is always the complete size, filled with 0 if required
-            stream.buffer->framesProcessed += subBufferSizeInFrames;
+        } break;
+    #endif
+        default: break;
+    }
+}
 
-            // Does this API expect a whole buffer to be updated in one go?
-            // Assuming so, but if not will need to change this logic
-            if (subBufferSizeInFrames >= (ma_uint32)frameCount)
-            {
-                ma_uint32 framesToWrite = (ma_uint32)frameCount;
+// Rewind music context to the start
+static void RewindMusicContext(Music music)
+{
+    switch (music.ctxType)
+    {
+#if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
+#endif
+        default: break;
+    }
+}
 
-                ma_uint32 bytesToWrite = framesToWrite*stream.channels*(stream.sampleSize/8);
-                memcpy(subBuffer, data, bytesToWrite);
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+// Load music decoder and start decoder thread
+// NOTE: Decoder keeps several music stream sub-buffers decoded ahead of the mixer
+static rMusicDecoder *LoadMusicDecoder(Music music)
+{
+    rMusicDecoder *decoder = (rMusicDecoder *)RL_CALLOC(1, sizeof(rMusicDecoder));
 
-                // Any leftover frames should be filled with zeros
-                ma_uint32 leftoverFrameCount = subBufferSizeInFrames - framesToWrite;
+    if (decoder == NULL)
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Failed to allocate memory for music decoder");
+        return NULL;
+    }
 
-                if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
+    decoder->music = music;
+    decoder->looping = music.looping;
+    decoder->frameSize = music.stream.channels*music.stream.sampleSize/8;
+    decoder->chunkSizeInFrames = music.stream.buffer->sizeInFrames/2;
+    decoder->chunk = (unsigned char *)RL_CALLOC(decoder->chunkSizeInFrames, decoder->frameSize);
 
-                stream.buffer->isSubBufferProcessed[subBufferToUpdate] = false;
-            }
-            else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
-        }
-        else TRACELOG(LOG_WARNING, "STREAM: Buffer not available for updating");
+    // Ring free space is checked several times per chunk played
+    decoder->sleepTime = decoder->chunkSizeInFrames*1000/(music.stream.sampleRate*4);
+    if (decoder->sleepTime == 0) decoder->sleepTime = 1;
+
+    ma_result result = ma_pcm_rb_init(music.stream.buffer->converter.formatIn, music.stream.channels,
+        decoder->chunkSizeInFrames*MUSIC_DECODE_RING_SUBBUFFERS, NULL, NULL, &decoder->ring);
+
+    if ((result != MA_SUCCESS) || (decoder->chunk == NULL))
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Failed to allocate music decoder ring");
+        if (result == MA_SUCCESS) ma_pcm_rb_uninit(&decoder->ring);
+        RL_FREE(decoder->chunk);
+        RL_FREE(decoder);
+        return NULL;
+    }
+
+    ma_mutex_init(&decoder->lock);
+
+    if (ma_thread_create(&decoder->thread, ma_thread_priority_normal, 0, MusicDecoderThread, decoder, NULL) != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Failed to create music decoder thread");
+        ma_mutex_uninit(&decoder->lock);
+        ma_pcm_rb_uninit(&decoder->ring);
+        RL_FREE(decoder->chunk);
+        RL_FREE(decoder);
+        return NULL;
+    }
+
+    return decoder;
+}
+
+// Stop decoder thread and unload music decoder
+// NOTE: Mixer must not be reading from decoder ring anymore
+static void UnloadMusicDecoder(rMusicDecoder *decoder)
+{
+    ma_atomic_store_32(&decoder->quit, MA_TRUE);
+    ma_thread_wait(&decoder->thread);
+
+    ma_mutex_uninit(&decoder->lock);
+    ma_pcm_rb_uninit(&decoder->ring);
+    RL_FREE(decoder->chunk);
+    RL_FREE(decoder);
+}
+
+// Music decoder thread entry point
+static ma_thread_result MA_THREADCALL MusicDecoderThread(void *userData)
+{
+    rMusicDecoder *decoder = (rMusicDecoder *)userData;
+
+    while (!ma_atomic_load_32(&decoder->quit))
+    {
+        ma_mutex_lock(&decoder->lock);
+        bool decoded = DecodeMusicChunk(decoder);
+        ma_mutex_unlock(&decoder->lock);
+
+        // Ring is full or music end reached, wait for mixer to consume frames
+        if (!decoded) ma_sleep(decoder->sleepTime);
+    }
+
+    return (ma_thread_result)0;
+}
+
+// Decode one music chunk into ring, if space available
+// NOTE: Requires decoder lock
+static bool DecodeMusicChunk(rMusicDecoder *decoder)
+{
+    if (ma_atomic_load_32(&decoder->ended)) return false;
+    if (ma_pcm_rb_available_write(&decoder->ring) < decoder->chunkSizeInFrames) return false;
+
+    Music music = decoder->music;
+    bool looping = ma_atomic_load_32(&decoder->looping);
+
+    unsigned int framesLeft = music.frameCount - decoder->framesDecoded;
+    unsigned int framesToStream = ((framesLeft >= decoder->chunkSizeInFrames) || looping)? decoder->chunkSizeInFrames : framesLeft;
+
+    DecodeMusicFrames(music, decoder->chunk, framesToStream);
+
+    // Copy decoded chunk to ring, in two parts when wrapping around ring end
+    unsigned int framesCopied = 0;
+    while (framesCopied < framesToStream)
+    {
+        ma_uint32 framesToCopy = framesToStream - framesCopied;
+        void *ringData = NULL;
+
+        ma_pcm_rb_acquire_write(&decoder->ring, &framesToCopy, &ringData);
+        memcpy(ringData, decoder->chunk + framesCopied*decoder->frameSize, framesToCopy*decoder->frameSize);
+        ma_pcm_rb_commit_write(&decoder->ring, framesToCopy);   // Publish frames to mixer
+
+        framesCopied += framesToCopy;
+    }
+
+    decoder->framesWritten += framesToStream;
+    decoder->framesDecoded = (decoder->framesDecoded + framesToStream)%music.frameCount;
+
+    // Streaming is ending, mixer stops music once latest frames are played
+    if ((framesLeft <= decoder->chunkSizeInFrames) && !looping)
+    {
+        RewindMusicContext(music);
+        decoder->framesDecoded = 0;
+        ma_atomic_store_32(&decoder->ended, MA_TRUE);
+    }
+
+    return true;
+}
+
+// Read decoded frames from ring (mixer)
+// NOTE: Missing frames are filled with silence, music is stopped once decoder ended and ring is drained
+static ma_uint32 ReadMusicDecoderFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount)
+{
+    rMusicDecoder *decoder = audioBuffer->decoder;
+    ma_uint32 framesRead = ma_atomic_load_32(&decoder->framesRead);
+
+    // Frames decoded before a seek are skipped, they were already written to ring
+    if (ma_atomic_exchange_32(&decoder->discard, MA_FALSE))
+    {
+        ma_uint32 discardPos = ma_atomic_load_32(&decoder->discardPos);
+        ma_pcm_rb_seek_read(&decoder->ring, discardPos - framesRead);
+        framesRead = discardPos;
+    }
+
+    // NOTE: Ended state is checked before reading, no frames are written once ended
+    bool ended = ma_atomic_load_32(&decoder->ended);
+
+    ma_uint32 framesCopied = 0;
+    while (framesCopied < frameCount)
+    {
+        ma_uint32 framesToCopy = frameCount - framesCopied;
+        void *ringData = NULL;
+
+        ma_pcm_rb_acquire_read(&decoder->ring, &framesToCopy, &ringData);
+        if (framesToCopy == 0) break;
+
+        memcpy((unsigned char *)framesOut + framesCopied*decoder->frameSize, ringData, framesToCopy*decoder->frameSize);
+        ma_pcm_rb_commit_read(&decoder->ring, framesToCopy);    // Release frames to decoder
+
+        framesCopied += framesToCopy;
+    }
+
+    ma_atomic_store_32(&decoder->framesRead, framesRead + framesCopied);
+    ma_atomic_fetch_add_32(&audioBuffer->framesProcessed, framesCopied);
+
+    // Decoder not keeping up or music ended, remaining frames are silence
+    if (framesCopied < frameCount)
+    {
+        memset((unsigned char *)framesOut + framesCopied*decoder->frameSize, 0, (frameCount - framesCopied)*decoder->frameSize);
+        if (ended) StopAudioBufferInMixer(audioBuffer);
     }
+
+    return frameCount;
 }
+#endif
 
 // Some required functions for audio standalone module version
+#if defined(SUPPORT_ASYNC_LOADING) && !defined(RAUDIO_STANDALONE)
+// Load and decode sound wave (loading thread)
+static bool LoadSoundAsyncData(void *data)
+{
+    SoundAsyncLoad *load = (SoundAsyncLoad *)data;
+
+    load->wave = LoadWave(load->fileName);
+
+    return (load->wave.data != NULL);
+}
+
+// Load sound from wave (main thread)
+static bool UploadSoundAsyncData(void *data, AsyncUploads *uploads)
+{
+    SoundAsyncLoad *load = (SoundAsyncLoad *)data;
+    (void)uploads;
+
+    load->sound = LoadSoundFromWave(load->wave);
+    UnloadWave(load->wave);
+    load->wave = (Wave){ 0 };
+
+    return (load->sound.stream.buffer != NULL);
+}
+
+// Unload sound async load data not retrieved (main thread)
+static void UnloadSoundAsyncData(void *data, bool uploaded)
+{
+    SoundAsyncLoad *load = (SoundAsyncLoad *)data;
+
+    if (uploaded) UnloadSound(load->sound);
+    else UnloadWave(load->wave);
+}
+#endif
+
 #if defined(RAUDIO_STANDALONE)
 // Check file extension
 static bool IsFileExtension(const char *fileName, const char *ext)
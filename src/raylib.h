@@ -303,6 +303,15 @@ typedef struct NPatchInfo {
     int layout;             // Layout of the n-patch: 3x3, 1x3 or 3x1
 } NPatchInfo;
 
+// SpriteInstance, sprite drawing parameters for instanced drawing (same as DrawTexturePro())
+typedef struct SpriteInstance {
+    Rectangle dest;         // Destination rectangle
+    Vector2 origin;         // Rotation origin, relative to destination rectangle
+    float rotation;         // Rotation in degrees
+    Rectangle source;       // Source rectangle in texture (negative width/height flips)
+    Color tint;             // Tint color
+} SpriteInstance;
+
 // GlyphInfo, font characters glyphs info
 typedef struct GlyphInfo {
     int value;              // Character value (Unicode)
@@ -312,6 +321,10 @@ typedef struct GlyphInfo {
     Image image;            // Character image data
 } GlyphInfo;
 
+// Opaque structs declaration
+// NOTE: Actual structs are defined internally in rtext module
+typedef struct rGlyphTable rGlyphTable;
+
 // Font, font texture and GlyphInfo array data
 typedef struct Font {
     int baseSize;           // Base size (default chars height)
@@ -320,8 +333,18 @@ typedef struct Font {
     Texture2D texture;      // Texture atlas containing the glyphs
     Rectangle *recs;        // Rectangles in texture for the glyphs
     GlyphInfo *glyphs;      // Glyphs info data
+    rGlyphTable *glyphTable; // Codepoint to glyph index lookup table (built on font loading, optional)
 } Font;
 
+// TextLayout, text glyph quads positioned for drawing
+typedef struct TextLayout {
+    Texture2D texture;      // Font texture atlas containing the glyphs
+    int glyphCount;         // Number of glyph quads
+    float *vertices;        // Glyph quads vertex position, relative to text position (XY - 4 vertex per quad)
+    float *texcoords;       // Glyph quads vertex texture coordinates (UV - 4 vertex per quad)
+    Vector2 size;           // Text size, as measured by MeasureTextEx()
+} TextLayout;
+
 // Camera, defines position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -341,6 +364,10 @@ typedef struct Camera2D {
     float zoom;             // Camera zoom (scaling), should be 1.0f by default
 } Camera2D;
 
+// Opaque structs declaration
+// NOTE: Actual structs are defined internally in rmodels module
+typedef struct rMeshBVH rMeshBVH;
+
 // Mesh, vertex data and vao/vbo
 typedef struct Mesh {
     int vertexCount;        // Number of vertices stored in arrays
@@ -363,11 +390,20 @@ typedef struct Mesh {
     Matrix *boneMatrices;   // Bones animated transformation matrices
     int boneCount;          // Number of bones
 
+    // Collision data
+    rMeshBVH *bvh;          // Bounding volume hierarchy, accelerates ray collision queries (optional, GenMeshBVH())
+
     // OpenGL identifiers
     unsigned int vaoId;     // OpenGL Vertex Array Object id
     unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (default vertex data)
 } Mesh;
 
+// InstanceBuffer, persistent GPU buffer of instance transforms for instanced mesh drawing
+typedef struct InstanceBuffer {
+    unsigned int id;        // OpenGL Vertex Buffer Object id
+    int capacity;           // Number of instance transforms the buffer can store
+} InstanceBuffer;
+
 // Shader
 typedef struct Shader {
     unsigned int id;        // Shader program id
@@ -415,6 +451,7 @@ typedef struct Model {
     int boneCount;          // Number of bones
     BoneInfo *bones;        // Bones information (skeleton)
     Transform *bindPose;    // Bones base transformation (pose)
+    Transform *invBindPose; // Bones base transformation inverse (computed on loading)
 } Model;
 
 // ModelAnimation
@@ -511,6 +548,13 @@ typedef struct VrStereoConfig {
     float scaleIn[2];               // VR distortion scale in
 } VrStereoConfig;
 
+// File view, read-only file data
+typedef struct FileView {
+    const unsigned char *data;      // File data (read-only), memory mapped when supported
+    long long size;                 // File data size in bytes
+    bool mapped;                    // File data is memory mapped
+} FileView;
+
 // File path list
 typedef struct FilePathList {
     unsigned int capacity;          // Filepaths max entries
@@ -877,6 +921,12 @@ typedef enum {
     TEXTURE_WRAP_MIRROR_CLAMP               // Mirrors and clamps to border the texture in tiled mode
 } TextureWrap;
 
+// Mipmap generation filter
+typedef enum {
+    MIPMAP_FILTER_BOX = 0,                  // Box filter, average of 2x2 pixels
+    MIPMAP_FILTER_KAISER                    // Kaiser windowed sinc filter, sharper levels
+} MipmapFilter;
+
 // Cubemap layouts
 typedef enum {
     CUBEMAP_LAYOUT_AUTO_DETECT = 0,         // Automatically detect layout type
@@ -943,6 +993,14 @@ typedef enum {
     NPATCH_THREE_PATCH_HORIZONTAL   // Npatch layout: 3x1 tiles
 } NPatchLayout;
 
+// Async load state
+typedef enum {
+    ASYNC_LOAD_NONE = 0,            // Async load handle not valid (or result already retrieved)
+    ASYNC_LOAD_PENDING,             // Async load in progress (file loading, decoding or waiting for upload)
+    ASYNC_LOAD_READY,               // Async load finished, result can be retrieved
+    ASYNC_LOAD_FAILED               // Async load failed
+} AsyncLoadState;
+
 // Callbacks to hook some internal functions
 // WARNING: These callbacks are intended for advanced users
 typedef void (*TraceLogCallback)(int logLevel, const char *text, va_list args);  // Logging: Redirect trace log messages
@@ -950,6 +1008,7 @@ typedef unsigned char *(*LoadFileDataCallback)(const char *fileName, int *dataSi
 typedef bool (*SaveFileDataCallback)(const char *fileName, void *data, int dataSize);   // FileIO: Save binary data
 typedef char *(*LoadFileTextCallback)(const char *fileName);            // FileIO: Load text data
 typedef bool (*SaveFileTextCallback)(const char *fileName, char *text); // FileIO: Save text data
+typedef void (*AsyncLoadCallback)(unsigned int handle, bool success, void *userData);  // AsyncLoad: Load finished (called on main thread)
 
 //------------------------------------------------------------------------------------
 // Global Variables Definition
@@ -1102,6 +1161,7 @@ RLAPI void SetTraceLogLevel(int logLevel);                        // Set the cur
 RLAPI void *MemAlloc(unsigned int size);                          // Internal memory allocator
 RLAPI void *MemRealloc(void *ptr, unsigned int size);             // Internal memory reallocator
 RLAPI void MemFree(void *ptr);                                    // Internal memory free
+RLAPI void SetJobWorkerCount(int count);                          // Set job system worker threads count (0 runs all jobs on calling thread)
 
 // Set custom callbacks
 // WARNING: Callbacks setup is intended for advanced users
@@ -1114,11 +1174,26 @@ RLAPI void SetSaveFileTextCallback(SaveFileTextCallback callback); // Set custom
 // Files management functions
 RLAPI unsigned char *LoadFileData(const char *fileName, int *dataSize); // Load file data as byte array (read)
 RLAPI void UnloadFileData(unsigned char *data);                   // Unload file data allocated by LoadFileData()
+RLAPI FileView LoadFileView(const char *fileName);                // Load read-only file data view, memory mapped when supported (no 2GB size limit)
+RLAPI void UnloadFileView(FileView view);                         // Unload file data view
 RLAPI bool SaveFileData(const char *fileName, void *data, int dataSize); // Save data to file from byte array (write), returns true on success
 RLAPI bool ExportDataAsCode(const unsigned char *data, int dataSize, const char *fileName); // Export data to code (.h), returns true on success
 RLAPI char *LoadFileText(const char *fileName);                   // Load text data from file (read), returns a '\0' terminated string
 RLAPI void UnloadFileText(char *text);                            // Unload file text data allocated by LoadFileText()
 RLAPI bool SaveFileText(const char *fileName, char *text);        // Save text data to file (write), string must be '\0' terminated, returns true on success
+
+// Asset packs management functions
+RLAPI bool MountAssetPack(const char *fileName, const char *mountPath); // Mount asset pack (.rpak), packed files are loaded as files in mountPath
+RLAPI void UnmountAssetPacks(void);                               // Unmount all asset packs
+RLAPI bool ExportAssetPack(const char *fileName, const char *basePath, bool compress); // Export asset pack from all files in base path (recursive), returns true on success
+
+// Async loading management functions
+// NOTE: Assets are loaded and decoded on a loading thread, GPU uploads are processed on main thread by EndDrawing()
+RLAPI void SetAsyncUploadBudget(float milliseconds);              // Set per-frame time budget for async loads GPU uploads (at least one upload per frame)
+RLAPI void UpdateAsyncLoading(void);                              // Process async loads waiting for upload, within budget (called by EndDrawing())
+RLAPI int GetAsyncLoadState(unsigned int handle);                 // Get async load state (AsyncLoadState)
+RLAPI void WaitAsyncLoad(unsigned int handle);                    // Wait for async load to finish (blocking, uploads are processed)
+RLAPI void CancelAsyncLoad(unsigned int handle);                  // Cancel async load, loaded data (not retrieved) is unloaded
 //------------------------------------------------------------------
 
 // File system functions
@@ -1362,6 +1437,8 @@ RLAPI void ImageResize(Image *image, int newWidth, int newHeight);
 RLAPI void ImageResizeNN(Image *image, int newWidth,int newHeight);                                      // Resize image (Nearest-Neighbor scaling algorithm)
 RLAPI void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill); // Resize canvas and fill with color
 RLAPI void ImageMipmaps(Image *image);                                                                   // Compute all mipmap levels for a provided image
+RLAPI void ImageMipmapsEx(Image *image, int filter, bool srgb);                                          // Compute all mipmap levels in place with a filter (8 bit per channel formats)
+RLAPI void ImageMipmapsRec(Image *image, Rectangle rec, int filter, bool srgb);                          // Regenerate mipmap levels regions affected by a base level rectangle
 RLAPI void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp);                            // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
 RLAPI void ImageFlipVertical(Image *image);                                                              // Flip image vertically
 RLAPI void ImageFlipHorizontal(Image *image);                                                            // Flip image horizontally
@@ -1409,6 +1486,8 @@ RLAPI void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 posi
 // Texture loading functions
 // NOTE: These functions require GPU access
 RLAPI Texture2D LoadTexture(const char *fileName);                                                       // Load texture from file into GPU memory (VRAM)
+RLAPI unsigned int LoadTextureAsync(const char *fileName, AsyncLoadCallback callback, void *userData);  // Load texture from file asynchronously, returns async load handle
+RLAPI Texture2D GetAsyncTexture(unsigned int handle);                                                    // Get texture loaded asynchronously (handle is released)
 RLAPI Texture2D LoadTextureFromImage(Image image);                                                       // Load texture from image data
 RLAPI TextureCubemap LoadTextureCubemap(Image image, int layout);                                        // Load cubemap from image, multiple image cubemap layouts supported
 RLAPI RenderTexture2D LoadRenderTexture(int width, int height);                                          // Load texture for rendering (framebuffer)
@@ -1418,6 +1497,7 @@ RLAPI bool IsRenderTextureValid(RenderTexture2D target);
 RLAPI void UnloadRenderTexture(RenderTexture2D target);                                                  // Unload render texture from GPU memory (VRAM)
 RLAPI void UpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
 RLAPI void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels);                       // Update GPU texture rectangle with new data
+RLAPI void UpdateTextureMipmapsRec(Texture2D texture, Image *image, Rectangle rec, int filter, bool srgb); // Update GPU texture rectangle and affected mipmap levels regions from image
 
 // Texture configuration functions
 RLAPI void GenTextureMipmaps(Texture2D *texture);                                                        // Generate GPU mipmaps for a texture
@@ -1431,6 +1511,7 @@ RLAPI void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, fl
 RLAPI void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint);            // Draw a part of a texture defined by a rectangle
 RLAPI void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draw a part of a texture defined by a rectangle with 'pro' parameters
 RLAPI void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draws a texture (or part of it) that stretches or shrinks nicely
+RLAPI void DrawTextureInstanced(Texture2D texture, const SpriteInstance *sprites, int spriteCount); // Draw multiple sprites of a texture in one instanced draw call (GPU sprite expansion)
 
 // Color/pixel related functions
 RLAPI bool ColorIsEqual(Color col1, Color col2);                            // Check if two colors are equal
@@ -1459,6 +1540,9 @@ RLAPI int GetPixelDataSize(int width, int height, int format);              // G
 RLAPI Font GetFontDefault(void);                                                            // Get the default Font
 RLAPI Font LoadFont(const char *fileName);                                                  // Load font from file into GPU memory (VRAM)
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount); // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set, font size is provided in pixels height
+RLAPI Font LoadFontDynamic(const char *fileName, int fontSize);                              // Load font from file (TTF/OTF) with glyphs rasterized on first use into a fixed size atlas
+RLAPI unsigned int LoadFontAsync(const char *fileName, int fontSize, AsyncLoadCallback callback, void *userData); // Load font from file asynchronously (default character set), returns async load handle
+RLAPI Font GetAsyncFont(unsigned int handle);                                               // Get font loaded asynchronously (handle is released)
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
 RLAPI bool IsFontValid(Font font);                                                          // Check if a font is valid (font data loaded, WARNING: GPU texture not checked)
@@ -1476,6 +1560,11 @@ RLAPI void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 or
 RLAPI void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // Draw one character (codepoint)
 RLAPI void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint); // Draw multiple character (codepoint)
 
+// Text layout functions
+RLAPI TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing); // Load text layout, glyph quads positioned for drawing
+RLAPI void UnloadTextLayout(TextLayout layout);                                             // Unload text layout data
+RLAPI void DrawTextLayout(TextLayout layout, Vector2 position, Color tint);                 // Draw text layout, all glyph quads submitted at once
+
 // Text font info functions
 RLAPI void SetTextLineSpacing(int spacing);                                                 // Set vertical line spacing when drawing with line-breaks
 RLAPI int MeasureText(const char *text, int fontSize);                                      // Measure string width for default font
@@ -1550,6 +1639,8 @@ RLAPI void DrawGrid(int slices, float spacing);
 
 // Model management functions
 RLAPI Model LoadModel(const char *fileName);                                                // Load model from files (meshes and materials)
+RLAPI unsigned int LoadModelAsync(const char *fileName, AsyncLoadCallback callback, void *userData);  // Load model from files asynchronously, returns async load handle (OBJ loaded on main thread)
+RLAPI Model GetAsyncModel(unsigned int handle);                                             // Get model loaded asynchronously (handle is released)
 RLAPI Model LoadModelFromMesh(Mesh mesh);                                                   // Load model from generated mesh (default material)
 RLAPI bool IsModelValid(Model model);                                                       // Check if a model is valid (loaded in GPU, VAO/VBOs)
 RLAPI void UnloadModel(Model model);                                                        // Unload model (including meshes) from memory (RAM and/or VRAM)
@@ -1573,8 +1664,14 @@ RLAPI void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize
 RLAPI void UnloadMesh(Mesh mesh);                                                           // Unload mesh data from CPU and GPU
 RLAPI void DrawMesh(Mesh mesh, Material material, Matrix transform);                        // Draw a 3d mesh with material and transform
 RLAPI void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
+RLAPI InstanceBuffer LoadInstanceBuffer(int capacity);                                      // Load instance transforms buffer in GPU (VRAM)
+RLAPI void UpdateInstanceBuffer(InstanceBuffer *buffer, const Matrix *transforms, int offset, int count); // Update instance transforms range, buffer grows on updates from offset 0
+RLAPI void UpdateInstanceBufferData(InstanceBuffer *buffer, const float *data, int offset, int count); // Update instance transforms range with pre-packed data (16 floats per instance, column-major)
+RLAPI void UnloadInstanceBuffer(InstanceBuffer buffer);                                     // Unload instance transforms buffer from GPU (VRAM)
+RLAPI void DrawMeshInstancedBuffer(Mesh mesh, Material material, InstanceBuffer buffer, int instances); // Draw multiple mesh instances with material and transforms from instance buffer
 RLAPI BoundingBox GetMeshBoundingBox(Mesh mesh);                                            // Compute mesh bounding box limits
 RLAPI void GenMeshTangents(Mesh *mesh);                                                     // Compute mesh tangents
+RLAPI void GenMeshBVH(Mesh *mesh);                                                          // Compute mesh bounding volume hierarchy, accelerates ray collision queries
 RLAPI bool ExportMesh(Mesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
 RLAPI bool ExportMeshAsCode(Mesh mesh, const char *fileName);                               // Export mesh as code file (.h) defining multiple arrays of vertex attributes
 
@@ -1602,6 +1699,7 @@ RLAPI void SetModelMeshMaterial(Model *model, int meshId, int materialId);
 // Model animations loading/unloading functions
 RLAPI ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount);            // Load model animations from file
 RLAPI void UpdateModelAnimation(Model model, ModelAnimation anim, int frame);               // Update model animation pose (CPU)
+RLAPI void UpdateModelAnimationsBatch(Model *models, ModelAnimation *anims, int *frames, int count); // Update multiple models animation pose (CPU, multi-threaded)
 RLAPI void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame);          // Update model animation mesh bone matrices (GPU skinning)
 RLAPI void UnloadModelAnimation(ModelAnimation anim);                                       // Unload animation data
 RLAPI void UnloadModelAnimations(ModelAnimation *animations, int animCount);                // Unload animation array data
@@ -1614,6 +1712,7 @@ RLAPI bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius
 RLAPI RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius);                    // Get collision info between ray and sphere
 RLAPI RayCollision GetRayCollisionBox(Ray ray, BoundingBox box);                                    // Get collision info between ray and box
 RLAPI RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform);                       // Get collision info between ray and mesh
+RLAPI void GetRayCollisionMeshBatch(const Ray *rays, int rayCount, Mesh mesh, Matrix transform, RayCollision *collisions); // Get collision info between multiple rays and mesh
 RLAPI RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3);            // Get collision info between ray and triangle
 RLAPI RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4);    // Get collision info between ray and quad
 
@@ -1628,12 +1727,18 @@ RLAPI void CloseAudioDevice(void);                                    // Close t
 RLAPI bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
 RLAPI void SetMasterVolume(float volume);                             // Set master volume (listener)
 RLAPI float GetMasterVolume(void);                                    // Get master volume (listener)
+RLAPI void SetAudioVoiceLimit(int count);                             // Set maximum number of voices mixed, lower priority voices become virtual (0 = unlimited)
+RLAPI int GetAudioVoiceCount(void);                                   // Get number of voices mixed on last audio update
+RLAPI int GetAudioVirtualVoiceCount(void);                            // Get number of virtual voices on last audio update (playing but not mixed)
+RLAPI float GetAudioFrameMixTime(void);                               // Get average time spent mixing one frame on last audio update (in nanoseconds)
 
 // Wave/Sound loading/unloading functions
 RLAPI Wave LoadWave(const char *fileName);                            // Load wave data from file
 RLAPI Wave LoadWaveFromMemory(const char *fileType, const unsigned char *fileData, int dataSize); // Load wave from memory buffer, fileType refers to extension: i.e. '.wav'
 RLAPI bool IsWaveValid(Wave wave);                                    // Checks if wave data is valid (data loaded and parameters)
 RLAPI Sound LoadSound(const char *fileName);                          // Load sound from file
+RLAPI unsigned int LoadSoundAsync(const char *fileName, AsyncLoadCallback callback, void *userData); // Load sound from file asynchronously, returns async load handle
+RLAPI Sound GetAsyncSound(unsigned int handle);                       // Get sound loaded asynchronously (handle is released)
 RLAPI Sound LoadSoundFromWave(Wave wave);                             // Load sound from wave data
 RLAPI Sound LoadSoundAlias(Sound source);                             // Create a new sound that shares the same sample data as the source sound, does not own the sound data
 RLAPI bool IsSoundValid(Sound sound);                                 // Checks if a sound is valid (data loaded and buffers initialized)
@@ -1653,6 +1758,7 @@ RLAPI bool IsSoundPlaying(Sound sound);                               // Check i
 RLAPI void SetSoundVolume(Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 RLAPI void SetSoundPitch(Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
 RLAPI void SetSoundPan(Sound sound, float pan);                       // Set pan for a sound (0.5 is center)
+RLAPI void SetSoundPriority(Sound sound, int priority);               // Set priority for a sound (higher priority sounds keep being mixed when voices are limited)
 RLAPI Wave WaveCopy(Wave wave);                                       // Copy a wave to a new wave
 RLAPI void WaveCrop(Wave *wave, int initFrame, int finalFrame);       // Crop a wave to defined frames range
 RLAPI void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels); // Convert wave data to desired format
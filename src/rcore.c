@@ -107,6 +107,7 @@
 #include <stdlib.h>                 // Required for: srand(), rand(), atexit()
 #include <stdio.h>                  // Required for: sprintf() [Used in OpenURL()]
 #include <string.h>                 // Required for: strrchr(), strcmp(), strlen(), memset()
+#include <ctype.h>                  // Required for: tolower() [Used in IsFileExtension()]
 #include <time.h>                   // Required for: time() [Used in InitTimer()]
 #include <math.h>                   // Required for: tan() [Used in BeginMode3D()], atan2f() [Used in LoadVrStereoConfig()]
 
@@ -483,6 +484,10 @@ static bool automationEventRecording = false;               // Recording automat
 extern void LoadFontDefault(void);      // [Module: text] Loads default font on InitWindow()
 extern void UnloadFontDefault(void);    // [Module: text] Unloads default font from GPU memory
 #endif
+#if defined(SUPPORT_MODULE_RMODELS)
+extern void UnloadMeshInstancingData(void); // [Module: models] Unloads internal instancing buffers from GPU memory
+extern void UnloadModelAnimationsScratch(void); // [Module: models] Unloads internal skinning scratch memory
+#endif
 
 extern int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 extern void ClosePlatform(void);        // Close platform
@@ -733,12 +738,26 @@ void CloseWindow(void)
     }
 #endif
 
+#if defined(SUPPORT_ASYNC_LOADING)
+    CloseAsyncLoading();        // Stop async loading thread, loads not retrieved are unloaded
+#endif
+
 #if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
 
+#if defined(SUPPORT_MODULE_RMODELS)
+    UnloadMeshInstancingData(); // WARNING: Module required: rmodels
+#endif
+
     rlglClose();                // De-init rlgl
 
+    CloseJobSystem();           // Stop job system worker threads (if running)
+
+#if defined(SUPPORT_MODULE_RMODELS)
+    UnloadModelAnimationsScratch(); // WARNING: Module required: rmodels
+#endif
+
     // De-initialize platform
     //--------------------------------------------------------------
     ClosePlatform();
@@ -936,6 +955,10 @@ void EndDrawing(void)
     if (automationEventRecording) RecordAutomationEvent();    // Event recording
 #endif
 
+#if defined(SUPPORT_ASYNC_LOADING)
+    UpdateAsyncLoading();           // Upload async loaded assets, within per-frame upload budget
+#endif
+
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
     SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
 
@@ -1896,6 +1919,10 @@ bool FileExists(const char *fileName)
 {
     bool result = false;
 
+#if defined(SUPPORT_ASSET_PACK)
+    if (IsAssetPackFile(fileName, NULL)) return true;
+#endif
+
 #if defined(_WIN32)
     if (_access(fileName, 0) != -1) result = true;
 #else
@@ -1911,34 +1938,34 @@ bool FileExists(const char *fileName)
 }
 
 // Check file extension
-// NOTE: Extensions checking is not case-sensitive
+// NOTE: Extensions checking is not case-sensitive, multiple extensions can be provided separated by ';'
+// Extensions are compared in place (no static buffers), so it can be used from async loading thread
 bool IsFileExtension(const char *fileName, const char *ext)
 {
-    #define MAX_FILE_EXTENSION_LENGTH  16
-
     bool result = false;
     const char *fileExt = GetFileExtension(fileName);
 
-    if (fileExt != NULL)
+    if ((fileExt != NULL) && (ext != NULL))
     {
-#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_TEXT_MANIPULATION)
-        int extCount = 0;
-        const char **checkExts = TextSplit(ext, ';', &extCount); // WARNING: Module required: rtext
+        int fileExtLength = (int)strlen(fileExt);
+        const char *checkExt = ext;
 
-        char fileExtLower[MAX_FILE_EXTENSION_LENGTH + 1] = { 0 };
-        strncpy(fileExtLower, TextToLower(fileExt), MAX_FILE_EXTENSION_LENGTH); // WARNING: Module required: rtext
-
-        for (int i = 0; i < extCount; i++)
+        while (!result && (checkExt[0] != '\0'))
         {
-            if (strcmp(fileExtLower, TextToLower(checkExts[i])) == 0)
+            int length = 0;
+            while ((checkExt[length] != '\0') && (checkExt[length] != ';')) length++;
+
+            if (length == fileExtLength)
             {
-                result = true;
-                break;
+                int i = 0;
+                while ((i < length) && (tolower((unsigned char)checkExt[i]) == tolower((unsigned char)fileExt[i]))) i++;
+
+                if (i == length) result = true;
             }
+
+            checkExt += length;
+            if (checkExt[0] == ';') checkExt++;
         }
-#else
-        if (strcmp(fileExt, ext) == 0) result = true;
-#endif
     }
 
     return result;
@@ -1965,6 +1992,17 @@ int GetFileLength(const char *fileName)
 {
     int size = 0;
 
+#if defined(SUPPORT_ASSET_PACK)
+    long long packedSize = 0;
+    if (IsAssetPackFile(fileName, &packedSize))
+    {
+        if (packedSize > 2147483647) TRACELOG(LOG_WARNING, "[%s] File size overflows expected limit, do not use GetFileLength()", fileName);
+        else size = (int)packedSize;
+
+        return size;
+    }
+#endif
+
     // NOTE: On Unix-like systems, it can by used the POSIX system call: stat(),
     // but depending on the platform that call could not be available
     //struct stat result = { 0 };
@@ -31,6 +31,13 @@
 *           Those preprocessor defines are only used on rlgl module, if OpenGL version is
 *           required by any other module, use rlGetVersion() to check it
 *
+*       #define GRAPHICS_API_HEADLESS
+*           Use headless recording backend, no OpenGL library or GPU is required: rlgl runs the
+*           OpenGL ES 2.0 code paths but every GL call is captured into an in-memory command log,
+*           with counters for draw calls, vertices, texture binds, state changes and uploaded bytes.
+*           Useful to measure batching efficiency on CI machines [rlGetRecordStats(), rlGetRecordCommands()]
+*           NOTE: rlLoadExtensions(NULL) must be called before rlglInit(), no loader is used
+*
 *       #define RLGL_IMPLEMENTATION
 *           Generates the implementation of the library into the included file
 *           If not defined, the library is in header only mode and can be included in other headers
@@ -53,6 +60,8 @@
 *       #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
 *       #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
 *       #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+*       #define RL_DEFAULT_BATCH_TEXTURE_SLOTS        4    // Maximum number of textures per batch draw call with default shader (1 to 4, 1 disables multi-texture draws)
+*       #define RL_DEFAULT_BATCH_STREAM_BUFFERS       3    // Number of GPU vertex buffers streamed round-robin by each batch buffer
 *
 *       #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
 *       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
@@ -70,6 +79,7 @@
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS      "vertexBoneIds"     // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT      "vertexTexSlot"     // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION  "matProjection"     // projection matrix
@@ -154,7 +164,8 @@
     !defined(GRAPHICS_API_OPENGL_33) && \
     !defined(GRAPHICS_API_OPENGL_43) && \
     !defined(GRAPHICS_API_OPENGL_ES2) && \
-    !defined(GRAPHICS_API_OPENGL_ES3)
+    !defined(GRAPHICS_API_OPENGL_ES3) && \
+    !defined(GRAPHICS_API_HEADLESS)
         #define GRAPHICS_API_OPENGL_33
 #endif
 
@@ -190,6 +201,22 @@
     #define GRAPHICS_API_OPENGL_ES2
 #endif
 
+// Headless recording backend uses OpenGL ES 2.0 code paths (GL calls are recorded, not executed)
+#if defined(GRAPHICS_API_HEADLESS)
+    #if defined(GRAPHICS_API_OPENGL_11)
+        #undef GRAPHICS_API_OPENGL_11
+    #endif
+    #if defined(GRAPHICS_API_OPENGL_33)
+        #undef GRAPHICS_API_OPENGL_33
+    #endif
+    #if defined(GRAPHICS_API_OPENGL_ES3)
+        #undef GRAPHICS_API_OPENGL_ES3
+    #endif
+    #if !defined(GRAPHICS_API_OPENGL_ES2)
+        #define GRAPHICS_API_OPENGL_ES2
+    #endif
+#endif
+
 // Support framebuffer objects by default
 // NOTE: Some driver implementation do not support it, despite they should
 #define RLGL_RENDER_TEXTURES_HINT
@@ -221,6 +248,12 @@
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 #endif
+#ifndef RL_DEFAULT_BATCH_TEXTURE_SLOTS
+    #define RL_DEFAULT_BATCH_TEXTURE_SLOTS           4      // Maximum number of textures per batch draw call with default shader (1 to 4, 1 disables multi-texture draws)
+#endif
+#ifndef RL_DEFAULT_BATCH_STREAM_BUFFERS
+    #define RL_DEFAULT_BATCH_STREAM_BUFFERS          3      // Number of GPU vertex buffers streamed round-robin by each batch buffer
+#endif
 
 // Internal Matrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
@@ -355,6 +388,9 @@
     #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS 8
 #endif
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT
+    #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT     9
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -377,22 +413,31 @@ typedef struct Matrix {
 #define RL_MATRIX_TYPE
 #endif
 
-// Dynamic vertex buffers (position + texcoords + colors + indices arrays)
+// Render batch vertex (interleaved vertex data)
+typedef struct rlBatchVertex {
+    float position[3];          // Vertex position (XYZ) (shader-location = 0)
+    float texcoord[2];          // Vertex texture coordinates (UV) (shader-location = 1)
+    float normal[3];            // Vertex normal (XYZ) (shader-location = 2)
+    unsigned char color[4];     // Vertex color (RGBA) (shader-location = 3)
+    unsigned char texslot;      // Vertex texture slot in draw call textures (shader-location = 9)
+    unsigned char padding[3];   // Padding to keep vertex size 4-byte aligned
+} rlBatchVertex;
+
+// Dynamic vertex buffers (interleaved vertex data + indices arrays)
 typedef struct rlVertexBuffer {
     int elementCount;           // Number of elements in the buffer (QUADS)
 
-    float *vertices;            // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
-    float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
-    float *normals;             // Vertex normal (XYZ - 3 components per vertex) (shader-location = 2)
-    unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+    rlBatchVertex *vertices;    // Vertex data, interleaved: position, texcoord, normal, color, texture slot (4 vertex per quad)
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
     unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
 #if defined(GRAPHICS_API_OPENGL_ES2)
     unsigned short *indices;    // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
-    unsigned int vaoId;         // OpenGL Vertex Array Object id
-    unsigned int vboId[5];      // OpenGL Vertex Buffer Objects id (5 types of vertex data)
+    unsigned int vaoId[RL_DEFAULT_BATCH_STREAM_BUFFERS]; // OpenGL Vertex Array Objects id (one per stream buffer)
+    unsigned int vboId[RL_DEFAULT_BATCH_STREAM_BUFFERS]; // OpenGL Vertex Buffer Objects id (interleaved vertex data, streamed round-robin)
+    unsigned int eboId;         // OpenGL Element Buffer Object id (quads indices, shared by stream buffers)
+    int streamIndex;            // Stream buffer to be used on next upload
 } rlVertexBuffer;
 
 // Draw call type
@@ -406,6 +451,9 @@ typedef struct rlDrawCall {
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
     //unsigned int shaderId;    // Shader id to be used on the draw -> Using RLGL.currentShaderId
     unsigned int textureId;     // Texture id to be used on the draw -> Use to create new draw call if changes
+    unsigned int textureSlots[RL_DEFAULT_BATCH_TEXTURE_SLOTS]; // Textures used on the draw (default shader), vertex select them by texture slot
+    int textureSlotCount;       // Number of textures used on the draw (textureSlots[0] bound to texture0)
+    int layer;                  // Layer of the draw, sort key on sorted batch modes (rlSetBatchLayer())
 
     //Matrix projection;        // Projection matrix for this draw -> Using RLGL.projection by default
     //Matrix modelview;         // Modelview matrix for this draw -> Using RLGL.modelview by default
@@ -420,8 +468,31 @@ typedef struct rlRenderBatch {
     rlDrawCall *draws;          // Draw calls array, depends on textureId
     int drawCounter;            // Draw calls counter
     float currentDepth;         // Current depth value for next draw
+
+    rlBatchVertex *sortVertices; // Vertex data scratch buffer for sorted draws (allocated on first sort)
+    rlDrawCall *sortDraws;      // Draw calls scratch array for sorted draws (allocated on first sort)
 } rlRenderBatch;
 
+// Render batch counters
+typedef struct rlBatchStats {
+    int flushes;                // Render batch draws with vertex data
+    int drawCalls;              // Render batch draw calls
+    int textureChanges;         // Texture changes on batch drawing (rlSetTexture())
+    int textureSlotHits;        // Texture changes solved by draw call texture slots (no new draw call required)
+    unsigned int uploadBytes;   // Vertex data bytes uploaded to GPU (only used range of vertex buffers)
+    int sortMerges;             // Draw calls saved by merging draws on sorted batch modes
+} rlBatchStats;
+
+// Sprite instance, one record per sprite for instanced drawing (corners expanded on GPU)
+// NOTE: Same layout as raylib SpriteInstance, parameters work like DrawTexturePro()
+typedef struct rlSpriteInstance {
+    float dest[4];              // Destination rectangle (x, y, width, height)
+    float origin[2];            // Rotation origin, relative to destination rectangle
+    float rotation;             // Rotation in degrees
+    float source[4];            // Source rectangle in texture pixels (x, y, width, height), negative size flips
+    unsigned char color[4];     // Tint color (RGBA)
+} rlSpriteInstance;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -498,6 +569,15 @@ typedef enum {
     RL_BLEND_CUSTOM_SEPARATE            // Blend textures using custom src/dst factors (use rlSetBlendFactorsSeparate())
 } rlBlendMode;
 
+// Render batch draws sorting mode
+// NOTE: Sorting applies to the draws accumulated until batch is drawn,
+// shader, blend mode or matrix changes still force a batch draw
+typedef enum {
+    RL_BATCH_SORT_NONE = 0,             // Draws kept in submission order (default)
+    RL_BATCH_SORT_LAYER,                // Draws sorted by layer, submission order kept within layer (safe for alpha-blended draws)
+    RL_BATCH_SORT_STATE                 // Draws sorted by layer, then by texture and mode within layer (opaque or non-overlapping draws)
+} rlBatchSortMode;
+
 // Shader location point type
 typedef enum {
     RL_SHADER_LOC_VERTEX_POSITION = 0,  // Shader location: vertex attribute: position
@@ -589,6 +669,45 @@ typedef enum {
     RL_CULL_FACE_BACK
 } rlCullMode;
 
+#if defined(GRAPHICS_API_HEADLESS)
+// Recorded command type (headless backend)
+typedef enum {
+    RL_RECORD_BATCH_FLUSH = 0,          // Render batch draw: rlDrawRenderBatch() with vertex data
+    RL_RECORD_DRAW,                     // Draw call: glDrawArrays(), glDrawElements() (and instanced versions)
+    RL_RECORD_BIND_TEXTURE,             // Texture bind
+    RL_RECORD_BIND_SHADER,              // Shader program bind
+    RL_RECORD_BIND_BUFFER,              // Vertex/element buffer bind
+    RL_RECORD_BIND_VERTEX_ARRAY,        // Vertex array object bind
+    RL_RECORD_BIND_FRAMEBUFFER,         // Framebuffer bind
+    RL_RECORD_STATE,                    // Render state change: enable/disable, blending, depth, culling, viewport, scissor
+    RL_RECORD_CLEAR,                    // Framebuffer clear
+    RL_RECORD_UNIFORM,                  // Shader uniform upload
+    RL_RECORD_UPLOAD_BUFFER,            // Buffer data upload
+    RL_RECORD_UPLOAD_TEXTURE            // Texture data upload
+} rlRecordCommandType;
+
+// Recorded command (headless backend)
+typedef struct rlRecordCommand {
+    int type;                   // Command type (rlRecordCommandType)
+    unsigned int param;         // Command parameter: draw mode, state enum, bind target...
+    unsigned int id;            // Object id involved: texture, program, buffer, framebuffer...
+    int count;                  // Command size: vertex count (draws) or bytes (uploads)
+} rlRecordCommand;
+
+// Recorded counters (headless backend)
+typedef struct rlRecordStats {
+    int batchFlushes;           // Render batch draws with vertex data
+    int drawCalls;              // GPU draw calls
+    int vertexCount;            // Vertices processed by draw calls (indices on indexed draws, all instances)
+    int textureBinds;           // Texture binds (not including unbinds)
+    int shaderBinds;            // Shader program binds (not including unbinds)
+    int stateChanges;           // Render state changes
+    int bufferUploads;          // Buffer uploads
+    int textureUploads;         // Texture uploads
+    unsigned int bytesUploaded; // Bytes uploaded (buffers and textures)
+} rlRecordStats;
+#endif
+
 //------------------------------------------------------------------------------------
 // Functions Declaration - Matrix operations
 //------------------------------------------------------------------------------------
@@ -625,6 +744,7 @@ RLAPI void rlNormal3f(float x, float y, float z);       // Define one vertex (no
 RLAPI void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Define one vertex (color) - 4 byte
 RLAPI void rlColor3f(float x, float y, float z);        // Define one vertex (color) - 3 float
 RLAPI void rlColor4f(float x, float y, float z, float w); // Define one vertex (color) - 4 float
+RLAPI void rlQuads2f(const float *vertices, const float *texcoords, int quadCount, float x, float y); // Define multiple quads (4 vertex positions and texcoords per quad), translated by (x, y)
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - OpenGL style functions (common to 1.1, 3.3+, ES2)
@@ -725,6 +845,11 @@ RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);     // Draw render batch dat
 RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch); // Set the active render batch for rlgl (NULL for default internal)
 RLAPI void rlDrawRenderBatchActive(void);               // Update and draw internal render batch
 RLAPI bool rlCheckRenderBatchLimit(int vCount);         // Check internal buffer overflow for a given number of vertex
+RLAPI rlBatchStats rlGetBatchStats(void);               // Get render batch counters since last reset
+RLAPI void rlResetBatchStats(void);                     // Reset render batch counters
+RLAPI void rlSetBatchSortMode(int mode);                // Set render batch draws sorting mode (rlBatchSortMode), applied on batch draw
+RLAPI void rlSetBatchLayer(int layer);                  // Set render batch layer for next draws (lower layers drawn first on sorted modes)
+RLAPI void rlDrawSpriteInstances(unsigned int textureId, int textureWidth, int textureHeight, const rlSpriteInstance *instances, int instanceCount); // Draw sprites instanced (render batch fallback if instancing not supported)
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
@@ -735,6 +860,7 @@ RLAPI unsigned int rlLoadVertexArray(void);             // Load vertex array (va
 RLAPI unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic); // Load a vertex buffer object
 RLAPI unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynamic); // Load vertex buffer elements object
 RLAPI void rlUpdateVertexBuffer(unsigned int bufferId, const void *data, int dataSize, int offset); // Update vertex buffer object data on GPU buffer
+RLAPI void rlOrphanVertexBuffer(unsigned int bufferId, int size, bool dynamic); // Orphan vertex buffer object storage on GPU (previous data discarded)
 RLAPI void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset); // Update vertex buffer elements data on GPU buffer
 RLAPI void rlUnloadVertexArray(unsigned int vaoId);     // Unload vertex array (vao)
 RLAPI void rlUnloadVertexBuffer(unsigned int vboId);    // Unload vertex buffer object
@@ -751,6 +877,7 @@ RLAPI unsigned int rlLoadTexture(const void *data, int width, int height, int fo
 RLAPI unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer); // Load depth texture/renderbuffer (to be attached to fbo)
 RLAPI unsigned int rlLoadTextureCubemap(const void *data, int size, int format, int mipmapCount); // Load texture cubemap data
 RLAPI void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data); // Update texture with new data on GPU
+RLAPI void rlUpdateTextureMipmap(unsigned int id, int mipLevel, int offsetX, int offsetY, int width, int height, int format, const void *data); // Update texture mipmap level with new data on GPU
 RLAPI void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType); // Get OpenGL internal formats
 RLAPI const char *rlGetPixelFormatName(unsigned int format);              // Get name string for pixel format
 RLAPI void rlUnloadTexture(unsigned int id);                              // Unload texture from GPU memory
@@ -808,6 +935,13 @@ RLAPI void rlSetMatrixViewOffsetStereo(Matrix right, Matrix left);        // Set
 RLAPI void rlLoadDrawCube(void);     // Load and draw a cube
 RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 
+#if defined(GRAPHICS_API_HEADLESS)
+// Headless recording backend
+RLAPI rlRecordStats rlGetRecordStats(void);                               // Get recorded counters since last reset
+RLAPI const rlRecordCommand *rlGetRecordCommands(int *count);             // Get recorded commands since last reset
+RLAPI void rlResetRecord(void);                                           // Reset recorded commands and counters (call it on frame start)
+#endif
+
 #if defined(__cplusplus)
 }
 #endif
@@ -828,14 +962,23 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define GLAD_API_CALL_EXPORT_BUILD
 #endif
 
+#if defined(GRAPHICS_API_HEADLESS)
+    // Headless recording backend: only OpenGL ES 2.0 types and enums are required,
+    // GL functions are implemented by rlgl as recording stubs (no GL library linkage)
+    #define SDL_USE_BUILTIN_OPENGL_DEFINITIONS
+    #define GL_GLES_PROTOTYPES 0
+    #include "external/SDL2/include/SDL_opengles2.h"
+#else
 #define GL_GLEXT_PROTOTYPES
 //#include <EGL/egl.h>          // EGL library -> not required, platform layer
 #include "SDL2/SDL_opengles2.h"
+#endif
 typedef void (GL_APIENTRYP PFNGLDRAWARRAYSINSTANCEDEXTPROC) (GLenum mode, GLint start, GLsizei count, GLsizei primcount);
 typedef void (GL_APIENTRYP PFNGLDRAWELEMENTSINSTANCEDEXTPROC) (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount);
 typedef void (GL_APIENTRYP PFNGLVERTEXATTRIBDIVISOREXTPROC) (GLuint index, GLuint divisor);
 #include <stdlib.h>                     // Required for: malloc(), free()
 #include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
+#include <stddef.h>                     // Required for: offsetof() [Used in rlLoadRenderBatch(), rlDrawRenderBatch()]
 #include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
 
 //----------------------------------------------------------------------------------
@@ -948,6 +1091,9 @@ typedef void (GL_APIENTRYP PFNGLVERTEXATTRIBDIVISOREXTPROC) (GLuint index, GLuin
 #ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS
     #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT      "vertexTexSlot"     // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT
+#endif
 
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MVP
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
@@ -993,6 +1139,9 @@ typedef struct rlglData {
         float texcoordx, texcoordy;         // Current active texture coordinate (added on glVertex*())
         float normalx, normaly, normalz;    // Current active normal (added on glVertex*())
         unsigned char colorr, colorg, colorb, colora;   // Current active color (added on glVertex*())
+        unsigned char textureSlot;          // Current active texture slot in draw call textures (added on glVertex*())
+        int batchLayer;                     // Current render batch layer (set on new draws)
+        int batchSortMode;                  // Render batch draws sorting mode (rlBatchSortMode)
 
         int currentMatrixMode;              // Current matrix mode
         Matrix *currentMatrix;              // Current matrix pointer
@@ -1055,6 +1204,20 @@ typedef struct rlglData {
         int maxDepthBits;                   // Maximum bits for depth component
 
     } ExtSupported;     // Extensions supported flags
+
+    rlBatchStats batchStats;                // Render batch counters since last reset
+
+    struct {
+        unsigned int shaderId;              // Sprite instancing shader id (loaded on first use)
+        int locMvp;                         // Sprite instancing shader location: mvp matrix
+        int locTexSize;                     // Sprite instancing shader location: texture size
+        int locDepth;                       // Sprite instancing shader location: sprites depth
+        int locAttribs[5];                  // Sprite instancing shader location: corner, dest, origin+rotation, source, color attributes
+        unsigned int vaoId;                 // Sprite instancing vertex array id
+        unsigned int vboId[2];              // Sprite instancing vertex buffers id: corners, instances
+        int instanceCapacity;               // Sprite instances buffer capacity, grows on demand
+        bool failed;                        // Sprite instancing could not be initialized, render batch is used
+    } Sprites;
 } rlglData;
 
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
@@ -1071,7 +1234,7 @@ static double rlCullDistanceFar = RL_CULL_DISTANCE_FAR;
 static rlglData RLGL = { 0 };
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
-#if defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3)
+#if defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3) && !defined(GRAPHICS_API_HEADLESS)
 // NOTE: VAO functionality is exposed through extensions (OES)
 static PFNGLGENVERTEXARRAYSOESPROC glGenVertexArrays = NULL;
 static PFNGLBINDVERTEXARRAYOESPROC glBindVertexArray = NULL;
@@ -1083,13 +1246,282 @@ static PFNGLDRAWELEMENTSINSTANCEDEXTPROC glDrawElementsInstanced = NULL;
 static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #endif
 
+#if defined(GRAPHICS_API_HEADLESS)
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Headless recording backend
+//----------------------------------------------------------------------------------
+// NOTE: OpenGL ES 2.0 functions used by rlgl are implemented here as recording stubs,
+// no GPU work is done but all calls affecting performance are logged and counted
+
+#define RL_RECORD_INITIAL_CAPACITY      1024    // Initial recorded commands capacity, grows as required
+
+// Headless recorder state
+typedef struct rlRecordData {
+    rlRecordCommand *commands;          // Recorded commands since last reset
+    int count;                          // Recorded commands count
+    int capacity;                       // Recorded commands allocated capacity
+    rlRecordStats stats;                // Recorded counters since last reset
+
+    unsigned int nextId;                // Next id for generated GL objects
+    float lineWidth;                    // Current line width (queried by rlGetLineWidth())
+} rlRecordData;
+
+static rlRecordData RLREC = { 0 };
+
+// Push a command into the recorder and update counters
+static void rlRecordPush(int type, unsigned int param, unsigned int id, int count)
+{
+    if (RLREC.count >= RLREC.capacity)
+    {
+        int capacity = (RLREC.capacity == 0)? RL_RECORD_INITIAL_CAPACITY : RLREC.capacity*2;
+        rlRecordCommand *commands = (rlRecordCommand *)RL_REALLOC(RLREC.commands, capacity*sizeof(rlRecordCommand));
+
+        if (commands == NULL) return;       // Keep counting even if commands can not be stored
+
+        RLREC.commands = commands;
+        RLREC.capacity = capacity;
+    }
+
+    if (RLREC.count < RLREC.capacity) RLREC.commands[RLREC.count++] = (rlRecordCommand){ type, param, id, count };
+}
+
+// Get bytes per pixel for an uncompressed texture upload
+static int rlRecordPixelSize(GLenum format, GLenum type)
+{
+    int channels = 4;
+    switch (format)
+    {
+        case GL_ALPHA:
+        case GL_LUMINANCE:
+        case GL_DEPTH_COMPONENT: channels = 1; break;
+        case GL_LUMINANCE_ALPHA: channels = 2; break;
+        case GL_RGB: channels = 3; break;
+        default: break;
+    }
+
+    switch (type)
+    {
+        case GL_UNSIGNED_SHORT_5_6_5:
+        case GL_UNSIGNED_SHORT_4_4_4_4:
+        case GL_UNSIGNED_SHORT_5_5_5_1: return 2;
+        case GL_UNSIGNED_SHORT:
+        case GL_HALF_FLOAT_OES: return channels*2;
+        case GL_UNSIGNED_INT:
+        case GL_FLOAT: return channels*4;
+        default: return channels;
+    }
+}
+
+static void rlRecordDraw(GLenum mode, int vertexCount)
+{
+    rlRecordPush(RL_RECORD_DRAW, mode, 0, vertexCount);
+    RLREC.stats.drawCalls++;
+    RLREC.stats.vertexCount += vertexCount;
+}
+
+static void rlRecordState(GLenum state)
+{
+    rlRecordPush(RL_RECORD_STATE, state, 0, 0);
+    RLREC.stats.stateChanges++;
+}
+
+static void rlRecordBufferUpload(GLenum target, GLsizeiptr size, const void *data)
+{
+    if (data == NULL) return;   // Storage allocation only, nothing uploaded
+
+    rlRecordPush(RL_RECORD_UPLOAD_BUFFER, target, 0, (int)size);
+    RLREC.stats.bufferUploads++;
+    RLREC.stats.bytesUploaded += (unsigned int)size;
+}
+
+static void rlRecordTextureUpload(GLenum target, int size, const void *data)
+{
+    if (data == NULL) return;   // Storage allocation only, nothing uploaded
+
+    rlRecordPush(RL_RECORD_UPLOAD_TEXTURE, target, 0, size);
+    RLREC.stats.textureUploads++;
+    RLREC.stats.bytesUploaded += (unsigned int)size;
+}
+
+static void rlRecordGenIds(GLsizei n, GLuint *ids) { for (int i = 0; i < n; i++) ids[i] = ++RLREC.nextId; }
+
+// Objects management
+static void glGenBuffers(GLsizei n, GLuint *buffers) { rlRecordGenIds(n, buffers); }
+static void glGenTextures(GLsizei n, GLuint *textures) { rlRecordGenIds(n, textures); }
+static void glGenFramebuffers(GLsizei n, GLuint *framebuffers) { rlRecordGenIds(n, framebuffers); }
+static void glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) { rlRecordGenIds(n, renderbuffers); }
+static void glGenVertexArrays(GLsizei n, GLuint *arrays) { rlRecordGenIds(n, arrays); }
+static void glDeleteBuffers(GLsizei n, const GLuint *buffers) { (void)n; (void)buffers; }
+static void glDeleteTextures(GLsizei n, const GLuint *textures) { (void)n; (void)textures; }
+static void glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) { (void)n; (void)framebuffers; }
+static void glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) { (void)n; (void)renderbuffers; }
+static void glDeleteVertexArrays(GLsizei n, const GLuint *arrays) { (void)n; (void)arrays; }
+static void glGenerateMipmap(GLenum target) { (void)target; }
+
+// Bindings
+static void glBindBuffer(GLenum target, GLuint buffer) { rlRecordPush(RL_RECORD_BIND_BUFFER, target, buffer, 0); }
+static void glBindFramebuffer(GLenum target, GLuint framebuffer) { rlRecordPush(RL_RECORD_BIND_FRAMEBUFFER, target, framebuffer, 0); }
+static void glBindRenderbuffer(GLenum target, GLuint renderbuffer) { (void)target; (void)renderbuffer; }
+static void glBindVertexArray(GLuint array) { rlRecordPush(RL_RECORD_BIND_VERTEX_ARRAY, 0, array, 0); }
+static void glBindTexture(GLenum target, GLuint texture)
+{
+    rlRecordPush(RL_RECORD_BIND_TEXTURE, target, texture, 0);
+    if (texture != 0) RLREC.stats.textureBinds++;
+}
+static void glUseProgram(GLuint program)
+{
+    rlRecordPush(RL_RECORD_BIND_SHADER, 0, program, 0);
+    if (program != 0) RLREC.stats.shaderBinds++;
+}
+static void glActiveTexture(GLenum texture) { rlRecordState(texture); }
+static void glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { (void)target; (void)attachment; (void)textarget; (void)texture; (void)level; }
+static void glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { (void)target; (void)attachment; (void)renderbuffertarget; (void)renderbuffer; }
+static void glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) { (void)target; (void)internalformat; (void)width; (void)height; }
+static GLenum glCheckFramebufferStatus(GLenum target) { (void)target; return GL_FRAMEBUFFER_COMPLETE; }
+
+// Data uploads
+static void glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) { (void)usage; rlRecordBufferUpload(target, size, data); }
+static void glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) { (void)offset; rlRecordBufferUpload(target, size, data); }
+static void glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    (void)level; (void)internalformat; (void)border;
+    rlRecordTextureUpload(target, width*height*rlRecordPixelSize(format, type), pixels);
+}
+static void glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+    (void)level; (void)xoffset; (void)yoffset;
+    rlRecordTextureUpload(target, width*height*rlRecordPixelSize(format, type), pixels);
+}
+static void glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+    (void)level; (void)internalformat; (void)width; (void)height; (void)border;
+    rlRecordTextureUpload(target, imageSize, data);
+}
+static void glTexParameteri(GLenum target, GLenum pname, GLint param) { (void)target; (void)pname; (void)param; }
+static void glTexParameterf(GLenum target, GLenum pname, GLfloat param) { (void)target; (void)pname; (void)param; }
+static void glPixelStorei(GLenum pname, GLint param) { (void)pname; (void)param; }
+static void glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+    (void)x; (void)y;
+    memset(pixels, 0, width*height*rlRecordPixelSize(format, type));
+}
+
+// Vertex attributes
+static void glEnableVertexAttribArray(GLuint index) { (void)index; }
+static void glDisableVertexAttribArray(GLuint index) { (void)index; }
+static void glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) { (void)index; (void)size; (void)type; (void)normalized; (void)stride; (void)pointer; }
+static void glVertexAttribDivisor(GLuint index, GLuint divisor) { (void)index; (void)divisor; }
+static void glVertexAttrib1fv(GLuint index, const GLfloat *v) { (void)index; (void)v; }
+static void glVertexAttrib1f(GLuint index, GLfloat x) { (void)index; (void)x; }
+static void glVertexAttrib2fv(GLuint index, const GLfloat *v) { (void)index; (void)v; }
+static void glVertexAttrib3fv(GLuint index, const GLfloat *v) { (void)index; (void)v; }
+static void glVertexAttrib4fv(GLuint index, const GLfloat *v) { (void)index; (void)v; }
+
+// Draw calls
+static void glDrawArrays(GLenum mode, GLint first, GLsizei count) { (void)first; rlRecordDraw(mode, count); }
+static void glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) { (void)type; (void)indices; rlRecordDraw(mode, count); }
+static void glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) { (void)first; rlRecordDraw(mode, count*instancecount); }
+static void glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) { (void)type; (void)indices; rlRecordDraw(mode, count*instancecount); }
+static void glClear(GLbitfield mask) { rlRecordPush(RL_RECORD_CLEAR, mask, 0, 0); }
+static void glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { (void)red; (void)green; (void)blue; (void)alpha; }
+static void glClearDepthf(GLfloat d) { (void)d; }
+
+// Render state
+static void glEnable(GLenum cap) { rlRecordState(cap); }
+static void glDisable(GLenum cap) { rlRecordState(cap); }
+static void glBlendFunc(GLenum sfactor, GLenum dfactor) { (void)sfactor; (void)dfactor; rlRecordState(GL_BLEND_SRC_RGB); }
+static void glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) { (void)sfactorRGB; (void)dfactorRGB; (void)sfactorAlpha; (void)dfactorAlpha; rlRecordState(GL_BLEND_SRC_RGB); }
+static void glBlendEquation(GLenum mode) { (void)mode; rlRecordState(GL_BLEND_EQUATION_RGB); }
+static void glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) { (void)modeRGB; (void)modeAlpha; rlRecordState(GL_BLEND_EQUATION_RGB); }
+static void glDepthFunc(GLenum func) { (void)func; rlRecordState(GL_DEPTH_FUNC); }
+static void glDepthMask(GLboolean flag) { (void)flag; rlRecordState(GL_DEPTH_WRITEMASK); }
+static void glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) { (void)red; (void)green; (void)blue; (void)alpha; rlRecordState(GL_COLOR_WRITEMASK); }
+static void glCullFace(GLenum mode) { (void)mode; rlRecordState(GL_CULL_FACE_MODE); }
+static void glFrontFace(GLenum mode) { (void)mode; rlRecordState(GL_FRONT_FACE); }
+static void glLineWidth(GLfloat width) { RLREC.lineWidth = width; rlRecordState(GL_LINE_WIDTH); }
+static void glViewport(GLint x, GLint y, GLsizei width, GLsizei height) { (void)x; (void)y; (void)width; (void)height; rlRecordState(GL_VIEWPORT); }
+static void glScissor(GLint x, GLint y, GLsizei width, GLsizei height) { (void)x; (void)y; (void)width; (void)height; rlRecordState(GL_SCISSOR_BOX); }
+
+// Shaders
+static GLuint glCreateShader(GLenum type) { (void)type; return ++RLREC.nextId; }
+static GLuint glCreateProgram(void) { return ++RLREC.nextId; }
+static void glShaderSource(GLuint shader, GLsizei count, const GLchar *const *string, const GLint *length) { (void)shader; (void)count; (void)string; (void)length; }
+static void glCompileShader(GLuint shader) { (void)shader; }
+static void glAttachShader(GLuint program, GLuint shader) { (void)program; (void)shader; }
+static void glDetachShader(GLuint program, GLuint shader) { (void)program; (void)shader; }
+static void glLinkProgram(GLuint program) { (void)program; }
+static void glDeleteShader(GLuint shader) { (void)shader; }
+static void glDeleteProgram(GLuint program) { (void)program; }
+static void glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) { (void)program; (void)index; (void)name; }
+static void glGetShaderiv(GLuint shader, GLenum pname, GLint *params) { (void)shader; *params = (pname == GL_COMPILE_STATUS)? GL_TRUE : 0; }
+static void glGetProgramiv(GLuint program, GLenum pname, GLint *params) { (void)program; *params = (pname == GL_LINK_STATUS)? GL_TRUE : 0; }
+static void glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { (void)shader; if (length != NULL) *length = 0; if (bufSize > 0) infoLog[0] = '\0'; }
+static void glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { (void)program; if (length != NULL) *length = 0; if (bufSize > 0) infoLog[0] = '\0'; }
+
+// Get attribute location, default attributes are bound to default locations
+static GLint glGetAttribLocation(GLuint program, const GLchar *name)
+{
+    (void)program;
+    if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION) == 0) return RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION;
+    if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD) == 0) return RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD;
+    if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL) == 0) return RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL;
+    if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR) == 0) return RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR;
+    if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT) == 0) return RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT;
+    if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2) == 0) return RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2;
+    if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT) == 0) return RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT;
+#if defined(RL_SUPPORT_MESH_GPU_SKINNING)
+    if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS) == 0) return RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS;
+    if (strcmp(name, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS) == 0) return RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS;
+#endif
+    return -1;
+}
+
+// Get uniform location, any uniform name gets a stable location (name hash)
+static GLint glGetUniformLocation(GLuint program, const GLchar *name)
+{
+    (void)program;
+    unsigned int hash = 5381;
+    while (*name != '\0') hash = hash*33 + (unsigned char)*name++;
+    return (GLint)(hash & 0x7fff);
+}
+
+static void glUniform1i(GLint location, GLint v0) { (void)v0; rlRecordPush(RL_RECORD_UNIFORM, 0, (unsigned int)location, 1); }
+static void glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { (void)v0; (void)v1; (void)v2; (void)v3; rlRecordPush(RL_RECORD_UNIFORM, 0, (unsigned int)location, 1); }
+static void glUniform1iv(GLint location, GLsizei count, const GLint *value) { (void)value; rlRecordPush(RL_RECORD_UNIFORM, 0, (unsigned int)location, count); }
+static void glUniform2iv(GLint location, GLsizei count, const GLint *value) { (void)value; rlRecordPush(RL_RECORD_UNIFORM, 0, (unsigned int)location, count); }
+static void glUniform3iv(GLint location, GLsizei count, const GLint *value) { (void)value; rlRecordPush(RL_RECORD_UNIFORM, 0, (unsigned int)location, count); }
+static void glUniform4iv(GLint location, GLsizei count, const GLint *value) { (void)value; rlRecordPush(RL_RECORD_UNIFORM, 0, (unsigned int)location, count); }
+static void glUniform1fv(GLint location, GLsizei count, const GLfloat *value) { (void)value; rlRecordPush(RL_RECORD_UNIFORM, 0, (unsigned int)location, count); }
+static void glUniform2fv(GLint location, GLsizei count, const GLfloat *value) { (void)value; rlRecordPush(RL_RECORD_UNIFORM, 0, (unsigned int)location, count); }
+static void glUniform3fv(GLint location, GLsizei count, const GLfloat *value) { (void)value; rlRecordPush(RL_RECORD_UNIFORM, 0, (unsigned int)location, count); }
+static void glUniform4fv(GLint location, GLsizei count, const GLfloat *value) { (void)value; rlRecordPush(RL_RECORD_UNIFORM, 0, (unsigned int)location, count); }
+static void glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { (void)transpose; (void)value; rlRecordPush(RL_RECORD_UNIFORM, 0, (unsigned int)location, count); }
+
+// Queries
+static GLenum glGetError(void) { return GL_NO_ERROR; }
+static void glGetFloatv(GLenum pname, GLfloat *data)
+{
+    if (pname == GL_LINE_WIDTH) data[0] = RLREC.lineWidth;
+    else if (pname == 0x84FF) data[0] = 16.0f;  // GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT
+    else data[0] = 0.0f;
+}
+static void glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) { (void)target; (void)attachment; (void)pname; *params = 0; }
+#endif  // GRAPHICS_API_HEADLESS
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
-#if defined(RLGL_SHOW_GL_DETAILS_INFO)
+static void rlSetBatchVertexAttributes(bool texSlot); // Set render batch interleaved vertex attributes for currently bound buffer
+static void rlSortRenderBatch(rlRenderBatch *batch); // Sort render batch draws (and vertex data) by current sort mode, merging draws with same state
+static int rlCompareBatchDraws(const rlDrawCall *a, const rlDrawCall *b); // Compare render batch draws by current sort mode keys
+static bool rlMergeDrawTextures(rlDrawCall *dst, const rlDrawCall *src, unsigned char *slotMap); // Merge draw textures into another draw textures, getting texture slots remap
+static void rlLoadSpriteRenderer(void);     // Load sprite instancing shader and buffers
+static void rlUnloadSpriteRenderer(void);   // Unload sprite instancing shader and buffers
+static void rlSetSpriteVertexAttributes(void); // Set sprite instancing vertex attributes for sprite buffers
+#if defined(RLGL_SHOW_GL_DETAILS_INFO) && !defined(GRAPHICS_API_HEADLESS)
 static const char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -1393,6 +1825,14 @@ void rlNormal3f(float x, float y, float z) { glNormal3f(x, y, z); }
 void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a) { glColor4ub(r, g, b, a); }
 void rlColor3f(float x, float y, float z) { glColor3f(x, y, z); }
 void rlColor4f(float x, float y, float z, float w) { glColor4f(x, y, z, w); }
+void rlQuads2f(const float *vertices, const float *texcoords, int quadCount, float x, float y)
+{
+    for (int i = 0; i < quadCount*4; i++)
+    {
+        glTexCoord2f(texcoords[2*i], texcoords[2*i + 1]);
+        glVertex2f(vertices[2*i] + x, vertices[2*i + 1] + y);
+    }
+}
 #endif
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 // Initialize drawing mode (how to organize vertex)
@@ -1425,6 +1865,10 @@ void rlBegin(int mode)
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.defaultTextureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlots[0] = RLGL.State.defaultTextureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlotCount = 1;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.batchLayer;
+        RLGL.State.textureSlot = 0;
     }
 }
 
@@ -1478,25 +1922,30 @@ void rlVertex3f(float x, float y, float z)
         }
     }
 
+    rlBatchVertex *vertex = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[RLGL.State.vertexCounter];
+
     // Add vertices
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 2] = tz;
+    vertex->position[0] = tx;
+    vertex->position[1] = ty;
+    vertex->position[2] = tz;
 
     // Add current texcoord
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter] = RLGL.State.texcoordx;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter + 1] = RLGL.State.texcoordy;
+    vertex->texcoord[0] = RLGL.State.texcoordx;
+    vertex->texcoord[1] = RLGL.State.texcoordy;
 
     // Add current normal
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].normals[3*RLGL.State.vertexCounter] = RLGL.State.normalx;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].normals[3*RLGL.State.vertexCounter + 1] = RLGL.State.normaly;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].normals[3*RLGL.State.vertexCounter + 2] = RLGL.State.normalz;
+    vertex->normal[0] = RLGL.State.normalx;
+    vertex->normal[1] = RLGL.State.normaly;
+    vertex->normal[2] = RLGL.State.normalz;
 
     // Add current color
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter] = RLGL.State.colorr;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 1] = RLGL.State.colorg;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 2] = RLGL.State.colorb;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 3] = RLGL.State.colora;
+    vertex->color[0] = RLGL.State.colorr;
+    vertex->color[1] = RLGL.State.colorg;
+    vertex->color[2] = RLGL.State.colorb;
+    vertex->color[3] = RLGL.State.colora;
+
+    // Add current texture slot
+    vertex->texslot = RLGL.State.textureSlot;
 
     RLGL.State.vertexCounter++;
     RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
@@ -1569,6 +2018,71 @@ void rlColor3f(float x, float y, float z)
     rlColor4ub((unsigned char)(x*255), (unsigned char)(y*255), (unsigned char)(z*255), 255);
 }
 
+// Define multiple quads (4 vertex positions and texcoords per quad), translated by (x, y)
+// NOTE: Requires rlBegin(RL_QUADS), current normal and color are used for all vertex,
+// data is copied to the render batch in blocks, launching a new batch only between quads
+void rlQuads2f(const float *vertices, const float *texcoords, int quadCount, float x, float y)
+{
+    int quad = 0;
+
+    while (quad < quadCount)
+    {
+        rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+
+        // Get number of quads fitting on current batch, keeping rlCheckRenderBatchLimit() margin
+        int available = (buffer->elementCount*4 - RLGL.State.vertexCounter - 1)/4;
+
+        if (available <= 0)
+        {
+            rlCheckRenderBatchLimit(4 + 1);
+            continue;
+        }
+
+        int count = ((quadCount - quad) < available)? (quadCount - quad) : available;
+        int offset = RLGL.State.vertexCounter;
+        float depth = RLGL.currentBatch->currentDepth;
+
+        for (int i = 0; i < count*4; i++)
+        {
+            float vx = vertices[2*(quad*4 + i)] + x;
+            float vy = vertices[2*(quad*4 + i) + 1] + y;
+            rlBatchVertex *vertex = &buffer->vertices[offset + i];
+            float *position = vertex->position;
+
+            if (RLGL.State.transformRequired)
+            {
+                position[0] = RLGL.State.transform.m0*vx + RLGL.State.transform.m4*vy + RLGL.State.transform.m8*depth + RLGL.State.transform.m12;
+                position[1] = RLGL.State.transform.m1*vx + RLGL.State.transform.m5*vy + RLGL.State.transform.m9*depth + RLGL.State.transform.m13;
+                position[2] = RLGL.State.transform.m2*vx + RLGL.State.transform.m6*vy + RLGL.State.transform.m10*depth + RLGL.State.transform.m14;
+            }
+            else
+            {
+                position[0] = vx;
+                position[1] = vy;
+                position[2] = depth;
+            }
+
+            vertex->texcoord[0] = texcoords[2*(quad*4 + i)];
+            vertex->texcoord[1] = texcoords[2*(quad*4 + i) + 1];
+
+            vertex->normal[0] = RLGL.State.normalx;
+            vertex->normal[1] = RLGL.State.normaly;
+            vertex->normal[2] = RLGL.State.normalz;
+
+            vertex->color[0] = RLGL.State.colorr;
+            vertex->color[1] = RLGL.State.colorg;
+            vertex->color[2] = RLGL.State.colorb;
+            vertex->color[3] = RLGL.State.colora;
+
+            vertex->texslot = RLGL.State.textureSlot;
+        }
+
+        RLGL.State.vertexCounter += count*4;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount += count*4;
+        quad += count;
+    }
+}
+
 #endif
 
 //--------------------------------------------------------------------------------------
@@ -1596,8 +2110,44 @@ void rlSetTexture(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_11)
         rlEnableTexture(id);
 #else
-        if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId != id)
+        rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+        if (draw->textureId != id)
         {
+            RLGL.batchStats.textureChanges++;
+
+            // Default shader selects texture by vertex texture slot, so textures already used
+            // on current draw call (or a free slot) can be used without requiring a new draw call
+            // NOTE: Custom shaders only sample texture0, every texture requires its own draw call
+            int slot = -1;
+
+            if ((draw->vertexCount > 0) && (RLGL.State.currentShaderId == RLGL.State.defaultShaderId))
+            {
+                for (int i = 0; i < draw->textureSlotCount; i++)
+                {
+                    if (draw->textureSlots[i] == id)
+                    {
+                        slot = i;
+                        break;
+                    }
+                }
+
+                if ((slot < 0) && (draw->textureSlotCount < RL_DEFAULT_BATCH_TEXTURE_SLOTS))
+                {
+                    slot = draw->textureSlotCount;
+                    draw->textureSlots[slot] = id;
+                    draw->textureSlotCount++;
+                }
+            }
+
+            if (slot >= 0)
+            {
+                draw->textureId = id;
+                RLGL.State.textureSlot = (unsigned char)slot;
+                RLGL.batchStats.textureSlotHits++;
+                return;
+            }
+
             if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0)
             {
                 // Make sure current RLGL.currentBatch->draws[i].vertexCount is aligned a multiple of 4,
@@ -1620,7 +2170,11 @@ void rlSetTexture(unsigned int id)
             if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
 
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlots[0] = id;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlotCount = 1;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.batchLayer;
+            RLGL.State.textureSlot = 0;
         }
 #endif
     }
@@ -2281,10 +2835,16 @@ void rlglClose(void)
     rlUnloadRenderBatch(RLGL.defaultBatch);
 
     rlUnloadShaderDefault();          // Unload default shader
+    rlUnloadSpriteRenderer();         // Unload sprite instancing data (if loaded)
 
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
 #endif
+
+#if defined(GRAPHICS_API_HEADLESS)
+    RL_FREE(RLREC.commands);
+    RLREC = (rlRecordData){ 0 };
+#endif
 }
 
 // Load OpenGL extensions
@@ -2368,6 +2928,23 @@ void rlLoadExtensions(void *loader)
     //RLGL.ExtSupported.computeShader = true;
     //RLGL.ExtSupported.ssbo = true;
 
+#elif defined(GRAPHICS_API_HEADLESS)
+    // Register supported extensions flags
+    // NOTE: Headless recorder supports the common OpenGL ES 2.0 extensions, no loader required
+    RLGL.ExtSupported.vao = true;
+    RLGL.ExtSupported.instancing = true;
+    RLGL.ExtSupported.texNPOT = true;
+    RLGL.ExtSupported.texFloat32 = true;
+    RLGL.ExtSupported.texFloat16 = true;
+    RLGL.ExtSupported.texDepth = true;
+    RLGL.ExtSupported.maxDepthBits = 24;
+    RLGL.ExtSupported.texAnisoFilter = true;
+    RLGL.ExtSupported.texMirrorClamp = true;
+    RLGL.ExtSupported.texCompDXT = true;
+    RLGL.ExtSupported.texCompETC1 = true;
+
+    TRACELOG(RL_LOG_INFO, "GL: Headless recording backend initialized, GL calls are recorded but not executed");
+
 #elif defined(GRAPHICS_API_OPENGL_ES2)
 
     #if defined(PLATFORM_DESKTOP_GLFW) || defined(PLATFORM_DESKTOP_SDL)
@@ -2514,11 +3091,14 @@ void rlLoadExtensions(void *loader)
     // Check OpenGL information and capabilities
     //------------------------------------------------------------------------------
     // Show current OpenGL and GLSL version
+    // NOTE: Headless recording backend has no device to query
+#if !defined(GRAPHICS_API_HEADLESS)
     TRACELOG(RL_LOG_INFO, "GL: OpenGL device information:");
     TRACELOG(RL_LOG_INFO, "    > Vendor:   %s", glGetString(GL_VENDOR));
     TRACELOG(RL_LOG_INFO, "    > Renderer: %s", glGetString(GL_RENDERER));
     TRACELOG(RL_LOG_INFO, "    > Version:  %s", glGetString(GL_VERSION));
     TRACELOG(RL_LOG_INFO, "    > GLSL:     %s", glGetString(GL_SHADING_LANGUAGE_VERSION));
+#endif
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // NOTE: Anisotropy levels capability is an extension
@@ -2527,7 +3107,7 @@ void rlLoadExtensions(void *loader)
     #endif
     glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &RLGL.ExtSupported.maxAnisotropyLevel);
 
-#if defined(RLGL_SHOW_GL_DETAILS_INFO)
+#if defined(RLGL_SHOW_GL_DETAILS_INFO) && !defined(GRAPHICS_API_HEADLESS)
     // Show some OpenGL GPU capabilities
     TRACELOG(RL_LOG_INFO, "GL: OpenGL capabilities:");
     GLint capability = 0;
@@ -2676,18 +3256,15 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     rlRenderBatch batch = { 0 };
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Initialize CPU (RAM) vertex buffers (position, texcoord, color data and indexes)
+    // Initialize CPU (RAM) vertex buffers (interleaved vertex data and indexes)
     //--------------------------------------------------------------------------------------------
-    batch.vertexBuffer = (rlVertexBuffer *)RL_MALLOC(numBuffers*sizeof(rlVertexBuffer));
+    batch.vertexBuffer = (rlVertexBuffer *)RL_CALLOC(numBuffers, sizeof(rlVertexBuffer));
 
     for (int i = 0; i < numBuffers; i++)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
 
-        batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
-        batch.vertexBuffer[i].normals = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+        batch.vertexBuffer[i].vertices = (rlBatchVertex *)RL_CALLOC(bufferElements*4, sizeof(rlBatchVertex));  // 4 vertex by quad
 #if defined(GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
@@ -2695,11 +3272,6 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
 #endif
 
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].normals[j] = 0.0f;
-        for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
-
         int k = 0;
 
         // Indices can be initialized right now
@@ -2722,54 +3294,43 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     //--------------------------------------------------------------------------------------------
 
     // Upload to GPU (VRAM) vertex data and initialize VAOs/VBOs
+    // NOTE: Every batch buffer streams its vertex data to a ring of RL_DEFAULT_BATCH_STREAM_BUFFERS VBOs,
+    // storage is only allocated here, vertex data is uploaded on rlDrawRenderBatch()
     //--------------------------------------------------------------------------------------------
     for (int i = 0; i < numBuffers; i++)
     {
-        if (RLGL.ExtSupported.vao)
-        {
-            // Initialize Quads VAO
-            glGenVertexArrays(1, &batch.vertexBuffer[i].vaoId);
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
-        }
-
-        // Quads - Vertex buffers binding and attributes enable
-        // Vertex position buffer (shader-location = 0)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-
-        // Vertex texcoord buffer (shader-location = 1)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-
-        // Vertex normal buffer (shader-location = 2)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].normals, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
-
-        // Vertex color buffer (shader-location = 3)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-
-        // Fill index buffer
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[4]);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[4]);
+        // Fill index buffer, shared by all stream buffers
+        glGenBuffers(1, &batch.vertexBuffer[i].eboId);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].eboId);
 #if defined(GRAPHICS_API_OPENGL_33)
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(int), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
 #endif
 #if defined(GRAPHICS_API_OPENGL_ES2)
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(short), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
 #endif
+
+        for (int s = 0; s < RL_DEFAULT_BATCH_STREAM_BUFFERS; s++)
+        {
+            if (RLGL.ExtSupported.vao)
+            {
+                // Initialize Quads VAO
+                glGenVertexArrays(1, &batch.vertexBuffer[i].vaoId[s]);
+                glBindVertexArray(batch.vertexBuffer[i].vaoId[s]);
+            }
+
+            // Quads - Interleaved vertex buffer binding and attributes enable
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[s]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[s]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*4*sizeof(rlBatchVertex), NULL, GL_STREAM_DRAW);
+
+            if (RLGL.ExtSupported.vao)
+            {
+                rlSetBatchVertexAttributes(true);
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].eboId);
+            }
+        }
+
+        batch.vertexBuffer[i].streamIndex = 0;
     }
 
     TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
@@ -2790,6 +3351,9 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         //batch.draws[i].vaoId = 0;
         //batch.draws[i].shaderId = 0;
         batch.draws[i].textureId = RLGL.State.defaultTextureId;
+        batch.draws[i].textureSlots[0] = RLGL.State.defaultTextureId;
+        batch.draws[i].textureSlotCount = 1;
+        batch.draws[i].layer = 0;
         //batch.draws[i].RLGL.State.projection = rlMatrixIdentity();
         //batch.draws[i].RLGL.State.modelview = rlMatrixIdentity();
     }
@@ -2817,35 +3381,36 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         // Unbind VAO attribs data
         if (RLGL.ExtSupported.vao)
         {
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
-            glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
-            glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
-            glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
-            glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+            for (int s = 0; s < RL_DEFAULT_BATCH_STREAM_BUFFERS; s++)
+            {
+                glBindVertexArray(batch.vertexBuffer[i].vaoId[s]);
+                glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
+                glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
+                glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
+                glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+                glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT);
+            }
+
             glBindVertexArray(0);
         }
 
         // Delete VBOs from GPU (VRAM)
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[4]);
+        glDeleteBuffers(RL_DEFAULT_BATCH_STREAM_BUFFERS, batch.vertexBuffer[i].vboId);
+        glDeleteBuffers(1, &batch.vertexBuffer[i].eboId);
 
         // Delete VAOs from GPU (VRAM)
-        if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
+        if (RLGL.ExtSupported.vao) glDeleteVertexArrays(RL_DEFAULT_BATCH_STREAM_BUFFERS, batch.vertexBuffer[i].vaoId);
 
         // Free vertex arrays memory from CPU (RAM)
         RL_FREE(batch.vertexBuffer[i].vertices);
-        RL_FREE(batch.vertexBuffer[i].texcoords);
-        RL_FREE(batch.vertexBuffer[i].normals);
-        RL_FREE(batch.vertexBuffer[i].colors);
         RL_FREE(batch.vertexBuffer[i].indices);
     }
 
     // Unload arrays
     RL_FREE(batch.vertexBuffer);
     RL_FREE(batch.draws);
+    RL_FREE(batch.sortVertices);
+    RL_FREE(batch.sortDraws);
 #endif
 }
 
@@ -2860,46 +3425,26 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (use a change detector flag?)
     if (RLGL.State.vertexCounter > 0)
     {
-        // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
-
-        // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
-
-        // Texture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
-
-        // Normals buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].normals);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].normals, GL_DYNAMIC_DRAW); // Update all buffer
-
-        // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
-
-        // NOTE: glMapBuffer() causes sync issue
-        // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job
-        // To avoid waiting (idle), you can call first glBufferData() with NULL pointer before glMapBuffer()
-        // If you do that, the previous data in PBO will be discarded and glMapBuffer() returns a new
-        // allocated pointer immediately even if GPU is still working with the previous data
-
-        // Another option: map the buffer object into client's memory
-        // Probably this code could be moved somewhere else...
-        // batch->vertexBuffer[batch->currentBuffer].vertices = (float *)glMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE);
-        // if (batch->vertexBuffer[batch->currentBuffer].vertices)
-        // {
-            // Update vertex data
-        // }
-        // glUnmapBuffer(GL_ARRAY_BUFFER);
-
-        // Unbind the current VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+        // Reorder draws and vertex data if a sorted mode is enabled
+        if (RLGL.State.batchSortMode != RL_BATCH_SORT_NONE) rlSortRenderBatch(batch);
+
+#if defined(GRAPHICS_API_HEADLESS)
+        rlRecordPush(RL_RECORD_BATCH_FLUSH, batch->drawCounter, 0, RLGL.State.vertexCounter);
+        RLREC.stats.batchFlushes++;
+#endif
+        RLGL.batchStats.flushes++;
+
+        rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+        int uploadSize = RLGL.State.vertexCounter*sizeof(rlBatchVertex);
+
+        // Interleaved vertex buffer, next one in the stream ring
+        // NOTE: Buffer storage is orphaned before upload: if GPU is still working with previous data,
+        // driver provides new storage instead of waiting (stall), only the used range is uploaded
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[buffer->streamIndex]);
+        glBufferData(GL_ARRAY_BUFFER, buffer->elementCount*4*sizeof(rlBatchVertex), NULL, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, uploadSize, buffer->vertices);
+
+        RLGL.batchStats.uploadBytes += (unsigned int)uploadSize;
     }
     //------------------------------------------------------------------------------------------------------------
 
@@ -2957,30 +3502,17 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL], 1, false, rlMatrixToFloat(rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform))));
             }
 
-            if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+            rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+
+            if (RLGL.ExtSupported.vao) glBindVertexArray(buffer->vaoId[buffer->streamIndex]);
             else
             {
-                // Bind vertex attrib: position (shader-location = 0)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-
-                // Bind vertex attrib: texcoord (shader-location = 1)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-
-                // Bind vertex attrib: normal (shader-location = 2)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
-
-                // Bind vertex attrib: color (shader-location = 3)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[4]);
+                // Bind interleaved vertex attribs from current stream buffer
+                // NOTE: Texture slot attribute is only used by default shader
+                glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[buffer->streamIndex]);
+                rlSetBatchVertexAttributes(RLGL.State.currentShaderId == RLGL.State.defaultShaderId);
+
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer->eboId);
             }
 
             // Setup some default shader values
@@ -3004,8 +3536,21 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
             for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
             {
+                // Bind draw call additional textures (default shader), selected by vertex texture slot
+                // NOTE: Slot textures units follow active textures units, so they are not overwritten
+                if (batch->draws[i].textureSlotCount > 1)
+                {
+                    for (int s = 1; s < batch->draws[i].textureSlotCount; s++)
+                    {
+                        glActiveTexture(GL_TEXTURE0 + RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS + s);
+                        glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureSlots[s]);
+                    }
+
+                    glActiveTexture(GL_TEXTURE0);
+                }
+
                 // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureSlots[0]);
 
                 if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
                 else
@@ -3021,11 +3566,17 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     #endif
                 }
 
+                RLGL.batchStats.drawCalls++;
+
                 vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
             }
 
             if (!RLGL.ExtSupported.vao)
             {
+                // Texture slot attribute is not used by other draws, disabled to not read batch buffer
+                glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT);
+                glVertexAttrib1f(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, 0.0f);
+
                 glBindBuffer(GL_ARRAY_BUFFER, 0);
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             }
@@ -3044,6 +3595,13 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
     // Reset batch buffers
     //------------------------------------------------------------------------------------------------------------
+    // Change to next stream buffer in the ring, used for next upload
+    if (RLGL.State.vertexCounter > 0)
+    {
+        rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+        buffer->streamIndex = (buffer->streamIndex + 1)%RL_DEFAULT_BATCH_STREAM_BUFFERS;
+    }
+
     // Reset vertex counter for next frame
     RLGL.State.vertexCounter = 0;
 
@@ -3060,8 +3618,13 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         batch->draws[i].mode = RL_QUADS;
         batch->draws[i].vertexCount = 0;
         batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        batch->draws[i].textureSlots[0] = RLGL.State.defaultTextureId;
+        batch->draws[i].textureSlotCount = 1;
+        batch->draws[i].layer = RLGL.State.batchLayer;
     }
 
+    RLGL.State.textureSlot = 0;
+
     // Reset active texture units for next batch
     for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) RLGL.State.activeTextureId[i] = 0;
 
@@ -3106,21 +3669,214 @@ bool rlCheckRenderBatchLimit(int vCount)
     {
         overflow = true;
 
-        // Store current primitive drawing mode and texture id
-        int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
-        int currentTexture = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId;
+        // Store current primitive drawing mode and textures
+        rlDrawCall currentDraw = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+        unsigned char currentTextureSlot = RLGL.State.textureSlot;
 
         rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
 
         // Restore state of last batch so we can continue adding vertices
-        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = currentMode;
-        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = currentTexture;
+        // NOTE: Draw call textures are kept, next vertices keep using current texture slot
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = currentDraw.mode;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = currentDraw.textureId;
+        for (int i = 0; i < currentDraw.textureSlotCount; i++) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlots[i] = currentDraw.textureSlots[i];
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlotCount = currentDraw.textureSlotCount;
+        RLGL.State.textureSlot = currentTextureSlot;
     }
 #endif
 
     return overflow;
 }
 
+// Get render batch counters since last reset
+rlBatchStats rlGetBatchStats(void)
+{
+    rlBatchStats stats = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.batchStats;
+#endif
+
+    return stats;
+}
+
+// Reset render batch counters
+void rlResetBatchStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlBatchStats stats = { 0 };
+    RLGL.batchStats = stats;
+#endif
+}
+
+// Set render batch draws sorting mode (rlBatchSortMode), applied on batch draw
+void rlSetBatchSortMode(int mode)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.batchSortMode != mode)
+    {
+        // Draws already accumulated are drawn with previous mode
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.batchSortMode = mode;
+    }
+#endif
+}
+
+// Set render batch layer for next draws (lower layers drawn first on sorted modes)
+// NOTE: Layer change starts a new draw call on sorted modes, keeping current mode and texture
+void rlSetBatchLayer(int layer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.batchLayer != layer)
+    {
+        rlDrawCall currentDraw = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+        // Draws are not sorted on RL_BATCH_SORT_NONE, no new draw call required
+        if ((RLGL.State.batchSortMode != RL_BATCH_SORT_NONE) && (currentDraw.vertexCount > 0))
+        {
+            // Make sure current draw vertexCount is aligned a multiple of 4 (same as rlBegin())
+            if (currentDraw.mode == RL_LINES) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = ((currentDraw.vertexCount < 4)? currentDraw.vertexCount : currentDraw.vertexCount%4);
+            else if (currentDraw.mode == RL_TRIANGLES) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = ((currentDraw.vertexCount < 4)? 1 : (4 - (currentDraw.vertexCount%4)));
+            else RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = 0;
+
+            if (!rlCheckRenderBatchLimit(RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment))
+            {
+                RLGL.State.vertexCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment;
+                RLGL.currentBatch->drawCounter++;
+            }
+
+            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+
+            // New draw keeps current mode and starts with current texture only
+            // NOTE: Batch could have been drawn, texture slot is reset, previous draw textures are not kept
+            rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+            draw->mode = currentDraw.mode;
+            draw->vertexCount = 0;
+            draw->textureId = currentDraw.textureId;
+            draw->textureSlots[0] = currentDraw.textureId;
+            draw->textureSlotCount = 1;
+            RLGL.State.textureSlot = 0;
+        }
+
+        RLGL.State.batchLayer = layer;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = layer;
+    }
+#endif
+}
+
+// Draw sprites instanced (render batch fallback if instancing not supported)
+// NOTE: Instancing path uploads one record per sprite and expands sprites corners on GPU with an
+// internal sprite shader (current shader is not used), render batch is drawn first to keep draw order
+void rlDrawSpriteInstances(unsigned int textureId, int textureWidth, int textureHeight, const rlSpriteInstance *instances, int instanceCount)
+{
+    if ((instances == NULL) || (instanceCount <= 0) || (textureWidth <= 0) || (textureHeight <= 0)) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.instancing && !RLGL.State.stereoRender)
+    {
+        if ((RLGL.Sprites.shaderId == 0) && !RLGL.Sprites.failed) rlLoadSpriteRenderer();
+
+        if (!RLGL.Sprites.failed)
+        {
+            rlDrawRenderBatch(RLGL.currentBatch);
+
+            // Upload sprite instances, buffer storage is orphaned (or grown) to avoid waiting on GPU
+            glBindBuffer(GL_ARRAY_BUFFER, RLGL.Sprites.vboId[1]);
+            if (instanceCount > RLGL.Sprites.instanceCapacity)
+            {
+                while (RLGL.Sprites.instanceCapacity < instanceCount) RLGL.Sprites.instanceCapacity *= 2;
+            }
+            glBufferData(GL_ARRAY_BUFFER, RLGL.Sprites.instanceCapacity*sizeof(rlSpriteInstance), NULL, GL_STREAM_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, instanceCount*sizeof(rlSpriteInstance), instances);
+            RLGL.batchStats.uploadBytes += (unsigned int)(instanceCount*sizeof(rlSpriteInstance));
+
+            glUseProgram(RLGL.Sprites.shaderId);
+
+            Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
+            if (RLGL.State.transformRequired) matMVP = rlMatrixMultiply(RLGL.State.transform, matMVP);
+            float texSize[2] = { (float)textureWidth, (float)textureHeight };
+            glUniformMatrix4fv(RLGL.Sprites.locMvp, 1, false, rlMatrixToFloat(matMVP));
+            glUniform2fv(RLGL.Sprites.locTexSize, 1, texSize);
+            glUniform1fv(RLGL.Sprites.locDepth, 1, &RLGL.currentBatch->currentDepth);
+
+            glActiveTexture(GL_TEXTURE0);
+            glBindTexture(GL_TEXTURE_2D, textureId);
+
+            if (RLGL.ExtSupported.vao) glBindVertexArray(RLGL.Sprites.vaoId);
+            else rlSetSpriteVertexAttributes();
+
+            // Two triangles by sprite, corners from sprite buffer
+            rlDrawVertexArrayInstanced(0, 6, instanceCount);
+            RLGL.batchStats.drawCalls++;
+
+            if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+            else
+            {
+                for (int i = 1; i < 5; i++) glVertexAttribDivisor(RLGL.Sprites.locAttribs[i], 0);
+                for (int i = 0; i < 5; i++) glDisableVertexAttribArray(RLGL.Sprites.locAttribs[i]);
+                glBindBuffer(GL_ARRAY_BUFFER, 0);
+            }
+
+            glBindTexture(GL_TEXTURE_2D, 0);
+            glUseProgram(0);
+
+            RLGL.currentBatch->currentDepth += (1.0f/20000.0f);
+            return;
+        }
+    }
+#endif
+
+    // Render batch fallback: sprites corners expanded on CPU (same as DrawTexturePro())
+    float width = (float)textureWidth;
+    float height = (float)textureHeight;
+
+    rlSetTexture(textureId);
+    rlBegin(RL_QUADS);
+
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+
+        for (int i = 0; i < instanceCount; i++)
+        {
+            const rlSpriteInstance *sprite = &instances[i];
+            float destWidth = fabsf(sprite->dest[2]);
+            float destHeight = fabsf(sprite->dest[3]);
+            float sinRotation = 0.0f;
+            float cosRotation = 1.0f;
+
+            if (sprite->rotation != 0.0f)
+            {
+                sinRotation = sinf(sprite->rotation*DEG2RAD);
+                cosRotation = cosf(sprite->rotation*DEG2RAD);
+            }
+
+            // Source texture coordinates, negative source size flips
+            float u0 = sprite->source[0]/width;
+            float u1 = (sprite->source[0] + sprite->source[2])/width;
+            float v0 = sprite->source[1]/height;
+            float v1 = (sprite->source[1] + sprite->source[3])/height;
+            if (sprite->source[2] < 0) { u0 = (sprite->source[0] - sprite->source[2])/width; u1 = sprite->source[0]/width; }
+            if (sprite->source[3] < 0) { v0 = (sprite->source[1] - sprite->source[3])/height; v1 = sprite->source[1]/height; }
+
+            // Corners order: top-left, bottom-left, bottom-right, top-right
+            const float cornerX[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+            const float cornerY[4] = { 0.0f, 1.0f, 1.0f, 0.0f };
+
+            rlColor4ub(sprite->color[0], sprite->color[1], sprite->color[2], sprite->color[3]);
+
+            for (int c = 0; c < 4; c++)
+            {
+                float dx = cornerX[c]*destWidth - sprite->origin[0];
+                float dy = cornerY[c]*destHeight - sprite->origin[1];
+
+                rlTexCoord2f((cornerX[c] == 0.0f)? u0 : u1, (cornerY[c] == 0.0f)? v0 : v1);
+                rlVertex2f(sprite->dest[0] + dx*cosRotation - dy*sinRotation, sprite->dest[1] + dx*sinRotation + dy*cosRotation);
+            }
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+}
+
 // Textures data management
 //-----------------------------------------------------------------------------------------
 // Convert image data to OpenGL texture (returns OpenGL valid Id)
@@ -3446,6 +4202,22 @@ void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int h
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
 }
 
+// Update already loaded texture mipmap level in GPU with new data
+// NOTE: data rows must be tightly packed, offsets and size are relative to mipmap level
+void rlUpdateTextureMipmap(unsigned int id, int mipLevel, int offsetX, int offsetY, int width, int height, int format, const void *data)
+{
+    glBindTexture(GL_TEXTURE_2D, id);
+
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if ((glInternalFormat != 0) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        glTexSubImage2D(GL_TEXTURE_2D, mipLevel, offsetX, offsetY, width, height, glFormat, glType, data);
+    }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update mipmap level %i for current texture format (%i)", id, mipLevel, format);
+}
+
 // Get OpenGL internal formats and data type from raylib PixelFormat
 void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType)
 {
@@ -3841,6 +4613,16 @@ void rlUpdateVertexBuffer(unsigned int id, const void *data, int dataSize, int o
 #endif
 }
 
+// Orphan vertex buffer storage, previous data is discarded
+// NOTE: Storage is reallocated, following updates do not wait for draws still using previous data
+void rlOrphanVertexBuffer(unsigned int id, int size, bool dynamic)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferData(GL_ARRAY_BUFFER, size, NULL, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+#endif
+}
+
 // Update vertex buffer elements with new data
 // NOTE: dataSize and offset must be provided in bytes
 void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset)
@@ -4170,6 +4952,7 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
     glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
     glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
     glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT);
 
 #ifdef RL_SUPPORT_MESH_GPU_SKINNING
     glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS);
@@ -4760,6 +5543,30 @@ void rlLoadDrawCube(void)
 #endif
 }
 
+#if defined(GRAPHICS_API_HEADLESS)
+// Get recorded counters since last reset
+rlRecordStats rlGetRecordStats(void)
+{
+    return RLREC.stats;
+}
+
+// Get recorded commands since last reset
+// NOTE: Returned pointer is valid until next recorded command or reset
+const rlRecordCommand *rlGetRecordCommands(int *count)
+{
+    if (count != NULL) *count = RLREC.count;
+    return RLREC.commands;
+}
+
+// Reset recorded commands and counters
+// NOTE: Commands memory is kept to avoid reallocations between frames
+void rlResetRecord(void)
+{
+    RLREC.count = 0;
+    RLREC.stats = (rlRecordStats){ 0 };
+}
+#endif
+
 // Get name string for pixel format
 const char *rlGetPixelFormatName(unsigned int format)
 {
@@ -4814,15 +5621,19 @@ static void rlLoadShaderDefault(void)
     "attribute vec3 vertexPosition;     \n"
     "attribute vec2 vertexTexCoord;     \n"
     "attribute vec4 vertexColor;        \n"
+    "attribute float vertexTexSlot;     \n"
     "varying vec2 fragTexCoord;         \n"
     "varying vec4 fragColor;            \n"
+    "varying float fragTexSlot;         \n"
 #elif defined(GRAPHICS_API_OPENGL_33)
     "#version 330                       \n"
     "in vec3 vertexPosition;            \n"
     "in vec2 vertexTexCoord;            \n"
     "in vec4 vertexColor;               \n"
+    "in float vertexTexSlot;            \n"
     "out vec2 fragTexCoord;             \n"
     "out vec4 fragColor;                \n"
+    "out float fragTexSlot;             \n"
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_ES3)
@@ -4831,16 +5642,20 @@ static void rlLoadShaderDefault(void)
     "in vec3 vertexPosition;            \n"
     "in vec2 vertexTexCoord;            \n"
     "in vec4 vertexColor;               \n"
+    "in float vertexTexSlot;            \n"
     "out vec2 fragTexCoord;             \n"
     "out vec4 fragColor;                \n"
+    "out float fragTexSlot;             \n"
 #elif defined(GRAPHICS_API_OPENGL_ES2)
     "#version 100                       \n"
     "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL) (on some browsers)
     "attribute vec3 vertexPosition;     \n"
     "attribute vec2 vertexTexCoord;     \n"
     "attribute vec4 vertexColor;        \n"
+    "attribute float vertexTexSlot;     \n"
     "varying vec2 fragTexCoord;         \n"
     "varying vec4 fragColor;            \n"
+    "varying float fragTexSlot;         \n"
 #endif
 
     "uniform mat4 mvp;                  \n"
@@ -4848,6 +5663,7 @@ static void rlLoadShaderDefault(void)
     "{                                  \n"
     "    fragTexCoord = vertexTexCoord; \n"
     "    fragColor = vertexColor;       \n"
+    "    fragTexSlot = vertexTexSlot;   \n"
     "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
     "}                                  \n";
 
@@ -4857,23 +5673,39 @@ static void rlLoadShaderDefault(void)
     "#version 120                       \n"
     "varying vec2 fragTexCoord;         \n"
     "varying vec4 fragColor;            \n"
+    "varying float fragTexSlot;         \n"
     "uniform sampler2D texture0;        \n"
+    "uniform sampler2D texture1;        \n"
+    "uniform sampler2D texture2;        \n"
+    "uniform sampler2D texture3;        \n"
     "uniform vec4 colDiffuse;           \n"
     "void main()                        \n"
     "{                                  \n"
-    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
+    "    vec4 texelColor;               \n"
+    "    if (fragTexSlot < 0.5) texelColor = texture2D(texture0, fragTexCoord);      \n"
+    "    else if (fragTexSlot < 1.5) texelColor = texture2D(texture1, fragTexCoord); \n"
+    "    else if (fragTexSlot < 2.5) texelColor = texture2D(texture2, fragTexCoord); \n"
+    "    else texelColor = texture2D(texture3, fragTexCoord);                        \n"
     "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
     "}                                  \n";
 #elif defined(GRAPHICS_API_OPENGL_33)
     "#version 330       \n"
     "in vec2 fragTexCoord;              \n"
     "in vec4 fragColor;                 \n"
+    "in float fragTexSlot;              \n"
     "out vec4 finalColor;               \n"
     "uniform sampler2D texture0;        \n"
+    "uniform sampler2D texture1;        \n"
+    "uniform sampler2D texture2;        \n"
+    "uniform sampler2D texture3;        \n"
     "uniform vec4 colDiffuse;           \n"
     "void main()                        \n"
     "{                                  \n"
-    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
+    "    vec4 texelColor;               \n"
+    "    if (fragTexSlot < 0.5) texelColor = texture(texture0, fragTexCoord);      \n"
+    "    else if (fragTexSlot < 1.5) texelColor = texture(texture1, fragTexCoord); \n"
+    "    else if (fragTexSlot < 2.5) texelColor = texture(texture2, fragTexCoord); \n"
+    "    else texelColor = texture(texture3, fragTexCoord);                        \n"
     "    finalColor = texelColor*colDiffuse*fragColor;        \n"
     "}                                  \n";
 #endif
@@ -4883,12 +5715,20 @@ static void rlLoadShaderDefault(void)
     "precision mediump float;           \n"     // Precision required for OpenGL ES3 (WebGL 2)
     "in vec2 fragTexCoord;              \n"
     "in vec4 fragColor;                 \n"
+    "in float fragTexSlot;              \n"
     "out vec4 finalColor;               \n"
     "uniform sampler2D texture0;        \n"
+    "uniform sampler2D texture1;        \n"
+    "uniform sampler2D texture2;        \n"
+    "uniform sampler2D texture3;        \n"
     "uniform vec4 colDiffuse;           \n"
     "void main()                        \n"
     "{                                  \n"
-    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
+    "    vec4 texelColor;               \n"
+    "    if (fragTexSlot < 0.5) texelColor = texture(texture0, fragTexCoord);      \n"
+    "    else if (fragTexSlot < 1.5) texelColor = texture(texture1, fragTexCoord); \n"
+    "    else if (fragTexSlot < 2.5) texelColor = texture(texture2, fragTexCoord); \n"
+    "    else texelColor = texture(texture3, fragTexCoord);                        \n"
     "    finalColor = texelColor*colDiffuse*fragColor;        \n"
     "}                                  \n";
 #elif defined(GRAPHICS_API_OPENGL_ES2)
@@ -4896,11 +5736,19 @@ static void rlLoadShaderDefault(void)
     "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
     "varying vec2 fragTexCoord;         \n"
     "varying vec4 fragColor;            \n"
+    "varying float fragTexSlot;         \n"
     "uniform sampler2D texture0;        \n"
+    "uniform sampler2D texture1;        \n"
+    "uniform sampler2D texture2;        \n"
+    "uniform sampler2D texture3;        \n"
     "uniform vec4 colDiffuse;           \n"
     "void main()                        \n"
     "{                                  \n"
-    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
+    "    vec4 texelColor;               \n"
+    "    if (fragTexSlot < 0.5) texelColor = texture2D(texture0, fragTexCoord);      \n"
+    "    else if (fragTexSlot < 1.5) texelColor = texture2D(texture1, fragTexCoord); \n"
+    "    else if (fragTexSlot < 2.5) texelColor = texture2D(texture2, fragTexCoord); \n"
+    "    else texelColor = texture2D(texture3, fragTexCoord);                        \n"
     "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
     "}                                  \n";
 #endif
@@ -4925,6 +5773,14 @@ static void rlLoadShaderDefault(void)
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MATRIX_MVP] = glGetUniformLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);
+
+        // Set draw call texture slots samplers to their texture units, texture0 is set on batch drawing
+        // NOTE: Slot textures use units after the ones reserved for active textures (rlSetUniformSampler())
+        glUseProgram(RLGL.State.defaultShaderId);
+        glUniform1i(glGetUniformLocation(RLGL.State.defaultShaderId, "texture1"), RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS + 1);
+        glUniform1i(glGetUniformLocation(RLGL.State.defaultShaderId, "texture2"), RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS + 2);
+        glUniform1i(glGetUniformLocation(RLGL.State.defaultShaderId, "texture3"), RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS + 3);
+        glUseProgram(0);
     }
     else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", RLGL.State.defaultShaderId);
 }
@@ -4948,7 +5804,393 @@ static void rlUnloadShaderDefault(void)
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
-#if defined(RLGL_SHOW_GL_DETAILS_INFO)
+// Set render batch interleaved vertex attributes for currently bound buffer
+// NOTE: Attributes use current shader locations, texture slot is only used by default shader
+// and only enabled if requested (disabled attribute reads slot 0)
+static void rlSetBatchVertexAttributes(bool texSlot)
+{
+    // Vertex attrib: position (shader-location = 0)
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, position));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+
+    // Vertex attrib: texcoord (shader-location = 1)
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, texcoord));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+
+    // Vertex attrib: normal (shader-location = 2)
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, normal));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
+
+    // Vertex attrib: color (shader-location = 3)
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, color));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+
+    // Vertex attrib: texture slot (shader-location = 9)
+    if (texSlot)
+    {
+        glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, 1, GL_UNSIGNED_BYTE, GL_FALSE, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, texslot));
+        glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT);
+    }
+    else
+    {
+        glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT);
+        glVertexAttrib1f(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXSLOT, 0.0f);
+    }
+}
+
+// Load sprite instancing shader and buffers
+// NOTE: Sprite corners are expanded on vertex shader from one instance record by sprite
+static void rlLoadSpriteRenderer(void)
+{
+    const char *spriteVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec4 instanceDest;       \n"
+    "attribute vec3 instanceOrigin;     \n"
+    "attribute vec4 instanceSource;     \n"
+    "attribute vec4 instanceColor;      \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 vertexPosition;            \n"
+    "in vec4 instanceDest;              \n"
+    "in vec3 instanceOrigin;            \n"
+    "in vec4 instanceSource;            \n"
+    "in vec4 instanceColor;             \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_ES3)
+    "#version 300 es                    \n"
+    "precision highp float;             \n"     // Sprite positions require high precision
+    "in vec2 vertexPosition;            \n"
+    "in vec4 instanceDest;              \n"
+    "in vec3 instanceOrigin;            \n"
+    "in vec4 instanceSource;            \n"
+    "in vec4 instanceColor;             \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision highp float;             \n"     // Sprite positions require high precision
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec4 instanceDest;       \n"
+    "attribute vec3 instanceOrigin;     \n"
+    "attribute vec4 instanceSource;     \n"
+    "attribute vec4 instanceColor;      \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#endif
+
+    "uniform mat4 mvp;                  \n"
+    "uniform vec2 texSize;              \n"
+    "uniform float depth;               \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 local = vertexPosition*abs(instanceDest.zw) - instanceOrigin.xy; \n"
+    "    float angle = radians(instanceOrigin.z); \n"
+    "    float s = sin(angle);          \n"
+    "    float c = cos(angle);          \n"
+    "    vec2 position = instanceDest.xy + vec2(local.x*c - local.y*s, local.x*s + local.y*c); \n"
+    "    vec2 flip = 1.0 - step(0.0, instanceSource.zw); \n"
+    "    fragTexCoord = (instanceSource.xy + mix(vertexPosition, 1.0 - vertexPosition, flip)*abs(instanceSource.zw))/texSize; \n"
+    "    fragColor = instanceColor;     \n"
+    "    gl_Position = mvp*vec4(position, depth, 1.0); \n"
+    "}                                  \n";
+
+    const char *spriteFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*fragColor; \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    finalColor = texture(texture0, fragTexCoord)*fragColor; \n"
+    "}                                  \n";
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_ES3)
+    "#version 300 es                    \n"
+    "precision mediump float;           \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    finalColor = texture(texture0, fragTexCoord)*fragColor; \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*fragColor; \n"
+    "}                                  \n";
+#endif
+
+    RLGL.Sprites.shaderId = rlLoadShaderCode(spriteVShaderCode, spriteFShaderCode);
+
+    // Shader loading failure returns default shader, sprites fallback to render batch
+    if ((RLGL.Sprites.shaderId == 0) || (RLGL.Sprites.shaderId == RLGL.State.defaultShaderId))
+    {
+        RLGL.Sprites.shaderId = 0;
+        RLGL.Sprites.failed = true;
+        TRACELOG(RL_LOG_WARNING, "RLGL: Sprite instancing shader could not be loaded, using render batch");
+        return;
+    }
+
+    RLGL.Sprites.locMvp = glGetUniformLocation(RLGL.Sprites.shaderId, "mvp");
+    RLGL.Sprites.locTexSize = glGetUniformLocation(RLGL.Sprites.shaderId, "texSize");
+    RLGL.Sprites.locDepth = glGetUniformLocation(RLGL.Sprites.shaderId, "depth");
+    RLGL.Sprites.locAttribs[0] = glGetAttribLocation(RLGL.Sprites.shaderId, "vertexPosition");
+    RLGL.Sprites.locAttribs[1] = glGetAttribLocation(RLGL.Sprites.shaderId, "instanceDest");
+    RLGL.Sprites.locAttribs[2] = glGetAttribLocation(RLGL.Sprites.shaderId, "instanceOrigin");
+    RLGL.Sprites.locAttribs[3] = glGetAttribLocation(RLGL.Sprites.shaderId, "instanceSource");
+    RLGL.Sprites.locAttribs[4] = glGetAttribLocation(RLGL.Sprites.shaderId, "instanceColor");
+
+    // Sprite corners, two triangles: top-left, bottom-left, bottom-right, top-left, bottom-right, top-right
+    const float corners[12] = { 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f };
+
+    RLGL.Sprites.instanceCapacity = RL_DEFAULT_BATCH_BUFFER_ELEMENTS;
+
+    if (RLGL.ExtSupported.vao)
+    {
+        glGenVertexArrays(1, &RLGL.Sprites.vaoId);
+        glBindVertexArray(RLGL.Sprites.vaoId);
+    }
+
+    glGenBuffers(2, RLGL.Sprites.vboId);
+    glBindBuffer(GL_ARRAY_BUFFER, RLGL.Sprites.vboId[0]);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, RLGL.Sprites.vboId[1]);
+    glBufferData(GL_ARRAY_BUFFER, RLGL.Sprites.instanceCapacity*sizeof(rlSpriteInstance), NULL, GL_STREAM_DRAW);
+
+    if (RLGL.ExtSupported.vao)
+    {
+        rlSetSpriteVertexAttributes();
+        glBindVertexArray(0);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Sprite instancing shader loaded successfully", RLGL.Sprites.shaderId);
+}
+
+// Unload sprite instancing shader and buffers
+static void rlUnloadSpriteRenderer(void)
+{
+    if (RLGL.Sprites.shaderId > 0)
+    {
+        if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &RLGL.Sprites.vaoId);
+        glDeleteBuffers(2, RLGL.Sprites.vboId);
+        glDeleteProgram(RLGL.Sprites.shaderId);
+    }
+
+    RLGL.Sprites.shaderId = 0;
+    RLGL.Sprites.failed = false;
+}
+
+// Set sprite instancing vertex attributes for sprite buffers
+static void rlSetSpriteVertexAttributes(void)
+{
+    // Sprite corner (per vertex)
+    glBindBuffer(GL_ARRAY_BUFFER, RLGL.Sprites.vboId[0]);
+    glVertexAttribPointer(RLGL.Sprites.locAttribs[0], 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(RLGL.Sprites.locAttribs[0]);
+
+    // Sprite instance data (per instance): dest, origin + rotation, source, color
+    glBindBuffer(GL_ARRAY_BUFFER, RLGL.Sprites.vboId[1]);
+    glVertexAttribPointer(RLGL.Sprites.locAttribs[1], 4, GL_FLOAT, GL_FALSE, sizeof(rlSpriteInstance), (void *)offsetof(rlSpriteInstance, dest));
+    glVertexAttribPointer(RLGL.Sprites.locAttribs[2], 3, GL_FLOAT, GL_FALSE, sizeof(rlSpriteInstance), (void *)offsetof(rlSpriteInstance, origin));
+    glVertexAttribPointer(RLGL.Sprites.locAttribs[3], 4, GL_FLOAT, GL_FALSE, sizeof(rlSpriteInstance), (void *)offsetof(rlSpriteInstance, source));
+    glVertexAttribPointer(RLGL.Sprites.locAttribs[4], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlSpriteInstance), (void *)offsetof(rlSpriteInstance, color));
+
+    for (int i = 1; i < 5; i++)
+    {
+        glEnableVertexAttribArray(RLGL.Sprites.locAttribs[i]);
+        glVertexAttribDivisor(RLGL.Sprites.locAttribs[i], 1);
+    }
+}
+
+// Sort render batch draws (and vertex data) by current sort mode, merging draws with same state
+// NOTE: Draws are reordered with a stable sort and vertex data is copied in the new order to a scratch
+// buffer (swapped with current vertex buffer), consecutive draws with same mode and compatible
+// textures are merged into one draw call; if aligned data does not fit, batch is kept unsorted
+static void rlSortRenderBatch(rlRenderBatch *batch)
+{
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    int order[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    int offsets[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    int drawCount = 0;
+
+    // Get draws with vertex data and their vertex offset
+    for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+    {
+        if (batch->draws[i].vertexCount > 0)
+        {
+            order[drawCount] = i;
+            offsets[i] = vertexOffset;
+            drawCount++;
+        }
+
+        vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+    }
+
+    if (drawCount < 2) return;
+
+    // Stable insertion sort, draws count is small and usually partially ordered
+    for (int i = 1; i < drawCount; i++)
+    {
+        int current = order[i];
+        int j = i - 1;
+
+        while ((j >= 0) && (rlCompareBatchDraws(&batch->draws[order[j]], &batch->draws[current]) > 0))
+        {
+            order[j + 1] = order[j];
+            j--;
+        }
+
+        order[j + 1] = current;
+    }
+
+    if (batch->sortVertices == NULL) batch->sortVertices = (rlBatchVertex *)RL_MALLOC(buffer->elementCount*4*sizeof(rlBatchVertex));
+    if (batch->sortDraws == NULL) batch->sortDraws = (rlDrawCall *)RL_MALLOC(RL_DEFAULT_BATCH_DRAWCALLS*sizeof(rlDrawCall));
+
+    int sortCount = 0;
+    int sortVertexCount = 0;
+
+    for (int i = 0; i < drawCount; i++)
+    {
+        const rlDrawCall *draw = &batch->draws[order[i]];
+        rlDrawCall *last = (sortCount > 0)? &batch->sortDraws[sortCount - 1] : NULL;
+        unsigned char slotMap[RL_DEFAULT_BATCH_TEXTURE_SLOTS] = { 0 };
+        bool merged = false;
+
+        if ((last != NULL) && (last->mode == draw->mode)) merged = rlMergeDrawTextures(last, draw, slotMap);
+
+        if (merged) last->vertexCount += draw->vertexCount;
+        else
+        {
+            // Make sure previous draw ends aligned to a multiple of 4 vertex,
+            // following QUADS drawing keeps aligned with index processing
+            if (last != NULL)
+            {
+                last->vertexAlignment = (4 - sortVertexCount%4)%4;
+                sortVertexCount += last->vertexAlignment;
+            }
+
+            rlDrawCall *sortDraw = &batch->sortDraws[sortCount];
+            *sortDraw = *draw;
+            sortDraw->vertexAlignment = 0;
+            for (int s = 0; s < draw->textureSlotCount; s++) slotMap[s] = (unsigned char)s;
+            sortCount++;
+        }
+
+        // Sorted data could require more alignment vertex than submission order, keep batch unsorted
+        if ((sortVertexCount + draw->vertexCount) > buffer->elementCount*4) return;
+
+        // Copy draw vertex data in sorted order, remapping texture slots if required
+        rlBatchVertex *vertices = &batch->sortVertices[sortVertexCount];
+        memcpy(vertices, &buffer->vertices[offsets[order[i]]], draw->vertexCount*sizeof(rlBatchVertex));
+
+        for (int s = 0; s < draw->textureSlotCount; s++)
+        {
+            if (slotMap[s] != s)
+            {
+                for (int v = 0; v < draw->vertexCount; v++) vertices[v].texslot = slotMap[vertices[v].texslot];
+                break;
+            }
+        }
+
+        sortVertexCount += draw->vertexCount;
+    }
+
+    // Swap vertex data with sorted scratch buffer and replace draws
+    rlBatchVertex *vertices = buffer->vertices;
+    buffer->vertices = batch->sortVertices;
+    batch->sortVertices = vertices;
+
+    for (int i = 0; i < sortCount; i++) batch->draws[i] = batch->sortDraws[i];
+
+    RLGL.batchStats.sortMerges += (drawCount - sortCount);
+    batch->drawCounter = sortCount;
+    RLGL.State.vertexCounter = sortVertexCount;
+}
+
+// Compare render batch draws by current sort mode keys
+static int rlCompareBatchDraws(const rlDrawCall *a, const rlDrawCall *b)
+{
+    if (a->layer != b->layer) return (a->layer < b->layer)? -1 : 1;
+
+    if (RLGL.State.batchSortMode == RL_BATCH_SORT_STATE)
+    {
+        if (a->textureSlots[0] != b->textureSlots[0]) return (a->textureSlots[0] < b->textureSlots[0])? -1 : 1;
+        if (a->mode != b->mode) return (a->mode < b->mode)? -1 : 1;
+    }
+
+    return 0;
+}
+
+// Merge draw textures into another draw textures, getting texture slots remap
+// NOTE: New textures only fit in free texture slots with default shader, custom shaders only sample texture0
+static bool rlMergeDrawTextures(rlDrawCall *dst, const rlDrawCall *src, unsigned char *slotMap)
+{
+    unsigned int textureSlots[RL_DEFAULT_BATCH_TEXTURE_SLOTS] = { 0 };
+    int textureSlotCount = dst->textureSlotCount;
+    int maxSlots = (RLGL.State.currentShaderId == RLGL.State.defaultShaderId)? RL_DEFAULT_BATCH_TEXTURE_SLOTS : 1;
+
+    for (int i = 0; i < textureSlotCount; i++) textureSlots[i] = dst->textureSlots[i];
+
+    for (int i = 0; i < src->textureSlotCount; i++)
+    {
+        int slot = -1;
+
+        for (int j = 0; j < textureSlotCount; j++)
+        {
+            if (textureSlots[j] == src->textureSlots[i])
+            {
+                slot = j;
+                break;
+            }
+        }
+
+        if (slot < 0)
+        {
+            if (textureSlotCount >= maxSlots) return false;
+
+            slot = textureSlotCount;
+            textureSlots[textureSlotCount] = src->textureSlots[i];
+            textureSlotCount++;
+        }
+
+        slotMap[i] = (unsigned char)slot;
+    }
+
+    for (int i = 0; i < textureSlotCount; i++) dst->textureSlots[i] = textureSlots[i];
+    dst->textureSlotCount = textureSlotCount;
+
+    return true;
+}
+
+#if defined(RLGL_SHOW_GL_DETAILS_INFO) && !defined(GRAPHICS_API_HEADLESS)
 // Get compressed format official GL identifier name
 static const char *rlGetCompressedFormatName(int format)
 {
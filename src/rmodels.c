@@ -57,6 +57,7 @@
 #include <stdlib.h>         // Required for: malloc(), calloc(), free()
 #include <string.h>         // Required for: memcmp(), strlen(), strncpy()
 #include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf()
+#include <float.h>          // Required for: FLT_MAX
 
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
     #define TINYOBJ_MALLOC RL_MALLOC
@@ -115,6 +116,18 @@
     #endif
 #endif
 
+// CPU skinning SIMD path: SSE on x86/x64, NEON on ARM, scalar fallback otherwise
+// NOTE: Define SKINNING_DISABLE_SIMD to force the scalar path
+#if !defined(SKINNING_DISABLE_SIMD)
+    #if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #define SKINNING_SSE
+        #include <xmmintrin.h>      // Required for: SSE intrinsics [Used in SkinMeshVertices()]
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define SKINNING_NEON
+        #include <arm_neon.h>       // Required for: NEON intrinsics [Used in SkinMeshVertices()]
+    #endif
+#endif
+
 #if defined(_WIN32)
     #include <direct.h>     // Required for: _chdir() [Used in LoadOBJ()]
     #define CHDIR _chdir
@@ -132,20 +145,100 @@
 #ifndef MAX_MESH_VERTEX_BUFFERS
     #define MAX_MESH_VERTEX_BUFFERS  9    // Maximum vertex buffers (VBO) per mesh
 #endif
+#ifndef MESH_BVH_LEAF_TRIANGLES
+    #define MESH_BVH_LEAF_TRIANGLES  4    // Maximum triangles per mesh BVH leaf node
+#endif
+#ifndef MESH_BVH_MAX_DEPTH
+    #define MESH_BVH_MAX_DEPTH      48    // Maximum mesh BVH depth (traversal stack size)
+#endif
+#ifndef RAY_COLLISION_JOB_RAYS
+    #define RAY_COLLISION_JOB_RAYS  64    // Rays per job on batched ray collision queries
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Models animation batch, bone matrices processed by job system (one job per model)
+typedef struct AnimationBatch {
+    Model *models;              // Models to update
+    ModelAnimation *anims;      // Animations to apply
+    int *frames;                // Animations frames
+} AnimationBatch;
+
+// Mesh BVH node
+// NOTE: Inner nodes have count 0 and children at nodes[start] and nodes[start + 1],
+// leaf nodes reference triangles [start, start + count) of BVH triangles array
+typedef struct MeshBVHNode {
+    Vector3 min;                // Node bounds minimum
+    Vector3 max;                // Node bounds maximum
+    int start;                  // First child node (inner node) or first triangle (leaf node)
+    int count;                  // Triangles count (leaf node)
+} MeshBVHNode;
+
+// Mesh bounding volume hierarchy
+struct rMeshBVH {
+    MeshBVHNode *nodes;         // Nodes array, root node at index 0
+    int nodeCount;              // Nodes count
+    int *triangles;             // Mesh triangle indices, sorted by leaf node
+};
+
+// Rays collision batch, processed by job system (one job per rays group)
+typedef struct RayCollisionBatch {
+    const Ray *rays;            // Rays to test
+    int rayCount;               // Rays count
+    Mesh mesh;                  // Mesh to test
+    Matrix transform;           // Mesh transform
+    Matrix invTransform;        // Mesh transform inverse
+    RayCollision *collisions;   // Collisions results
+} RayCollisionBatch;
+
+// Mesh skinning job, processed by job system (one job per mesh)
+typedef struct SkinningJob {
+    Mesh mesh;                  // Mesh to update
+    float *palette;             // Bone palette scratch memory (16 floats per mesh bone)
+    bool updated;               // Mesh vertex data updated, requires GPU upload
+} SkinningJob;
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Model async load data
+typedef struct ModelAsyncLoad {
+    char *fileName;             // File name, stored after struct
+    bool mainThread;            // Model format not async-safe, model is fully loaded on main thread (on upload)
+    Model model;                // Model loaded on loading thread, meshes and textures uploaded on main thread
+} ModelAsyncLoad;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+static InstanceBuffer instancesBuffer = { 0 };      // Internal instance transforms buffer, reused by DrawMeshInstanced()
+static float16 *instancesData = NULL;               // Instance transforms packing buffer (CPU)
+static int instancesDataCapacity = 0;               // Instance transforms packing buffer capacity
+static unsigned char *skinningScratch = NULL;       // Skinning jobs and bone palettes scratch memory, reused by UpdateModelAnimationsBatch()
+static int skinningScratchSize = 0;                 // Skinning scratch memory size (in bytes)
+
+//----------------------------------------------------------------------------------
+// Other Modules Functions Declaration (required by models)
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_ASYNC_LOADING)
+extern void UploadAsyncTexture(AsyncUploads *uploads, Texture2D *texture);  // [Module: textures] Upload texture deferred on async loading thread
+#endif
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
+#if defined(SUPPORT_ASYNC_LOADING)
+static bool LoadModelAsyncData(void *data);     // Load model data (loading thread)
+static bool UploadModelAsyncData(void *data, AsyncUploads *uploads);    // Upload model meshes and textures (main thread)
+static void UnloadModelAsyncData(void *data, bool uploaded);    // Unload model async load data not retrieved (main thread)
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void DrawMeshInstancedVbo(Mesh mesh, Material material, unsigned int instancesVboId, int instances); // Draw mesh instances with transforms from vertex buffer
+#endif
+static bool ReserveInstanceBuffer(InstanceBuffer *buffer, int offset, int count);  // Make room for instance transforms range, growing buffer if required
+#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
+static void GetModelFilePath(char *path, const char *modelFileName, const char *fileName);  // Get path of a file relative to model directory
+#endif
 #if defined(SUPPORT_FILEFORMAT_OBJ)
 static Model LoadOBJ(const char *fileName);     // Load OBJ mesh data
 #endif
@@ -167,6 +260,18 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
 static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
 #endif
+static Transform *LoadInverseBindPose(const Transform *bindPose, int boneCount); // Load bind pose inverse transforms
+static void UpdateModelBoneMatrices(Model model, ModelAnimation anim, int frame); // Update model meshes bone matrices for a given frame
+static bool SkinMeshVertices(Mesh mesh, float *palette);  // Skin mesh vertices and normals with current bone matrices (CPU)
+static void ProcessBonesJob(void *userData, int index);   // Process model bone matrices job
+static void ProcessSkinningJob(void *userData, int index); // Process mesh skinning job
+static void GetMeshTriangle(Mesh mesh, int index, Vector3 *a, Vector3 *b, Vector3 *c); // Get mesh triangle vertex positions
+static void UnloadMeshBVH(rMeshBVH *bvh);                 // Unload mesh bounding volume hierarchy
+static float GetRayNodeDistance(Vector3 origin, Vector3 invDir, const MeshBVHNode *node, float maxDistance); // Check ray against BVH node bounds
+static RayCollision GetRayClosestMeshCollision(Ray ray, Mesh mesh); // Get closest mesh triangle collision info (mesh space)
+static bool IsTransformInvertible(Matrix transform);      // Check if transform can be inverted (scale relative check)
+static RayCollision GetRayCollisionMeshSpace(Ray ray, Mesh mesh, Matrix transform, Matrix invTransform); // Get collision info between ray and mesh, tested in mesh space
+static void ProcessRayCollisionJob(void *userData, int index); // Process rays collision job
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -1131,6 +1236,55 @@ Model LoadModel(const char *fileName)
     return model;
 }
 
+// Load model from file asynchronously, returns async load handle (0 on failure)
+// NOTE: File is loaded and parsed on loading thread (including materials images),
+// meshes and textures are uploaded on main thread (EndDrawing())
+// WARNING: Only IQM, GLTF/GLB, VOX and M3D loaders are async-safe, OBJ loader changes process
+// working directory to load materials, so OBJ models are fully loaded on main thread (EndDrawing())
+unsigned int LoadModelAsync(const char *fileName, AsyncLoadCallback callback, void *userData)
+{
+    unsigned int handle = 0;
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    if (fileName == NULL) return 0;
+
+    ModelAsyncLoad *load = (ModelAsyncLoad *)RL_CALLOC(1, sizeof(ModelAsyncLoad) + strlen(fileName) + 1);
+    load->fileName = (char *)(load + 1);
+    strcpy(load->fileName, fileName);
+    load->mainThread = IsFileExtension(fileName, ".obj");
+
+    handle = QueueAsyncLoad(ASYNC_ASSET_MODEL, load, LoadModelAsyncData, UploadModelAsyncData, UnloadModelAsyncData, callback, userData);
+    if (handle == 0) RL_FREE(load);
+#else
+    (void)callback;
+    (void)userData;
+    TRACELOG(LOG_WARNING, "MODEL: [%s] Async loading not supported", fileName);
+#endif
+
+    return handle;
+}
+
+// Get model loaded asynchronously, handle is released
+// NOTE: An empty model is returned if load is not ready (or failed)
+Model GetAsyncModel(unsigned int handle)
+{
+    Model model = { 0 };
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    ModelAsyncLoad *load = (ModelAsyncLoad *)TakeAsyncLoadResult(handle, ASYNC_ASSET_MODEL);
+
+    if (load != NULL)
+    {
+        model = load->model;
+        RL_FREE(load);
+    }
+#else
+    (void)handle;
+#endif
+
+    return model;
+}
+
 // Load model from generated mesh
 // WARNING: A shallow copy of mesh is generated, passed by value,
 // as long as struct contains pointers to data and some values, we get a copy
@@ -1209,6 +1363,7 @@ void UnloadModel(Model model)
     // Unload animation data
     RL_FREE(model.bones);
     RL_FREE(model.bindPose);
+    RL_FREE(model.invBindPose);
 
     TRACELOG(LOG_INFO, "MODEL: Unloaded model (and meshes) from RAM and VRAM");
 }
@@ -1258,6 +1413,23 @@ void UploadMesh(Mesh *mesh, bool dynamic)
         return;
     }
 
+#if defined(SUPPORT_ASYNC_LOADING)
+    // Mesh upload is deferred to main thread when loading an asset on async loading thread
+    AsyncUploads *uploads = GetAsyncUploads();
+
+    if (uploads != NULL)
+    {
+        for (int i = 0; i < uploads->meshCount; i++) if (uploads->meshes[i].mesh == mesh) return;     // Mesh upload already deferred
+
+        uploads->meshes = (AsyncMeshUpload *)RL_REALLOC(uploads->meshes, (uploads->meshCount + 1)*sizeof(AsyncMeshUpload));
+        uploads->meshes[uploads->meshCount].mesh = mesh;
+        uploads->meshes[uploads->meshCount].dynamic = dynamic;
+        uploads->meshCount++;
+
+        return;
+    }
+#endif
+
     mesh->vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VERTEX_BUFFERS, sizeof(unsigned int));
 
     mesh->vaoId = 0;        // Vertex Array Object
@@ -1667,13 +1839,25 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
 }
 
 // Draw multiple mesh instances with material and different transforms
+// NOTE: Transforms are uploaded to an internal persistent buffer, grown on demand,
+// use an InstanceBuffer to keep static instances in GPU between frames
 void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Instancing required variables
-    float16 *instanceTransforms = NULL;
-    unsigned int instancesVboId = 0;
+    if ((transforms == NULL) || (instances <= 0)) return;
+
+    UpdateInstanceBuffer(&instancesBuffer, transforms, 0, instances);
+    if (instancesBuffer.capacity < instances) return;
 
+    DrawMeshInstancedVbo(mesh, material, instancesBuffer.id, instances);
+#endif
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Draw mesh instances with material and transforms from vertex buffer
+// NOTE: Instance transforms are expected as column-major float16 arrays
+static void DrawMeshInstancedVbo(Mesh mesh, Material material, unsigned int instancesVboId, int instances)
+{
     // Bind shader program
     rlEnableShader(material.shader.id);
 
@@ -1719,20 +1903,10 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
     if (material.shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
     if (material.shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
 
-    // Create instances buffer
-    instanceTransforms = (float16 *)RL_MALLOC(instances*sizeof(float16));
-
-    // Fill buffer with instances transformations as float16 arrays
-    for (int i = 0; i < instances; i++) instanceTransforms[i] = MatrixToFloatV(transforms[i]);
-
-    // Enable mesh VAO to attach new buffer
+    // Enable mesh VAO and instances buffer to attach it
+    // NOTE: Attributes are set on every draw, the same mesh can be drawn with different instance buffers
     rlEnableVertexArray(mesh.vaoId);
-
-    // This could alternatively use a static VBO and either glMapBuffer() or glBufferSubData()
-    // It isn't clear which would be reliably faster in all cases and on all platforms,
-    // anecdotally glMapBuffer() seems very slow (syncs) while glBufferSubData() seems
-    // no faster, since we're transferring all the transform matrices anyway
-    instancesVboId = rlLoadVertexBuffer(instanceTransforms, instances*sizeof(float16), false);
+    rlEnableVertexBuffer(instancesVboId);
 
     // Instances transformation matrices are send to shader attribute location: SHADER_LOC_MATRIX_MODEL
     for (unsigned int i = 0; i < 4; i++)
@@ -1904,13 +2078,97 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
 
     // Disable shader program
     rlDisableShader();
+}
+#endif
+
+// Load instance transforms buffer in GPU (VRAM)
+InstanceBuffer LoadInstanceBuffer(int capacity)
+{
+    InstanceBuffer buffer = { 0 };
+
+    if (capacity > 0)
+    {
+        buffer.id = rlLoadVertexBuffer(NULL, capacity*sizeof(float16), true);
+        if (buffer.id > 0) buffer.capacity = capacity;
+        else TRACELOG(LOG_WARNING, "MODEL: Failed to load instance buffer");
+    }
+
+    return buffer;
+}
 
-    // Remove instance transforms buffer
-    rlUnloadVertexBuffer(instancesVboId);
-    RL_FREE(instanceTransforms);
+// Update instance transforms range
+// NOTE: Buffer grows (contents discarded) when an update from offset 0 does not fit,
+// partial updates out of buffer capacity are ignored
+void UpdateInstanceBuffer(InstanceBuffer *buffer, const Matrix *transforms, int offset, int count)
+{
+    if ((buffer == NULL) || (transforms == NULL) || (count <= 0)) return;
+
+    if (count > instancesDataCapacity)
+    {
+        float16 *data = (float16 *)RL_REALLOC(instancesData, count*sizeof(float16));
+        if (data == NULL)
+        {
+            TRACELOG(LOG_WARNING, "MODEL: Failed to allocate instance transforms packing buffer");
+            return;
+        }
+
+        instancesData = data;
+        instancesDataCapacity = count;
+    }
+
+    // Pack transforms as column-major float16 arrays, the layout expected by shader attributes
+    for (int i = 0; i < count; i++) instancesData[i] = MatrixToFloatV(transforms[i]);
+
+    UpdateInstanceBufferData(buffer, (const float *)instancesData, offset, count);
+}
+
+// Update instance transforms range with pre-packed data (16 floats per instance, column-major)
+void UpdateInstanceBufferData(InstanceBuffer *buffer, const float *data, int offset, int count)
+{
+    if ((buffer == NULL) || (data == NULL) || (count <= 0)) return;
+    if (!ReserveInstanceBuffer(buffer, offset, count)) return;
+
+    // Buffer storage is orphaned when its whole used range is rewritten, so upload does not
+    // wait for previous draws still using it (internal buffer only draws the range updated)
+    if ((offset == 0) && ((count == buffer->capacity) || (buffer == &instancesBuffer))) rlOrphanVertexBuffer(buffer->id, buffer->capacity*sizeof(float16), true);
+
+    rlUpdateVertexBuffer(buffer->id, data, count*sizeof(float16), offset*sizeof(float16));
+}
+
+// Unload instance transforms buffer from GPU (VRAM)
+void UnloadInstanceBuffer(InstanceBuffer buffer)
+{
+    if (buffer.id > 0) rlUnloadVertexBuffer(buffer.id);
+}
+
+// Draw multiple mesh instances with material and transforms from instance buffer
+void DrawMeshInstancedBuffer(Mesh mesh, Material material, InstanceBuffer buffer, int instances)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((buffer.id == 0) || (instances <= 0)) return;
+
+    if (instances > buffer.capacity)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: Instances requested (%i) exceed instance buffer capacity (%i)", instances, buffer.capacity);
+        instances = buffer.capacity;
+    }
+
+    DrawMeshInstancedVbo(mesh, material, buffer.id, instances);
 #endif
 }
 
+// Unload internal instancing data
+// NOTE: Called by CloseWindow() while graphics context is still available
+void UnloadMeshInstancingData(void)
+{
+    UnloadInstanceBuffer(instancesBuffer);
+    instancesBuffer = (InstanceBuffer){ 0 };
+
+    RL_FREE(instancesData);
+    instancesData = NULL;
+    instancesDataCapacity = 0;
+}
+
 // Unload mesh from memory (RAM and VRAM)
 void UnloadMesh(Mesh mesh)
 {
@@ -1933,6 +2191,8 @@ void UnloadMesh(Mesh mesh)
     RL_FREE(mesh.boneWeights);
     RL_FREE(mesh.boneIds);
     RL_FREE(mesh.boneMatrices);
+
+    UnloadMeshBVH(mesh.bvh);
 }
 
 // Export mesh data to file
@@ -2267,108 +2527,96 @@ ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount)
 // to be uploaded to shader at drawing, in case GPU skinning is enabled
 void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame)
 {
-    if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.framePoses != NULL))
-    {
-        if (frame >= anim.frameCount) frame = frame%anim.frameCount;
-
-        for (int i = 0; i < model.meshCount; i++)
-        {
-            if (model.meshes[i].boneMatrices)
-            {
-                assert(model.meshes[i].boneCount == anim.boneCount);
-
-                for (int boneId = 0; boneId < model.meshes[i].boneCount; boneId++)
-                {
-                    Vector3 inTranslation = model.bindPose[boneId].translation;
-                    Quaternion inRotation = model.bindPose[boneId].rotation;
-                    Vector3 inScale = model.bindPose[boneId].scale;
-
-                    Vector3 outTranslation = anim.framePoses[frame][boneId].translation;
-                    Quaternion outRotation = anim.framePoses[frame][boneId].rotation;
-                    Vector3 outScale = anim.framePoses[frame][boneId].scale;
-
-                    Vector3 invTranslation = Vector3RotateByQuaternion(Vector3Negate(inTranslation), QuaternionInvert(inRotation));
-                    Quaternion invRotation = QuaternionInvert(inRotation);
-                    Vector3 invScale = Vector3Divide((Vector3){ 1.0f, 1.0f, 1.0f }, inScale);
-
-                    Vector3 boneTranslation = Vector3Add(
-                        Vector3RotateByQuaternion(Vector3Multiply(outScale, invTranslation),
-                        outRotation), outTranslation);
-                    Quaternion boneRotation = QuaternionMultiply(outRotation, invRotation);
-                    Vector3 boneScale = Vector3Multiply(outScale, invScale);
-
-                    Matrix boneMatrix = MatrixMultiply(MatrixMultiply(
-                        QuaternionToMatrix(boneRotation),
-                        MatrixTranslate(boneTranslation.x, boneTranslation.y, boneTranslation.z)),
-                        MatrixScale(boneScale.x, boneScale.y, boneScale.z));
-
-                    model.meshes[i].boneMatrices[boneId] = boneMatrix;
-                }
-            }
-        }
-    }
+    UpdateModelBoneMatrices(model, anim, frame);
 }
 
-// at least 2x speed up vs the old method 
 // Update model animated vertex data (positions and normals) for a given frame
 // NOTE: Updated data is uploaded to GPU
 void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
 {
-    UpdateModelAnimationBones(model,anim,frame);
-    for (int m = 0; m < model.meshCount; m++)
+    UpdateModelAnimationsBatch(&model, &anim, &frame, 1);
+}
+
+// Update multiple models animated vertex data (positions and normals) for given frames
+// NOTE: Meshes skinning is split across job system worker threads, updated data is uploaded
+// to GPU on calling thread once all meshes are processed, models must not share meshes data
+void UpdateModelAnimationsBatch(Model *models, ModelAnimation *anims, int *frames, int count)
+{
+    if ((models == NULL) || (anims == NULL) || (frames == NULL) || (count <= 0)) return;
+
+    int jobCount = 0;
+    int paletteSize = 0;
+
+    for (int i = 0; i < count; i++)
     {
-        Mesh mesh = model.meshes[m];
-        Vector3 animVertex = { 0 };
-        Vector3 animNormal = { 0 };
-        int boneId = 0;
-        int boneCounter = 0;
-        float boneWeight = 0.0;
-        bool updated = false;           // Flag to check when anim vertex information is updated
-        const int vValues = mesh.vertexCount*3;
-        for (int vCounter = 0; vCounter < vValues; vCounter += 3)
+        for (int m = 0; m < models[i].meshCount; m++)
         {
-            mesh.animVertices[vCounter] = 0;
-            mesh.animVertices[vCounter + 1] = 0;
-            mesh.animVertices[vCounter + 2] = 0;
-            if (mesh.animNormals != NULL)
-            {
-                mesh.animNormals[vCounter] = 0;
-                mesh.animNormals[vCounter + 1] = 0;
-                mesh.animNormals[vCounter + 2] = 0;
-            }
-                // Iterates over 4 bones per vertex
-            for (int j = 0; j < 4; j++, boneCounter++)
-            {
-                boneWeight = mesh.boneWeights[boneCounter];
-                boneId = mesh.boneIds[boneCounter];
-                // Early stop when no transformation will be applied
-                if (boneWeight == 0.0f) continue;
-                animVertex = (Vector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
-                animVertex = Vector3Transform(animVertex,model.meshes[m].boneMatrices[boneId]);
-                mesh.animVertices[vCounter] += animVertex.x * boneWeight;
-                mesh.animVertices[vCounter+1] += animVertex.y * boneWeight;
-                mesh.animVertices[vCounter+2] += animVertex.z * boneWeight;
-                updated = true;
-                // Normals processing
-                // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-                if (mesh.normals != NULL)
-                {
-                    animNormal = (Vector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
-                    animNormal = Vector3Transform(animNormal,model.meshes[m].boneMatrices[boneId]);
-                    mesh.animNormals[vCounter] += animNormal.x*boneWeight;
-                    mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
-                    mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
-                }
-            }
+            jobCount++;
+            paletteSize += models[i].meshes[m].boneCount*16;
         }
-        if (updated)
+    }
+
+    if (jobCount == 0) return;
+
+    // Jobs and palettes share a scratch buffer, only grown when required
+    // NOTE: Animations update requires GPU upload, so scratch buffer is only used from main thread
+    int jobsSize = jobCount*sizeof(SkinningJob);
+    int scratchSize = jobsSize + (paletteSize + 16)*sizeof(float);
+
+    if (scratchSize > skinningScratchSize)
+    {
+        unsigned char *scratch = (unsigned char *)RL_REALLOC(skinningScratch, scratchSize);
+        if (scratch == NULL)
+        {
+            TRACELOG(LOG_WARNING, "MODEL: Failed to allocate skinning scratch memory");
+            return;
+        }
+
+        skinningScratch = scratch;
+        skinningScratchSize = scratchSize;
+    }
+
+    SkinningJob *jobs = (SkinningJob *)skinningScratch;
+    float *palette = (float *)(skinningScratch + jobsSize);
+    memset(jobs, 0, jobsSize);
+
+    for (int i = 0, j = 0, offset = 0; i < count; i++)
+    {
+        for (int m = 0; m < models[i].meshCount; m++, j++)
+        {
+            jobs[j].mesh = models[i].meshes[m];
+            jobs[j].palette = palette + offset;
+            offset += models[i].meshes[m].boneCount*16;
+        }
+    }
+
+    // Bone matrices are computed once per model, then meshes are skinned
+    AnimationBatch batch = { models, anims, frames };
+    RunJobs(ProcessBonesJob, &batch, count);
+    RunJobs(ProcessSkinningJob, jobs, jobCount);
+
+    // Upload updated vertex data to GPU, it must be done on calling thread
+    for (int j = 0; j < jobCount; j++)
+    {
+        if (jobs[j].updated)
         {
+            Mesh mesh = jobs[j].mesh;
+
             rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
-            rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
+            if (mesh.animNormals != NULL) rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
         }
     }
 }
 
+// Unload internal skinning scratch memory
+// NOTE: Called by CloseWindow() once job system workers are stopped
+void UnloadModelAnimationsScratch(void)
+{
+    RL_FREE(skinningScratch);
+    skinningScratch = NULL;
+    skinningScratchSize = 0;
+}
+
 // Unload animation array data
 void UnloadModelAnimations(ModelAnimation *animations, int animCount)
 {
@@ -3689,6 +3937,123 @@ void GenMeshTangents(Mesh *mesh)
     TRACELOG(LOG_INFO, "MESH: Tangents data computed and uploaded for provided mesh");
 }
 
+// Generate mesh bounding volume hierarchy, accelerates ray collision queries
+// NOTE: Built from mesh CPU vertex data (mesh.vertices), it must be generated again if vertex data changes
+void GenMeshBVH(Mesh *mesh)
+{
+    if ((mesh->vertices == NULL) || (mesh->triangleCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: BVH generation requires vertex position data");
+        return;
+    }
+
+    UnloadMeshBVH(mesh->bvh);
+
+    int triangleCount = mesh->triangleCount;
+    rMeshBVH *bvh = (rMeshBVH *)RL_CALLOC(1, sizeof(rMeshBVH));
+    bvh->triangles = (int *)RL_MALLOC(triangleCount*sizeof(int));
+    bvh->nodes = (MeshBVHNode *)RL_CALLOC(2*triangleCount, sizeof(MeshBVHNode));   // Binary tree, never more than 2*n - 1 nodes
+
+    // Triangles centroids, used to split nodes
+    Vector3 *centroids = (Vector3 *)RL_MALLOC(triangleCount*sizeof(Vector3));
+
+    for (int i = 0; i < triangleCount; i++)
+    {
+        Vector3 a, b, c;
+        GetMeshTriangle(*mesh, i, &a, &b, &c);
+
+        bvh->triangles[i] = i;
+        centroids[i] = Vector3Scale(Vector3Add(Vector3Add(a, b), c), 1.0f/3.0f);
+    }
+
+    // Root node contains all triangles, nodes are split iteratively
+    bvh->nodes[0].start = 0;
+    bvh->nodes[0].count = triangleCount;
+    bvh->nodeCount = 1;
+
+    int stack[MESH_BVH_MAX_DEPTH + 2] = { 0 };
+    int depths[MESH_BVH_MAX_DEPTH + 2] = { 0 };
+    int stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0)
+    {
+        stackSize--;
+        MeshBVHNode *node = &bvh->nodes[stack[stackSize]];
+        int depth = depths[stackSize];
+
+        // Compute node bounds and triangles centroids bounds
+        Vector3 centerMin = { FLT_MAX, FLT_MAX, FLT_MAX };
+        Vector3 centerMax = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+        node->min = centerMin;
+        node->max = centerMax;
+
+        for (int i = node->start; i < node->start + node->count; i++)
+        {
+            Vector3 a, b, c;
+            GetMeshTriangle(*mesh, bvh->triangles[i], &a, &b, &c);
+
+            node->min = Vector3Min(node->min, Vector3Min(a, Vector3Min(b, c)));
+            node->max = Vector3Max(node->max, Vector3Max(a, Vector3Max(b, c)));
+            centerMin = Vector3Min(centerMin, centroids[bvh->triangles[i]]);
+            centerMax = Vector3Max(centerMax, centroids[bvh->triangles[i]]);
+        }
+
+        if ((node->count <= MESH_BVH_LEAF_TRIANGLES) || (depth >= MESH_BVH_MAX_DEPTH)) continue;
+
+        // Split along centroids bounds longest axis, at middle position
+        Vector3 extent = Vector3Subtract(centerMax, centerMin);
+        int axis = 0;
+        if (extent.y > extent.x) axis = 1;
+        if (extent.z > ((axis == 0)? extent.x : extent.y)) axis = 2;
+
+        float split = (axis == 0)? (centerMin.x + centerMax.x)*0.5f : (axis == 1)? (centerMin.y + centerMax.y)*0.5f : (centerMin.z + centerMax.z)*0.5f;
+
+        int i = node->start;
+        int j = node->start + node->count - 1;
+
+        while (i <= j)
+        {
+            Vector3 center = centroids[bvh->triangles[i]];
+            float value = (axis == 0)? center.x : (axis == 1)? center.y : center.z;
+
+            if (value < split) i++;
+            else
+            {
+                int temp = bvh->triangles[i];
+                bvh->triangles[i] = bvh->triangles[j];
+                bvh->triangles[j--] = temp;
+            }
+        }
+
+        // All centroids on one side (overlapping triangles), split by count
+        int leftCount = i - node->start;
+        if ((leftCount == 0) || (leftCount == node->count)) leftCount = node->count/2;
+
+        int left = bvh->nodeCount;
+        bvh->nodes[left].start = node->start;
+        bvh->nodes[left].count = leftCount;
+        bvh->nodes[left + 1].start = node->start + leftCount;
+        bvh->nodes[left + 1].count = node->count - leftCount;
+        bvh->nodeCount += 2;
+
+        // Convert node to inner node, children are consecutive
+        node->start = left;
+        node->count = 0;
+
+        depths[stackSize] = depth + 1;
+        stack[stackSize++] = left;
+        depths[stackSize] = depth + 1;
+        stack[stackSize++] = left + 1;
+    }
+
+    RL_FREE(centroids);
+
+    mesh->bvh = bvh;
+
+    TRACELOG(LOG_INFO, "MESH: BVH generated successfully (%i triangles, %i nodes)", triangleCount, bvh->nodeCount);
+}
+
 // Draw a model (with texture if set)
 void DrawModel(Model model, Vector3 position, float scale, Color tint)
 {
@@ -4044,26 +4409,17 @@ RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
     // Check if mesh vertex data on CPU for testing
     if (mesh.vertices != NULL)
     {
+        // Ray is transformed into mesh space instead of transforming all mesh triangles,
+        // only possible if transform can be inverted
+        if (IsTransformInvertible(transform)) return GetRayCollisionMeshSpace(ray, mesh, transform, MatrixInvert(transform));
+
         int triangleCount = mesh.triangleCount;
 
         // Test against all triangles in mesh
         for (int i = 0; i < triangleCount; i++)
         {
             Vector3 a, b, c;
-            Vector3* vertdata = (Vector3*)mesh.vertices;
-
-            if (mesh.indices)
-            {
-                a = vertdata[mesh.indices[i*3 + 0]];
-                b = vertdata[mesh.indices[i*3 + 1]];
-                c = vertdata[mesh.indices[i*3 + 2]];
-            }
-            else
-            {
-                a = vertdata[i*3 + 0];
-                b = vertdata[i*3 + 1];
-                c = vertdata[i*3 + 2];
-            }
+            GetMeshTriangle(mesh, i, &a, &b, &c);
 
             a = Vector3Transform(a, transform);
             b = Vector3Transform(b, transform);
@@ -4082,6 +4438,22 @@ RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
     return collision;
 }
 
+// Get collision info between multiple rays and mesh
+// NOTE: Rays are split in groups processed by job system, collisions array must fit rayCount elements
+void GetRayCollisionMeshBatch(const Ray *rays, int rayCount, Mesh mesh, Matrix transform, RayCollision *collisions)
+{
+    if ((rays == NULL) || (collisions == NULL) || (rayCount <= 0)) return;
+
+    if ((mesh.vertices == NULL) || !IsTransformInvertible(transform))
+    {
+        for (int i = 0; i < rayCount; i++) collisions[i] = GetRayCollisionMesh(rays[i], mesh, transform);
+        return;
+    }
+
+    RayCollisionBatch batch = { rays, rayCount, mesh, transform, MatrixInvert(transform), collisions };
+    RunJobs(ProcessRayCollisionJob, &batch, (rayCount + RAY_COLLISION_JOB_RAYS - 1)/RAY_COLLISION_JOB_RAYS);
+}
+
 // Get collision info between ray and triangle
 // NOTE: The points are expected to be in counter-clockwise winding
 // NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
@@ -4158,6 +4530,411 @@ RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Ve
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Load bind pose inverse transforms
+// NOTE: Computed once on model loading, required to build animated bone matrices
+static Transform *LoadInverseBindPose(const Transform *bindPose, int boneCount)
+{
+    if ((bindPose == NULL) || (boneCount <= 0)) return NULL;
+
+    Transform *invBindPose = (Transform *)RL_MALLOC(boneCount*sizeof(Transform));
+
+    for (int i = 0; i < boneCount; i++)
+    {
+        invBindPose[i].rotation = QuaternionInvert(bindPose[i].rotation);
+        invBindPose[i].translation = Vector3RotateByQuaternion(Vector3Negate(bindPose[i].translation), invBindPose[i].rotation);
+        invBindPose[i].scale = Vector3Divide((Vector3){ 1.0f, 1.0f, 1.0f }, bindPose[i].scale);
+    }
+
+    return invBindPose;
+}
+
+// Update model meshes bone matrices for a given frame
+// NOTE: Bone matrices are computed once into first skinned mesh and copied to the other meshes,
+// every bone matrix is built directly from animated TRS combined with cached inverse bind pose
+static void UpdateModelBoneMatrices(Model model, ModelAnimation anim, int frame)
+{
+    if ((anim.frameCount <= 0) || (anim.bones == NULL) || (anim.framePoses == NULL) || (model.bindPose == NULL)) return;
+
+    if (frame >= anim.frameCount) frame = frame%anim.frameCount;
+
+    // Bind pose arrays are sized by model bones count
+    int boneCount = (anim.boneCount < model.boneCount)? anim.boneCount : model.boneCount;
+    Matrix *boneMatrices = NULL;
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        if (model.meshes[i].boneMatrices == NULL) continue;
+
+        assert(model.meshes[i].boneCount == anim.boneCount);
+
+        // Meshes not matching animation bones are skipped, bone matrices array is sized by mesh bones count
+        if (model.meshes[i].boneCount != anim.boneCount) continue;
+
+        if (boneMatrices != NULL)
+        {
+            memcpy(model.meshes[i].boneMatrices, boneMatrices, boneCount*sizeof(Matrix));
+            continue;
+        }
+
+        boneMatrices = model.meshes[i].boneMatrices;
+
+        for (int boneId = 0; boneId < boneCount; boneId++)
+        {
+            Transform inv = { 0 };
+
+            if (model.invBindPose != NULL) inv = model.invBindPose[boneId];
+            else
+            {
+                // Model without cached inverse bind pose (not loaded from file), compute it
+                inv.rotation = QuaternionInvert(model.bindPose[boneId].rotation);
+                inv.translation = Vector3RotateByQuaternion(Vector3Negate(model.bindPose[boneId].translation), inv.rotation);
+                inv.scale = Vector3Divide((Vector3){ 1.0f, 1.0f, 1.0f }, model.bindPose[boneId].scale);
+            }
+
+            Transform out = anim.framePoses[frame][boneId];
+
+            Vector3 t = Vector3Add(Vector3RotateByQuaternion(Vector3Multiply(out.scale, inv.translation), out.rotation), out.translation);
+            Vector3 s = Vector3Multiply(out.scale, inv.scale);
+            Matrix boneMatrix = QuaternionToMatrix(QuaternionMultiply(out.rotation, inv.rotation));
+
+            // Same as: QuaternionToMatrix()*MatrixTranslate(t)*MatrixScale(s), without matrix multiplications
+            boneMatrix.m0 *= s.x; boneMatrix.m4 *= s.x; boneMatrix.m8 *= s.x; boneMatrix.m12 = t.x*s.x;
+            boneMatrix.m1 *= s.y; boneMatrix.m5 *= s.y; boneMatrix.m9 *= s.y; boneMatrix.m13 = t.y*s.y;
+            boneMatrix.m2 *= s.z; boneMatrix.m6 *= s.z; boneMatrix.m10 *= s.z; boneMatrix.m14 = t.z*s.z;
+
+            boneMatrices[boneId] = boneMatrix;
+        }
+    }
+}
+
+// Process model bone matrices job
+// NOTE: Called from job system worker threads, no GPU access allowed
+static void ProcessBonesJob(void *userData, int index)
+{
+    AnimationBatch *batch = (AnimationBatch *)userData;
+
+    UpdateModelBoneMatrices(batch->models[index], batch->anims[index], batch->frames[index]);
+}
+
+// Process mesh skinning job
+// NOTE: Called from job system worker threads, no GPU access allowed
+static void ProcessSkinningJob(void *userData, int index)
+{
+    SkinningJob *job = &((SkinningJob *)userData)[index];
+
+    job->updated = SkinMeshVertices(job->mesh, job->palette);
+}
+
+// Get mesh triangle vertex positions (indexed or not)
+static void GetMeshTriangle(Mesh mesh, int index, Vector3 *a, Vector3 *b, Vector3 *c)
+{
+    Vector3 *vertdata = (Vector3 *)mesh.vertices;
+
+    if (mesh.indices)
+    {
+        *a = vertdata[mesh.indices[index*3 + 0]];
+        *b = vertdata[mesh.indices[index*3 + 1]];
+        *c = vertdata[mesh.indices[index*3 + 2]];
+    }
+    else
+    {
+        *a = vertdata[index*3 + 0];
+        *b = vertdata[index*3 + 1];
+        *c = vertdata[index*3 + 2];
+    }
+}
+
+// Unload mesh bounding volume hierarchy
+static void UnloadMeshBVH(rMeshBVH *bvh)
+{
+    if (bvh == NULL) return;
+
+    RL_FREE(bvh->nodes);
+    RL_FREE(bvh->triangles);
+    RL_FREE(bvh);
+}
+
+// Check ray against node bounds (slab test), returns entry distance or -1.0f if missed (or farther than maxDistance)
+static float GetRayNodeDistance(Vector3 origin, Vector3 invDir, const MeshBVHNode *node, float maxDistance)
+{
+    float t1 = (node->min.x - origin.x)*invDir.x;
+    float t2 = (node->max.x - origin.x)*invDir.x;
+    float tmin = fminf(t1, t2);
+    float tmax = fmaxf(t1, t2);
+
+    t1 = (node->min.y - origin.y)*invDir.y;
+    t2 = (node->max.y - origin.y)*invDir.y;
+    tmin = fmaxf(tmin, fminf(t1, t2));
+    tmax = fminf(tmax, fmaxf(t1, t2));
+
+    t1 = (node->min.z - origin.z)*invDir.z;
+    t2 = (node->max.z - origin.z)*invDir.z;
+    tmin = fmaxf(tmin, fminf(t1, t2));
+    tmax = fminf(tmax, fmaxf(t1, t2));
+
+    if ((tmax < 0.0f) || (tmin > tmax) || (tmin > maxDistance)) return -1.0f;
+
+    return fmaxf(tmin, 0.0f);
+}
+
+// Get closest mesh triangle collision info, ray must be in mesh space
+// NOTE: Uses mesh BVH if available, all triangles are tested otherwise
+static RayCollision GetRayClosestMeshCollision(Ray ray, Mesh mesh)
+{
+    RayCollision closest = { 0 };
+    float closestDistance = FLT_MAX;
+    rMeshBVH *bvh = mesh.bvh;
+
+    if (bvh == NULL)
+    {
+        for (int i = 0; i < mesh.triangleCount; i++)
+        {
+            Vector3 a, b, c;
+            GetMeshTriangle(mesh, i, &a, &b, &c);
+
+            RayCollision hit = GetRayCollisionTriangle(ray, a, b, c);
+            if (hit.hit && (hit.distance < closestDistance)) { closestDistance = hit.distance; closest = hit; }
+        }
+
+        return closest;
+    }
+
+    // NOTE: Division by zero direction components produces infinities, handled by slab test
+    Vector3 invDir = { 1.0f/ray.direction.x, 1.0f/ray.direction.y, 1.0f/ray.direction.z };
+
+    int stack[MESH_BVH_MAX_DEPTH + 2] = { 0 };     // NOTE: Never more nodes pending than BVH depth + 1
+    int stackSize = 0;
+    if (GetRayNodeDistance(ray.position, invDir, &bvh->nodes[0], closestDistance) >= 0.0f) stack[stackSize++] = 0;
+
+    while (stackSize > 0)
+    {
+        const MeshBVHNode *node = &bvh->nodes[stack[--stackSize]];
+
+        if (node->count > 0)
+        {
+            // Leaf node, test triangles
+            for (int i = node->start; i < node->start + node->count; i++)
+            {
+                Vector3 a, b, c;
+                GetMeshTriangle(mesh, bvh->triangles[i], &a, &b, &c);
+
+                RayCollision hit = GetRayCollisionTriangle(ray, a, b, c);
+                if (hit.hit && (hit.distance < closestDistance)) { closestDistance = hit.distance; closest = hit; }
+            }
+        }
+        else
+        {
+            // Inner node, visit closest child first (pushed last)
+            float leftDistance = GetRayNodeDistance(ray.position, invDir, &bvh->nodes[node->start], closestDistance);
+            float rightDistance = GetRayNodeDistance(ray.position, invDir, &bvh->nodes[node->start + 1], closestDistance);
+
+            if ((leftDistance >= 0.0f) && (rightDistance >= 0.0f))
+            {
+                bool leftFirst = (leftDistance <= rightDistance);
+                stack[stackSize++] = leftFirst? node->start + 1 : node->start;
+                stack[stackSize++] = leftFirst? node->start : node->start + 1;
+            }
+            else if (leftDistance >= 0.0f) stack[stackSize++] = node->start;
+            else if (rightDistance >= 0.0f) stack[stackSize++] = node->start + 1;
+        }
+    }
+
+    return closest;
+}
+
+// Process rays collision job, one job per rays group
+// NOTE: Called from job system worker threads
+static void ProcessRayCollisionJob(void *userData, int index)
+{
+    RayCollisionBatch *batch = (RayCollisionBatch *)userData;
+
+    int end = (index + 1)*RAY_COLLISION_JOB_RAYS;
+    if (end > batch->rayCount) end = batch->rayCount;
+
+    for (int i = index*RAY_COLLISION_JOB_RAYS; i < end; i++) batch->collisions[i] = GetRayCollisionMeshSpace(batch->rays[i], batch->mesh, batch->transform, batch->invTransform);
+}
+
+// Get collision info between ray and mesh, ray is tested in mesh space
+// NOTE: Mesh space ray is the affine image of world ray, so hit distance along the ray is the same in both spaces,
+// hit point is recomputed from world ray and normal is transformed back with the inverse transpose of transform
+static RayCollision GetRayCollisionMeshSpace(Ray ray, Mesh mesh, Matrix transform, Matrix invTransform)
+{
+    Ray meshRay = { 0 };
+    meshRay.position = Vector3Transform(ray.position, invTransform);
+    meshRay.direction = Vector3Subtract(Vector3Transform(Vector3Add(ray.position, ray.direction), invTransform), meshRay.position);
+
+    RayCollision collision = GetRayClosestMeshCollision(meshRay, mesh);
+
+    if (collision.hit)
+    {
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+
+        // NOTE: Triangle normal comes from edges cross product, mirroring transforms flip its orientation
+        Vector3 normal = Vector3Normalize(Vector3Transform(collision.normal, MatrixTranspose(invTransform)));
+        if (MatrixDeterminant(transform) < 0.0f) normal = Vector3Negate(normal);
+        collision.normal = normal;
+    }
+
+    return collision;
+}
+
+// Check if transform can be inverted
+// NOTE: Determinant is compared relative to transform axis scales, so an uniform scale
+// (whatever its factor) is never considered singular, only degenerated axis are
+static bool IsTransformInvertible(Matrix transform)
+{
+    float det = MatrixDeterminant(transform);
+    float scale = Vector3Length((Vector3){ transform.m0, transform.m1, transform.m2 })*
+                  Vector3Length((Vector3){ transform.m4, transform.m5, transform.m6 })*
+                  Vector3Length((Vector3){ transform.m8, transform.m9, transform.m10 });
+
+    return (scale > 0.0f) && (fabsf(det) > 0.000001f*scale);
+}
+
+// Skin mesh vertices and normals with current bone matrices (linear blend skinning)
+// NOTE: Bone matrices are packed into a palette of 4 columns (x, y, z, 0) per bone, every vertex
+// blends the columns of its non-zero weight bones once and transforms position and normal with
+// the blended matrix in the same pass, palette must fit 16 floats per mesh bone
+// Returns true if any vertex was skinned
+static bool SkinMeshVertices(Mesh mesh, float *palette)
+{
+    if ((mesh.boneMatrices == NULL) || (mesh.boneIds == NULL) || (mesh.boneWeights == NULL) ||
+        (mesh.vertices == NULL) || (mesh.animVertices == NULL)) return false;
+
+    for (int b = 0; b < mesh.boneCount; b++)
+    {
+        const Matrix mat = mesh.boneMatrices[b];
+        float *col = palette + b*16;
+
+        col[0] = mat.m0; col[1] = mat.m1; col[2] = mat.m2; col[3] = 0.0f;
+        col[4] = mat.m4; col[5] = mat.m5; col[6] = mat.m6; col[7] = 0.0f;
+        col[8] = mat.m8; col[9] = mat.m9; col[10] = mat.m10; col[11] = 0.0f;
+        col[12] = mat.m12; col[13] = mat.m13; col[14] = mat.m14; col[15] = 0.0f;
+    }
+
+    const float *vertices = mesh.vertices;
+    const float *normals = mesh.normals;
+    const float *weights = mesh.boneWeights;
+    const unsigned char *ids = mesh.boneIds;
+    float *animVertices = mesh.animVertices;
+    float *animNormals = mesh.animNormals;
+    bool updated = false;
+
+    for (int v = 0; v < mesh.vertexCount; v++, vertices += 3, weights += 4, ids += 4, animVertices += 3)
+    {
+        const float *vn = (normals != NULL)? normals + v*3 : NULL;
+        float *avn = (animNormals != NULL)? animNormals + v*3 : NULL;
+
+#if defined(SKINNING_SSE)
+        // Skip all zero-weight bones at once
+        int mask = _mm_movemask_ps(_mm_cmpneq_ps(_mm_loadu_ps(weights), _mm_setzero_ps()));
+#else
+        int mask = ((weights[0] != 0.0f)? 1 : 0) | ((weights[1] != 0.0f)? 2 : 0) |
+                   ((weights[2] != 0.0f)? 4 : 0) | ((weights[3] != 0.0f)? 8 : 0);
+#endif
+        if (mask == 0)
+        {
+            animVertices[0] = animVertices[1] = animVertices[2] = 0.0f;
+            if (avn != NULL) avn[0] = avn[1] = avn[2] = 0.0f;
+            continue;
+        }
+
+        updated = true;
+
+#if defined(SKINNING_SSE)
+        __m128 c0 = _mm_setzero_ps(), c1 = _mm_setzero_ps(), c2 = _mm_setzero_ps(), c3 = _mm_setzero_ps();
+
+        for (int j = 0; j < 4; j++)
+        {
+            if (!(mask & (1 << j))) continue;
+
+            const float *col = palette + ids[j]*16;
+            const __m128 w = _mm_set1_ps(weights[j]);
+            c0 = _mm_add_ps(c0, _mm_mul_ps(w, _mm_loadu_ps(col)));
+            c1 = _mm_add_ps(c1, _mm_mul_ps(w, _mm_loadu_ps(col + 4)));
+            c2 = _mm_add_ps(c2, _mm_mul_ps(w, _mm_loadu_ps(col + 8)));
+            c3 = _mm_add_ps(c3, _mm_mul_ps(w, _mm_loadu_ps(col + 12)));
+        }
+
+        __m128 pos = _mm_add_ps(_mm_add_ps(c3, _mm_mul_ps(c0, _mm_set1_ps(vertices[0]))),
+                                _mm_add_ps(_mm_mul_ps(c1, _mm_set1_ps(vertices[1])), _mm_mul_ps(c2, _mm_set1_ps(vertices[2]))));
+        _mm_storel_pi((__m64 *)animVertices, pos);
+        _mm_store_ss(animVertices + 2, _mm_movehl_ps(pos, pos));
+
+        if (avn != NULL)
+        {
+            if (vn != NULL)
+            {
+                __m128 nrm = _mm_add_ps(_mm_add_ps(c3, _mm_mul_ps(c0, _mm_set1_ps(vn[0]))),
+                                        _mm_add_ps(_mm_mul_ps(c1, _mm_set1_ps(vn[1])), _mm_mul_ps(c2, _mm_set1_ps(vn[2]))));
+                _mm_storel_pi((__m64 *)avn, nrm);
+                _mm_store_ss(avn + 2, _mm_movehl_ps(nrm, nrm));
+            }
+            else avn[0] = avn[1] = avn[2] = 0.0f;
+        }
+#elif defined(SKINNING_NEON)
+        float32x4_t c0 = vdupq_n_f32(0.0f), c1 = vdupq_n_f32(0.0f), c2 = vdupq_n_f32(0.0f), c3 = vdupq_n_f32(0.0f);
+
+        for (int j = 0; j < 4; j++)
+        {
+            if (!(mask & (1 << j))) continue;
+
+            const float *col = palette + ids[j]*16;
+            const float w = weights[j];
+            c0 = vmlaq_n_f32(c0, vld1q_f32(col), w);
+            c1 = vmlaq_n_f32(c1, vld1q_f32(col + 4), w);
+            c2 = vmlaq_n_f32(c2, vld1q_f32(col + 8), w);
+            c3 = vmlaq_n_f32(c3, vld1q_f32(col + 12), w);
+        }
+
+        float32x4_t pos = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(c3, c0, vertices[0]), c1, vertices[1]), c2, vertices[2]);
+        vst1_f32(animVertices, vget_low_f32(pos));
+        vst1q_lane_f32(animVertices + 2, pos, 2);
+
+        if (avn != NULL)
+        {
+            if (vn != NULL)
+            {
+                float32x4_t nrm = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(c3, c0, vn[0]), c1, vn[1]), c2, vn[2]);
+                vst1_f32(avn, vget_low_f32(nrm));
+                vst1q_lane_f32(avn + 2, nrm, 2);
+            }
+            else avn[0] = avn[1] = avn[2] = 0.0f;
+        }
+#else
+        float c[16] = { 0 };
+
+        for (int j = 0; j < 4; j++)
+        {
+            if (!(mask & (1 << j))) continue;
+
+            const float *col = palette + ids[j]*16;
+            const float w = weights[j];
+            for (int k = 0; k < 16; k++) c[k] += w*col[k];
+        }
+
+        float x = vertices[0], y = vertices[1], z = vertices[2];
+        animVertices[0] = c[0]*x + c[4]*y + c[8]*z + c[12];
+        animVertices[1] = c[1]*x + c[5]*y + c[9]*z + c[13];
+        animVertices[2] = c[2]*x + c[6]*y + c[10]*z + c[14];
+
+        if (avn != NULL)
+        {
+            if (vn != NULL)
+            {
+                x = vn[0]; y = vn[1]; z = vn[2];
+                avn[0] = c[0]*x + c[4]*y + c[8]*z + c[12];
+                avn[1] = c[1]*x + c[5]*y + c[9]*z + c[13];
+                avn[2] = c[2]*x + c[6]*y + c[10]*z + c[14];
+            }
+            else avn[0] = avn[1] = avn[2] = 0.0f;
+        }
+#endif
+    }
+
+    return updated;
+}
+
 #if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
 // Build pose from parent joints
 // NOTE: Required for animations loading (required by IQM and GLTF)
@@ -4437,9 +5214,9 @@ static Model LoadIQM(const char *fileName)
     #define MESH_NAME_LENGTH    32          // Mesh name string length
     #define MATERIAL_NAME_LENGTH 32         // Material name string length
 
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
-    unsigned char *fileDataPtr = fileData;
+    // NOTE: IQM data is read straight from file view
+    FileView fileView = LoadFileView(fileName);
+    unsigned char *fileDataPtr = (unsigned char *)fileView.data;
 
     // IQM file structs
     //-----------------------------------------------------------------------------------
@@ -4541,20 +5318,20 @@ static Model LoadIQM(const char *fileName)
     // In case file can not be read, return an empty model
     if (fileDataPtr == NULL) return model;
 
-    const char *basePath = GetDirectoryPath(fileName);
-
     // Read IQM header
     IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
 
     if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
+        UnloadFileView(fileView);
         return model;
     }
 
     if (iqmHeader->version != IQM_VERSION)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
+        UnloadFileView(fileView);
         return model;
     }
 
@@ -4586,8 +5363,11 @@ static Model LoadIQM(const char *fileName)
         //fread(material, sizeof(char), MATERIAL_NAME_LENGTH, iqmFile);
         memcpy(material, fileDataPtr + iqmHeader->ofs_text + imesh[i].material, MATERIAL_NAME_LENGTH*sizeof(char));
 
+        char texturePath[MAX_FILEPATH_LENGTH] = { 0 };
+        GetModelFilePath(texturePath, fileName, material);
+
         model.materials[i] = LoadMaterialDefault();
-        model.materials[i].maps[MATERIAL_MAP_ALBEDO].texture = LoadTexture(TextFormat("%s/%s", basePath, material));
+        model.materials[i].maps[MATERIAL_MAP_ALBEDO].texture = LoadTexture(texturePath);
 
         model.meshMaterial[i] = i;
 
@@ -4786,6 +5566,7 @@ static Model LoadIQM(const char *fileName)
     }
 
     BuildPoseFromParentJoints(model.bones, model.boneCount, model.bindPose);
+    model.invBindPose = LoadInverseBindPose(model.bindPose, model.boneCount);
 
     for (int i = 0; i < model.meshCount; i++)
     {
@@ -4798,7 +5579,7 @@ static Model LoadIQM(const char *fileName)
         }
     }
 
-    UnloadFileData(fileData);
+    UnloadFileView(fileView);
 
     RL_FREE(imesh);
     RL_FREE(tri);
@@ -4820,9 +5601,9 @@ static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *animCou
     #define IQM_MAGIC       "INTERQUAKEMODEL"   // IQM file magic number
     #define IQM_VERSION     2                   // only IQM version 2 supported
 
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
-    unsigned char *fileDataPtr = fileData;
+    // NOTE: IQM data is read straight from file view
+    FileView fileView = LoadFileView(fileName);
+    unsigned char *fileDataPtr = (unsigned char *)fileView.data;
 
     typedef struct IQMHeader {
         char magic[16];
@@ -4870,12 +5651,14 @@ static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *animCou
     if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
+        UnloadFileView(fileView);
         return NULL;
     }
 
     if (iqmHeader->version != IQM_VERSION)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
+        UnloadFileView(fileView);
         return NULL;
     }
 
@@ -5032,7 +5815,7 @@ static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *animCou
         }
     }
 
-    UnloadFileData(fileData);
+    UnloadFileView(fileView);
 
     RL_FREE(joints);
     RL_FREE(framedata);
@@ -5066,7 +5849,7 @@ static void ReleaseFileGLTFCallback(const struct cgltf_memory_options *memoryOpt
 }
 
 // Load image from different glTF provided methods (uri, path, buffer_view)
-static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPath)
+static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *fileName)
 {
     Image image = { 0 };
 
@@ -5108,7 +5891,10 @@ static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPat
         }
         else     // Check if image is provided as image path
         {
-            image = LoadImage(TextFormat("%s/%s", texPath, cgltfImage->uri));
+            char texPath[MAX_FILEPATH_LENGTH] = { 0 };
+            GetModelFilePath(texPath, fileName, cgltfImage->uri);
+
+            image = LoadImage(texPath);
         }
     }
     else if (cgltfImage->buffer_view->buffer->data != NULL)    // Check if image is provided as data buffer
@@ -5130,7 +5916,7 @@ static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPat
             (strcmp(cgltfImage->mime_type, "image/png") == 0)) image = LoadImageFromMemory(".png", data, (int)cgltfImage->buffer_view->size);
         else if ((strcmp(cgltfImage->mime_type, "image\\/jpeg") == 0) ||
                  (strcmp(cgltfImage->mime_type, "image/jpeg") == 0)) image = LoadImageFromMemory(".jpg", data, (int)cgltfImage->buffer_view->size);
-        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized", TextFormat("%s/%s", texPath, cgltfImage->uri));
+        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized");
 
         RL_FREE(data);
     }
@@ -5225,17 +6011,17 @@ static Model LoadGLTF(const char *fileName)
     Model model = { 0 };
 
     // glTF file loading
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // NOTE: Binary glTF (.glb) buffers are read straight from file view
+    FileView fileView = LoadFileView(fileName);
 
-    if (fileData == NULL) return model;
+    if (fileView.data == NULL) return model;
 
     // glTF data loading
     cgltf_options options = { 0 };
     options.file.read = LoadFileGLTFCallback;
     options.file.release = ReleaseFileGLTFCallback;
     cgltf_data *data = NULL;
-    cgltf_result result = cgltf_parse(&options, fileData, dataSize, &data);
+    cgltf_result result = cgltf_parse(&options, fileView.data, (cgltf_size)fileView.size, &data);
 
     if (result == cgltf_result_success)
     {
@@ -5289,7 +6075,6 @@ static Model LoadGLTF(const char *fileName)
         for (unsigned int i = 0, j = 1; i < data->materials_count; i++, j++)
         {
             model.materials[j] = LoadMaterialDefault();
-            const char *texPath = GetDirectoryPath(fileName);
 
             // Check glTF material flow: PBR metallic/roughness flow
             // NOTE: Alternatively, materials can follow PBR specular/glossiness flow
@@ -5298,7 +6083,7 @@ static Model LoadGLTF(const char *fileName)
                 // Load base color texture (albedo)
                 if (data->materials[i].pbr_metallic_roughness.base_color_texture.texture)
                 {
-                    Image imAlbedo = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.base_color_texture.texture->image, texPath);
+                    Image imAlbedo = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.base_color_texture.texture->image, fileName);
                     if (imAlbedo.data != NULL)
                     {
                         model.materials[j].maps[MATERIAL_MAP_ALBEDO].texture = LoadTextureFromImage(imAlbedo);
@@ -5314,7 +6099,7 @@ static Model LoadGLTF(const char *fileName)
                 // Load metallic/roughness texture
                 if (data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture)
                 {
-                    Image imMetallicRoughness = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture->image, texPath);
+                    Image imMetallicRoughness = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture->image, fileName);
                     if (imMetallicRoughness.data != NULL)
                     {
                         model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadTextureFromImage(imMetallicRoughness);
@@ -5332,7 +6117,7 @@ static Model LoadGLTF(const char *fileName)
                 // Load normal texture
                 if (data->materials[i].normal_texture.texture)
                 {
-                    Image imNormal = LoadImageFromCgltfImage(data->materials[i].normal_texture.texture->image, texPath);
+                    Image imNormal = LoadImageFromCgltfImage(data->materials[i].normal_texture.texture->image, fileName);
                     if (imNormal.data != NULL)
                     {
                         model.materials[j].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureFromImage(imNormal);
@@ -5343,7 +6128,7 @@ static Model LoadGLTF(const char *fileName)
                 // Load ambient occlusion texture
                 if (data->materials[i].occlusion_texture.texture)
                 {
-                    Image imOcclusion = LoadImageFromCgltfImage(data->materials[i].occlusion_texture.texture->image, texPath);
+                    Image imOcclusion = LoadImageFromCgltfImage(data->materials[i].occlusion_texture.texture->image, fileName);
                     if (imOcclusion.data != NULL)
                     {
                         model.materials[j].maps[MATERIAL_MAP_OCCLUSION].texture = LoadTextureFromImage(imOcclusion);
@@ -5354,7 +6139,7 @@ static Model LoadGLTF(const char *fileName)
                 // Load emissive texture
                 if (data->materials[i].emissive_texture.texture)
                 {
-                    Image imEmissive = LoadImageFromCgltfImage(data->materials[i].emissive_texture.texture->image, texPath);
+                    Image imEmissive = LoadImageFromCgltfImage(data->materials[i].emissive_texture.texture->image, fileName);
                     if (imEmissive.data != NULL)
                     {
                         model.materials[j].maps[MATERIAL_MAP_EMISSION].texture = LoadTextureFromImage(imEmissive);
@@ -5748,6 +6533,8 @@ static Model LoadGLTF(const char *fileName)
                 };
                 MatrixDecompose(worldMatrix, &(model.bindPose[i].translation), &(model.bindPose[i].rotation), &(model.bindPose[i].scale));
             }
+
+            model.invBindPose = LoadInverseBindPose(model.bindPose, model.boneCount);
         }
         if (data->skins_count > 1)
         {
@@ -5903,7 +6690,7 @@ static Model LoadGLTF(const char *fileName)
     else TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
 
     // WARNING: cgltf requires the file pointer available while reading data
-    UnloadFileData(fileData);
+    UnloadFileView(fileView);
 
     return model;
 }
@@ -6048,8 +6835,7 @@ static bool GetPoseAtTimeGLTF(cgltf_interpolation_type interpolationType, cgltf_
 static ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *animCount)
 {
     // glTF file loading
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    FileView fileView = LoadFileView(fileName);
 
     ModelAnimation *animations = NULL;
 
@@ -6058,11 +6844,12 @@ static ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *animCo
     options.file.read = LoadFileGLTFCallback;
     options.file.release = ReleaseFileGLTFCallback;
     cgltf_data *data = NULL;
-    cgltf_result result = cgltf_parse(&options, fileData, dataSize, &data);
+    cgltf_result result = cgltf_parse(&options, fileView.data, (cgltf_size)fileView.size, &data);
 
     if (result != cgltf_result_success)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
+        UnloadFileView(fileView);
         *animCount = 0;
         return NULL;
     }
@@ -6215,7 +7002,7 @@ static ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *animCo
 
         cgltf_free(data);
     }
-    UnloadFileData(fileData);
+    UnloadFileView(fileView);
     return animations;
 }
 #endif
@@ -6653,6 +7440,8 @@ static Model LoadM3D(const char *fileName)
             model.bindPose[i].rotation.z = 0.0f;
             model.bindPose[i].rotation.w = 1.0f;
             model.bindPose[i].scale.x = model.bindPose[i].scale.y = model.bindPose[i].scale.z = 1.0f;
+
+            model.invBindPose = LoadInverseBindPose(model.bindPose, model.boneCount);
         }
 
         // Load bone-pose default mesh into animation vertices. These will be updated when UpdateModelAnimation gets
@@ -6793,4 +7582,109 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
 }
 #endif
 
+#if defined(SUPPORT_ASYNC_LOADING)
+// Load model data (loading thread)
+// NOTE: Meshes and textures GPU uploads are deferred, model is validated on upload
+static bool LoadModelAsyncData(void *data)
+{
+    ModelAsyncLoad *load = (ModelAsyncLoad *)data;
+
+    if (!load->mainThread) load->model = LoadModel(load->fileName);
+
+    return true;
+}
+
+// Upload model meshes and textures (main thread)
+static bool UploadModelAsyncData(void *data, AsyncUploads *uploads)
+{
+    ModelAsyncLoad *load = (ModelAsyncLoad *)data;
+    Model *model = &load->model;
+
+    // Model format not async-safe, model is loaded and uploaded right now
+    if (load->mainThread) *model = LoadModel(load->fileName);
+
+    for (int i = 0; i < uploads->meshCount; i++) UploadMesh(uploads->meshes[i].mesh, uploads->meshes[i].dynamic);
+
+    for (int i = 0; i < model->materialCount; i++)
+    {
+        if (model->materials[i].maps == NULL) continue;
+
+        for (int j = 0; j < MAX_MATERIAL_MAPS; j++) UploadAsyncTexture(uploads, &model->materials[i].maps[j].texture);
+    }
+
+    if ((model->meshCount == 0) || (model->meshes == NULL))
+    {
+        UnloadModel(*model);
+        return false;
+    }
+
+    return true;
+}
+
+// Unload model async load data not retrieved (main thread)
+static void UnloadModelAsyncData(void *data, bool uploaded)
+{
+    ModelAsyncLoad *load = (ModelAsyncLoad *)data;
+    Model *model = &load->model;
+
+    // Deferred textures were never uploaded, they must not be unloaded
+    if (!uploaded)
+    {
+        for (int i = 0; i < model->materialCount; i++)
+        {
+            if (model->materials[i].maps == NULL) continue;
+
+            for (int j = 0; j < MAX_MATERIAL_MAPS; j++)
+            {
+                if (model->materials[i].maps[j].texture.id & ASYNC_DEFERRED_TEXTURE) model->materials[i].maps[j].texture.id = 0;
+            }
+        }
+    }
+
+    UnloadModel(*model);
+}
+#endif
+
+// Make room for instance transforms range, growing buffer if required
+// NOTE: Growing reallocates the buffer, previous contents are discarded, so it is
+// only allowed for updates from offset 0 that overwrite the whole used range
+static bool ReserveInstanceBuffer(InstanceBuffer *buffer, int offset, int count)
+{
+    if ((offset < 0) || (count <= 0)) return false;
+    if ((offset + count) <= buffer->capacity) return true;
+
+    if (offset > 0)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: Instance buffer update out of capacity (%i + %i > %i)", offset, count, buffer->capacity);
+        return false;
+    }
+
+    int capacity = 2*buffer->capacity;
+    if (capacity < count) capacity = count;
+
+    InstanceBuffer grown = LoadInstanceBuffer(capacity);
+    if (grown.id == 0) return false;
+
+    UnloadInstanceBuffer(*buffer);
+    *buffer = grown;
+
+    return true;
+}
+
+#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
+// Get path of a file relative to model directory, path buffer must be MAX_FILEPATH_LENGTH
+// NOTE: GetDirectoryPath()/TextFormat() static buffers are not used, model could be loaded on loading thread
+static void GetModelFilePath(char *path, const char *modelFileName, const char *fileName)
+{
+    int dirLength = 0;
+
+    for (int i = 0; modelFileName[i] != '\0'; i++)
+    {
+        if ((modelFileName[i] == '/') || (modelFileName[i] == '\\')) dirLength = i + 1;
+    }
+
+    snprintf(path, MAX_FILEPATH_LENGTH, "%.*s%s", dirLength, modelFileName, fileName);
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RMODELS
@@ -71,6 +71,10 @@
 #include <stdarg.h>         // Required for: va_list, va_start(), vsprintf(), va_end() [Used in TextFormat()]
 #include <ctype.h>          // Required for: toupper(), tolower() [Used in TextToUpper(), TextToLower()]
 
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE) && (defined(SUPPORT_JOB_SYSTEM) || defined(SUPPORT_ASYNC_LOADING))
+    #include <pthread.h>    // Required for: pthread_mutex_lock(), pthread_mutex_unlock() [Used in DrawTextEx(), MeasureTextEx()]
+#endif
+
 #if defined(SUPPORT_FILEFORMAT_TTF) || defined(SUPPORT_FILEFORMAT_BDF)
     #if defined(__GNUC__) // GCC and Clang
         #pragma GCC diagnostic push
@@ -115,11 +119,122 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
+#ifndef MAX_TEXT_LAYOUT_CACHE
+    #define MAX_TEXT_LAYOUT_CACHE                 32        // Maximum number of text layouts cached: DrawTextEx(), MeasureTextEx()
+#endif
+
+#ifndef FONT_GLYPHS_PER_JOB
+    #define FONT_GLYPHS_PER_JOB                   32        // Glyphs rasterized per job on font loading: LoadFontData()
+#endif
+
+#if defined(SUPPORT_FONT_DYNAMIC) && !defined(SUPPORT_FILEFORMAT_TTF)
+    #undef SUPPORT_FONT_DYNAMIC         // Dynamic fonts require TTF glyphs rasterization
+#endif
+#ifndef FONT_DYNAMIC_ATLAS_SIZE
+    #define FONT_DYNAMIC_ATLAS_SIZE             1024        // Dynamic font atlas texture size (width and height), limits font memory
+#endif
+#ifndef FONT_DYNAMIC_ATLAS_PAGES
+    #define FONT_DYNAMIC_ATLAS_PAGES               4        // Dynamic font atlas pages, evicted as a whole (max 32)
+#endif
+#ifndef MAX_FONT_DYNAMIC_GLYPHS
+    #define MAX_FONT_DYNAMIC_GLYPHS             1024        // Maximum number of glyphs resident on a dynamic font atlas
+#endif
+
+#define GLYPH_TABLE_MAX_CODEPOINT           0x10ffff        // Maximum unicode codepoint mapped by glyph lookup table
+#define GLYPH_TABLE_PAGE_SIZE                    256        // Number of codepoints mapped per glyph lookup table page
+#define GLYPH_TABLE_PAGE_COUNT   ((GLYPH_TABLE_MAX_CODEPOINT + 1)/GLYPH_TABLE_PAGE_SIZE)
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+#if defined(SUPPORT_ASYNC_LOADING)
+// Font async load data
+typedef struct FontAsyncLoad {
+    char *fileName;             // File name, stored after struct
+    int fontSize;               // Font size
+    Font font;                  // Font loaded on loading thread, texture uploaded on main thread
+} FontAsyncLoad;
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Glyphs rasterization batch, processed by job system (one job per glyphs group)
+typedef struct GlyphRasterBatch {
+    const stbtt_fontinfo *fontInfo; // Font info, shared by all jobs (read-only)
+    GlyphInfo *glyphs;              // Glyphs to fill, one per codepoint
+    const int *codepoints;          // Codepoints to rasterize
+    int codepointCount;             // Codepoints count
+    int fontSize;                   // Font size in pixels
+    int type;                       // Font type (FontType)
+    float scaleFactor;              // Font scale factor for font size
+    int ascent;                     // Font ascent (unscaled)
+} GlyphRasterBatch;
+#endif
+
+#if defined(SUPPORT_FONT_DYNAMIC)
+// Dynamic font atlas page, horizontal strip of the atlas texture with its own skyline packer
+typedef struct FontDynamicPage {
+    stbrp_context packer;           // Rectangles packer (skyline)
+    stbrp_node *nodes;              // Packer nodes, one per page pixel column
+    int y;                          // Page position in atlas texture
+    int glyphCount;                 // Number of glyphs packed in page
+    unsigned int lastUsed;          // Last use tick (LRU eviction)
+} FontDynamicPage;
+
+// Dynamic font data, glyphs are rasterized on first use
+// NOTE: Font glyphs and recs arrays are a fixed set of slots (MAX_FONT_DYNAMIC_GLYPHS), slot 0 is
+// reserved as empty glyph, so font copies (passed by value) always see the resident glyphs
+typedef struct FontDynamic {
+    unsigned char *fileData;        // Font file data, referenced by fontInfo
+    stbtt_fontinfo fontInfo;        // Font info for glyphs rasterization
+    float scaleFactor;              // Font scale factor for font size
+    int ascent;                     // Font ascent (unscaled)
+    int padding;                    // Glyphs padding
+    Texture2D texture;              // Font atlas texture
+    GlyphInfo *glyphs;              // Font glyphs slots
+    Rectangle *recs;                // Font glyphs slots atlas rectangles
+    int *slotPages;                 // Atlas page for every glyph slot (-1 = free)
+    int *freeSlots;                 // Free glyph slots stack
+    int freeCount;                  // Free glyph slots count
+    unsigned char *pixels;          // Glyph upload buffer (GRAY_ALPHA)
+    int pixelsSize;                 // Glyph upload buffer size in bytes
+    unsigned int tick;              // Glyphs use counter
+    unsigned int version;           // Atlas version, increased on every page eviction
+    unsigned int usedPages;         // Pages used since last reset (bit per page), required by text layout cache
+    FontDynamicPage pages[FONT_DYNAMIC_ATLAS_PAGES];    // Atlas pages
+} FontDynamic;
+#endif
+
+// Glyph lookup table, maps codepoints to glyph indices in O(1)
+// NOTE: Two-level table, only pages containing some font codepoint are allocated
+struct rGlyphTable {
+    int fallbackIndex;                                      // Glyph index for codepoints not available in font ('?' or 0)
+    int pageCount;                                          // Number of allocated pages
+    unsigned short pageIndex[GLYPH_TABLE_PAGE_COUNT];       // Page for every codepoint range (0 = not allocated, first page is 1)
+    int *pages;                                             // Pages glyph indices (-1 = not available), pageCount*GLYPH_TABLE_PAGE_SIZE
+#if defined(SUPPORT_FONT_DYNAMIC)
+    FontDynamic *dynamic;                                   // Dynamic font data (NULL for fonts with all glyphs loaded)
+#endif
+};
+
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+// Text layout cache entry
+// NOTE: Layout is reused while text, font and drawing parameters match
+typedef struct TextLayoutCacheEntry {
+    unsigned int hash;              // Text hash (FNV-1a)
+    char *text;                     // Text copy
+    int textSize;                   // Text size in bytes
+    int capacity;                   // Text and layout glyph quads capacity
+    const GlyphInfo *glyphs;        // Font glyphs, identifies font data
+    unsigned int textureId;         // Font texture id
+    float fontSize;                 // Font size
+    float spacing;                  // Glyphs spacing
+    int lineSpacing;                // Text line spacing at layout generation
+    unsigned int atlasVersion;      // Font atlas version at layout generation (dynamic fonts)
+    unsigned int atlasPages;        // Font atlas pages used by layout (dynamic fonts)
+    unsigned int lastUsed;          // Last use tick (LRU eviction)
+    TextLayout layout;              // Text layout
+} TextLayoutCacheEntry;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -131,20 +246,49 @@ extern bool isGpuReady;
 static Font defaultFont = { 0 };
 #endif
 
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+static TextLayoutCacheEntry textLayoutCache[MAX_TEXT_LAYOUT_CACHE] = { 0 };   // Text layouts recently drawn/measured
+static unsigned int textLayoutCacheTick = 0;    // Text layout cache use counter
+#if defined(SUPPORT_JOB_SYSTEM) || defined(SUPPORT_ASYNC_LOADING)
+static pthread_mutex_t textLayoutCacheLock = PTHREAD_MUTEX_INITIALIZER;    // Text layout cache lock, text could be measured from any thread
+#endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
-//...
+#if defined(SUPPORT_ASYNC_LOADING)
+extern void UploadAsyncTexture(AsyncUploads *uploads, Texture2D *texture);  // [Module: textures] Upload texture deferred on async loading thread
+#endif
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static void RasterizeGlyphsJob(void *userData, int job);    // Rasterize glyphs group, job system function
+#endif
+#if defined(SUPPORT_ASYNC_LOADING)
+static bool LoadFontAsyncData(void *data);      // Load font data and atlas (loading thread)
+static bool UploadFontAsyncData(void *data, AsyncUploads *uploads);     // Upload font atlas texture (main thread)
+static void UnloadFontAsyncData(void *data, bool uploaded);     // Unload font async load data not retrieved (main thread)
+#endif
 #if defined(SUPPORT_FILEFORMAT_FNT)
 static Font LoadBMFont(const char *fileName);   // Load a BMFont file (AngelCode font file)
 #endif
 #if defined(SUPPORT_FILEFORMAT_BDF)
 static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, int *codepoints, int codepointCount, int *outFontSize);
 #endif
+static rGlyphTable *LoadGlyphTable(const GlyphInfo *glyphs, int glyphCount); // Load glyph lookup table for font glyphs
+static void UnloadGlyphTable(rGlyphTable *table); // Unload glyph lookup table
+#if defined(SUPPORT_FONT_DYNAMIC)
+static int LoadFontDynamicGlyph(rGlyphTable *table, int codepoint); // Load dynamic font glyph, rasterized and packed into atlas
+static void EvictFontDynamicPage(rGlyphTable *table, int page); // Evict dynamic font atlas page, unloading its glyphs
+#endif
+static void GenTextLayout(Font font, const char *text, int size, float fontSize, float spacing, TextLayout *layout); // Generate text layout glyph quads and size
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+static const TextLayout *GetTextLayoutCached(Font font, const char *text, float fontSize, float spacing, bool measure); // Get text layout from cache, generated if not available
+static void UnloadTextLayoutCache(const GlyphInfo *glyphs); // Unload cached text layouts for font glyphs (NULL for all)
+#endif
 static int textLineSpacing = 2;                 // Text vertical line spacing in pixels (between lines)
 
 #if defined(SUPPORT_DEFAULT_FONT)
@@ -301,6 +445,7 @@ extern void LoadFontDefault(void)
     UnloadImage(imFont);
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
+    defaultFont.glyphTable = LoadGlyphTable(defaultFont.glyphs, defaultFont.glyphCount);
 
     TRACELOG(LOG_INFO, "FONT: Default font loaded successfully (%i glyphs)", defaultFont.glyphCount);
 }
@@ -312,6 +457,13 @@ extern void UnloadFontDefault(void)
     if (isGpuReady) UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
+    UnloadGlyphTable(defaultFont.glyphTable);
+    defaultFont.glyphTable = NULL;
+
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+    // NOTE: Default font is unloaded on CloseWindow(), all cached layouts are released
+    UnloadTextLayoutCache(NULL);
+#endif
 }
 #endif      // SUPPORT_DEFAULT_FONT
 
@@ -383,17 +535,62 @@ Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepoi
 {
     Font font = { 0 };
 
-    // Loading file to memory
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // Loading font straight from file view (memory mapped when supported)
+    FileView fileView = LoadFileView(fileName);
 
-    if (fileData != NULL)
+    if ((fileView.data != NULL) && (fileView.size <= 2147483647))
     {
-        // Loading font from memory data
-        font = LoadFontFromMemory(GetFileExtension(fileName), fileData, dataSize, fontSize, codepoints, codepointCount);
+        font = LoadFontFromMemory(GetFileExtension(fileName), fileView.data, (int)fileView.size, fontSize, codepoints, codepointCount);
+    }
 
-        UnloadFileData(fileData);
+    UnloadFileView(fileView);
+
+    return font;
+}
+
+// Load font from file asynchronously (default character set), returns async load handle (0 on failure)
+// NOTE: Font file is loaded and glyphs rasterized on loading thread, atlas texture is uploaded on main thread (EndDrawing())
+unsigned int LoadFontAsync(const char *fileName, int fontSize, AsyncLoadCallback callback, void *userData)
+{
+    unsigned int handle = 0;
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    if (fileName == NULL) return 0;
+
+    FontAsyncLoad *load = (FontAsyncLoad *)RL_CALLOC(1, sizeof(FontAsyncLoad) + strlen(fileName) + 1);
+    load->fileName = (char *)(load + 1);
+    strcpy(load->fileName, fileName);
+    load->fontSize = fontSize;
+
+    handle = QueueAsyncLoad(ASYNC_ASSET_FONT, load, LoadFontAsyncData, UploadFontAsyncData, UnloadFontAsyncData, callback, userData);
+    if (handle == 0) RL_FREE(load);
+#else
+    (void)fontSize;
+    (void)callback;
+    (void)userData;
+    TRACELOG(LOG_WARNING, "FONT: [%s] Async loading not supported", fileName);
+#endif
+
+    return handle;
+}
+
+// Get font loaded asynchronously, handle is released
+// NOTE: An empty font is returned if load is not ready (or failed)
+Font GetAsyncFont(unsigned int handle)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    FontAsyncLoad *load = (FontAsyncLoad *)TakeAsyncLoadResult(handle, ASYNC_ASSET_FONT);
+
+    if (load != NULL)
+    {
+        font = load->font;
+        RL_FREE(load);
     }
+#else
+    (void)handle;
+#endif
 
     return font;
 }
@@ -519,6 +716,7 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
     UnloadImage(fontClear);     // Unload processed image once converted to texture
 
     font.baseSize = (int)font.recs[0].height;
+    font.glyphTable = LoadGlyphTable(font.glyphs, font.glyphCount);
 
     return font;
 }
@@ -528,8 +726,10 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
 {
     Font font = { 0 };
 
+    // NOTE: Extension is converted to lower case locally, TextToLower() static buffer is not used
+    // because fonts can be loaded from async loading thread
     char fileExtLower[16] = { 0 };
-    strncpy(fileExtLower, TextToLower(fileType), 16 - 1);
+    for (int i = 0; (i < (16 - 1)) && (fileType[i] != '\0'); i++) fileExtLower[i] = (char)tolower((unsigned char)fileType[i]);
 
     font.baseSize = fontSize;
     font.glyphCount = (codepointCount > 0)? codepointCount : 95;
@@ -571,6 +771,8 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
 
         UnloadImage(atlas);
 
+        font.glyphTable = LoadGlyphTable(font.glyphs, font.glyphCount);
+
         TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
     }
     else font = GetFontDefault();
@@ -581,6 +783,106 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     return font;
 }
 
+// Load font from file (TTF/OTF) with glyphs rasterized on first use into a fixed size atlas
+// NOTE: Atlas memory is limited to FONT_DYNAMIC_ATLAS_SIZE, least recently used atlas page is evicted when full,
+// font data is kept loaded for glyphs rasterization until UnloadFont(), glyphs image data is not kept (ImageText*() not supported)
+// WARNING: Glyphs are rasterized and uploaded on lookup, font must be used from main thread only and
+// TextLayout loaded with LoadTextLayout() could be invalidated by atlas page eviction
+Font LoadFontDynamic(const char *fileName, int fontSize)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FONT_DYNAMIC)
+    if (!IsFileExtension(fileName, ".ttf;.otf"))
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Dynamic font requires TTF/OTF file", fileName);
+        return GetFontDefault();
+    }
+
+    if (!isGpuReady)
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Dynamic font requires GPU context", fileName);
+        return GetFontDefault();
+    }
+
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    if (fileData == NULL) return GetFontDefault();
+
+    FontDynamic *dynamic = (FontDynamic *)RL_CALLOC(1, sizeof(FontDynamic));
+
+    if (!stbtt_InitFont(&dynamic->fontInfo, fileData, 0))
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to process TTF font data", fileName);
+        UnloadFileData(fileData);
+        RL_FREE(dynamic);
+        return GetFontDefault();
+    }
+
+    dynamic->fileData = fileData;
+    dynamic->scaleFactor = stbtt_ScaleForPixelHeight(&dynamic->fontInfo, (float)fontSize);
+    stbtt_GetFontVMetrics(&dynamic->fontInfo, &dynamic->ascent, NULL, NULL);
+    dynamic->padding = FONT_TTF_DEFAULT_CHARS_PADDING;
+
+    // Empty atlas texture, glyphs are uploaded on first use
+    Image atlas = {
+        .data = RL_CALLOC(FONT_DYNAMIC_ATLAS_SIZE*FONT_DYNAMIC_ATLAS_SIZE, 2),
+        .width = FONT_DYNAMIC_ATLAS_SIZE,
+        .height = FONT_DYNAMIC_ATLAS_SIZE,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
+    };
+
+    dynamic->texture = LoadTextureFromImage(atlas);
+    UnloadImage(atlas);
+
+    // Atlas pages are horizontal strips, packing width excludes a right column kept empty for the reserved empty glyph
+    int pageWidth = FONT_DYNAMIC_ATLAS_SIZE - 2*dynamic->padding;
+    int pageHeight = FONT_DYNAMIC_ATLAS_SIZE/FONT_DYNAMIC_ATLAS_PAGES;
+
+    for (int i = 0; i < FONT_DYNAMIC_ATLAS_PAGES; i++)
+    {
+        dynamic->pages[i].nodes = (stbrp_node *)RL_MALLOC(pageWidth*sizeof(stbrp_node));
+        dynamic->pages[i].y = i*pageHeight;
+        stbrp_init_target(&dynamic->pages[i].packer, pageWidth, pageHeight, dynamic->pages[i].nodes, pageWidth);
+    }
+
+    dynamic->glyphs = (GlyphInfo *)RL_CALLOC(MAX_FONT_DYNAMIC_GLYPHS, sizeof(GlyphInfo));
+    dynamic->recs = (Rectangle *)RL_CALLOC(MAX_FONT_DYNAMIC_GLYPHS, sizeof(Rectangle));
+    dynamic->slotPages = (int *)RL_MALLOC(MAX_FONT_DYNAMIC_GLYPHS*sizeof(int));
+    dynamic->freeSlots = (int *)RL_MALLOC(MAX_FONT_DYNAMIC_GLYPHS*sizeof(int));
+
+    // Slot 0 is the reserved empty glyph, pointing to the atlas empty column
+    dynamic->slotPages[0] = -1;
+    dynamic->recs[0] = (Rectangle){ (float)(FONT_DYNAMIC_ATLAS_SIZE - dynamic->padding), (float)dynamic->padding, 0, 0 };
+
+    for (int i = MAX_FONT_DYNAMIC_GLYPHS - 1; i > 0; i--)
+    {
+        dynamic->slotPages[i] = -1;
+        dynamic->freeSlots[dynamic->freeCount] = i;
+        dynamic->freeCount++;
+    }
+
+    rGlyphTable *table = (rGlyphTable *)RL_CALLOC(1, sizeof(rGlyphTable));
+    table->dynamic = dynamic;
+
+    font.baseSize = fontSize;
+    font.glyphCount = MAX_FONT_DYNAMIC_GLYPHS;
+    font.glyphPadding = dynamic->padding;
+    font.texture = dynamic->texture;
+    font.recs = dynamic->recs;
+    font.glyphs = dynamic->glyphs;
+    font.glyphTable = table;
+
+    TRACELOG(LOG_INFO, "FONT: [%s] Dynamic font loaded successfully (%i pixel size | %ix%i atlas)", fileName, fontSize, FONT_DYNAMIC_ATLAS_SIZE, FONT_DYNAMIC_ATLAS_SIZE);
+#else
+    TRACELOG(LOG_WARNING, "FONT: [%s] Dynamic font not supported", fileName);
+    font = GetFontDefault();
+#endif
+
+    return font;
+}
+
 // Check if a font is valid (font data loaded)
 // WARNING: GPU texture not checked
 bool IsFontValid(Font font)
@@ -646,82 +948,20 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 
             chars = (GlyphInfo *)RL_CALLOC(codepointCount, sizeof(GlyphInfo));
 
-            // NOTE: Using simple packaging, one char after another
-            for (int i = 0; i < codepointCount; i++)
-            {
-                int chw = 0, chh = 0;   // Character width and height (on generation)
-                int ch = codepoints[i];  // Character value to get info for
-                chars[i].value = ch;
-
-                //  Render a unicode codepoint to a bitmap
-                //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-                //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-                //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
-
-                // Check if a glyph is available in the font
-                // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
-                int index = stbtt_FindGlyphIndex(&fontInfo, ch);
-
-                if (index > 0)
-                {
-                    switch (type)
-                    {
-                        case FONT_DEFAULT:
-                        case FONT_BITMAP: chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
-                        case FONT_SDF: if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
-                        default: break;
-                    }
-
-                    if (chars[i].image.data != NULL)    // Glyph data has been found in the font
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                        if (chh > fontSize) TRACELOG(LOG_WARNING, "FONT: Character [0x%08x] size is bigger than expected font size", ch);
-
-                        // Load characters images
-                        chars[i].image.width = chw;
-                        chars[i].image.height = chh;
-                        chars[i].image.mipmaps = 1;
-                        chars[i].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-
-                        chars[i].offsetY += (int)((float)ascent*scaleFactor);
-                    }
-
-                    // NOTE: We create an empty image for space character,
-                    // it could be further required for atlas packing
-                    if (ch == 32)
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                        Image imSpace = {
-                            .data = RL_CALLOC(chars[i].advanceX*fontSize, 2),
-                            .width = chars[i].advanceX,
-                            .height = fontSize,
-                            .mipmaps = 1,
-                            .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
-                        };
-
-                        chars[i].image = imSpace;
-                    }
+            // Glyphs are rasterized in parallel by job system, each glyph is rasterized independently
+            // into its own slot, so result is the same as rasterizing them sequentially
+            GlyphRasterBatch batch = {
+                .fontInfo = &fontInfo,
+                .glyphs = chars,
+                .codepoints = codepoints,
+                .codepointCount = codepointCount,
+                .fontSize = fontSize,
+                .type = type,
+                .scaleFactor = scaleFactor,
+                .ascent = ascent
+            };
 
-                    if (type == FONT_BITMAP)
-                    {
-                        // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                        // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                        for (int p = 0; p < chw*chh; p++)
-                        {
-                            if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
-                            else ((unsigned char *)chars[i].image.data)[p] = 255;
-                        }
-                    }
-                }
-                else
-                {
-                    // TODO: Use some fallback glyph for codepoints not found in the font
-                }
-            }
+            RunJobs(RasterizeGlyphsJob, &batch, (codepointCount + FONT_GLYPHS_PER_JOB - 1)/FONT_GLYPHS_PER_JOB);
         }
         else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
 
@@ -953,6 +1193,10 @@ void UnloadFont(Font font)
         UnloadFontData(font.glyphs, font.glyphCount);
         if (isGpuReady) UnloadTexture(font.texture);
         RL_FREE(font.recs);
+        UnloadGlyphTable(font.glyphTable);
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+        UnloadTextLayoutCache(font.glyphs);
+#endif
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
@@ -1149,6 +1393,19 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
 {
     if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
 
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+    // NOTE: Cache lock is kept while drawing, cached layout could be evicted by another thread
+#if defined(SUPPORT_JOB_SYSTEM) || defined(SUPPORT_ASYNC_LOADING)
+    pthread_mutex_lock(&textLayoutCacheLock);
+#endif
+    const TextLayout *layout = GetTextLayoutCached(font, text, fontSize, spacing, false);
+    if (layout != NULL) DrawTextLayout(*layout, position, tint);
+#if defined(SUPPORT_JOB_SYSTEM) || defined(SUPPORT_ASYNC_LOADING)
+    pthread_mutex_unlock(&textLayoutCacheLock);
+#endif
+    if (layout != NULL) return;
+#endif
+
     int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
 
     float textOffsetY = 0;          // Offset between lines (on linebreak '\n')
@@ -1253,6 +1510,66 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
     }
 }
 
+// Load text layout, glyph quads positioned for drawing
+// NOTE: Layout keeps font texture reference, font must be valid while layout is drawn
+TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing)
+{
+    TextLayout layout = { 0 };
+
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
+
+    int size = TextLength(text);
+
+    if ((size > 0) && (font.glyphs != NULL))
+    {
+        // NOTE: Allocating space for one glyph quad per byte, shrinked once generated
+        layout.vertices = (float *)RL_MALLOC(size*8*sizeof(float));
+        layout.texcoords = (float *)RL_MALLOC(size*8*sizeof(float));
+
+        GenTextLayout(font, text, size, fontSize, spacing, &layout);
+
+        if (layout.glyphCount == 0)
+        {
+            RL_FREE(layout.vertices);
+            RL_FREE(layout.texcoords);
+            layout.vertices = NULL;
+            layout.texcoords = NULL;
+        }
+        else if (layout.glyphCount < size)
+        {
+            layout.vertices = (float *)RL_REALLOC(layout.vertices, layout.glyphCount*8*sizeof(float));
+            layout.texcoords = (float *)RL_REALLOC(layout.texcoords, layout.glyphCount*8*sizeof(float));
+        }
+    }
+
+    return layout;
+}
+
+// Unload text layout data
+void UnloadTextLayout(TextLayout layout)
+{
+    RL_FREE(layout.vertices);
+    RL_FREE(layout.texcoords);
+}
+
+// Draw text layout, all glyph quads submitted at once
+void DrawTextLayout(TextLayout layout, Vector2 position, Color tint)
+{
+    if ((layout.texture.id > 0) && (layout.glyphCount > 0))
+    {
+        rlSetTexture(layout.texture.id);
+        rlBegin(RL_QUADS);
+
+            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+            rlNormal3f(0.0f, 0.0f, 1.0f);       // Normal vector pointing towards viewer
+
+            rlQuads2f(layout.vertices, layout.texcoords, layout.glyphCount, position.x, position.y);
+
+        rlEnd();
+        rlSetTexture(0);
+    }
+}
+
 // Set vertical line spacing when drawing with line-breaks
 void SetTextLineSpacing(int spacing)
 {
@@ -1278,6 +1595,8 @@ int MeasureText(const char *text, int fontSize)
 }
 
 // Measure string size for Font
+// NOTE: Text layout cache is guarded by a lock, measuring can be done from any thread
+// (for fonts not using dynamic glyphs loading)
 Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing)
 {
     Vector2 textSize = { 0 };
@@ -1285,6 +1604,18 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
     if ((isGpuReady && (font.texture.id == 0)) || 
         (text == NULL) || (text[0] == '\0')) return textSize; // Security check
 
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+#if defined(SUPPORT_JOB_SYSTEM) || defined(SUPPORT_ASYNC_LOADING)
+    pthread_mutex_lock(&textLayoutCacheLock);
+#endif
+    const TextLayout *layout = GetTextLayoutCached(font, text, fontSize, spacing, true);
+    if (layout != NULL) textSize = layout->size;
+#if defined(SUPPORT_JOB_SYSTEM) || defined(SUPPORT_ASYNC_LOADING)
+    pthread_mutex_unlock(&textLayoutCacheLock);
+#endif
+    if (layout != NULL) return textSize;
+#endif
+
     int size = TextLength(text);    // Get size in bytes of text
     int tempByteCounter = 0;        // Used to count longer text line num chars
     int byteCounter = 0;
@@ -1340,6 +1671,39 @@ int GetGlyphIndex(Font font, int codepoint)
 {
     int index = 0;
 
+    // Fonts loaded by raylib provide a lookup table, avoiding the charset scan
+    if (font.glyphTable != NULL)
+    {
+        const rGlyphTable *table = font.glyphTable;
+        index = table->fallbackIndex;
+
+        if ((codepoint >= 0) && (codepoint <= GLYPH_TABLE_MAX_CODEPOINT))
+        {
+            int page = table->pageIndex[codepoint/GLYPH_TABLE_PAGE_SIZE];
+            int glyphIndex = (page > 0)? table->pages[(page - 1)*GLYPH_TABLE_PAGE_SIZE + codepoint%GLYPH_TABLE_PAGE_SIZE] : -1;
+
+            if (glyphIndex >= 0) index = glyphIndex;
+#if defined(SUPPORT_FONT_DYNAMIC)
+            else if (table->dynamic != NULL) index = LoadFontDynamicGlyph(font.glyphTable, codepoint);
+#endif
+        }
+
+#if defined(SUPPORT_FONT_DYNAMIC)
+        // Dynamic fonts track glyphs atlas page use for LRU eviction
+        if ((table->dynamic != NULL) && (table->dynamic->slotPages[index] >= 0))
+        {
+            FontDynamic *dynamic = table->dynamic;
+            int atlasPage = dynamic->slotPages[index];
+
+            dynamic->tick++;
+            dynamic->pages[atlasPage].lastUsed = dynamic->tick;
+            dynamic->usedPages |= (1u << atlasPage);
+        }
+#endif
+
+        return index;
+    }
+
 #define SUPPORT_UNORDERED_CHARSET
 #if defined(SUPPORT_UNORDERED_CHARSET)
     int fallbackIndex = 0;      // Get index of fallback glyph '?'
@@ -2135,6 +2499,462 @@ int GetCodepointPrevious(const char *text, int *codepointSize)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Load glyph lookup table for font glyphs
+// NOTE: Mapping matches the charset scan: first glyph found for a codepoint is used,
+// codepoints not available fallback to '?' glyph (or first glyph if '?' is not available)
+static rGlyphTable *LoadGlyphTable(const GlyphInfo *glyphs, int glyphCount)
+{
+    if ((glyphs == NULL) || (glyphCount <= 0)) return NULL;
+
+    rGlyphTable *table = (rGlyphTable *)RL_CALLOC(1, sizeof(rGlyphTable));
+
+    // Assign pages for the codepoint ranges used by the font
+    for (int i = 0; i < glyphCount; i++)
+    {
+        int codepoint = glyphs[i].value;
+        if ((codepoint < 0) || (codepoint > GLYPH_TABLE_MAX_CODEPOINT)) continue;
+
+        if (glyphs[i].value == 63) table->fallbackIndex = i;
+
+        if (table->pageIndex[codepoint/GLYPH_TABLE_PAGE_SIZE] == 0)
+        {
+            table->pageCount++;
+            table->pageIndex[codepoint/GLYPH_TABLE_PAGE_SIZE] = (unsigned short)table->pageCount;
+        }
+    }
+
+    table->pages = (int *)RL_MALLOC(table->pageCount*GLYPH_TABLE_PAGE_SIZE*sizeof(int));
+    for (int i = 0; i < table->pageCount*GLYPH_TABLE_PAGE_SIZE; i++) table->pages[i] = -1;
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        int codepoint = glyphs[i].value;
+        if ((codepoint < 0) || (codepoint > GLYPH_TABLE_MAX_CODEPOINT)) continue;
+
+        int *entry = &table->pages[(table->pageIndex[codepoint/GLYPH_TABLE_PAGE_SIZE] - 1)*GLYPH_TABLE_PAGE_SIZE + codepoint%GLYPH_TABLE_PAGE_SIZE];
+        if (*entry < 0) *entry = i;
+    }
+
+    TRACELOGD("FONT: Glyph lookup table loaded (%i glyphs | %i pages)", glyphCount, table->pageCount);
+
+    return table;
+}
+
+// Unload glyph lookup table
+static void UnloadGlyphTable(rGlyphTable *table)
+{
+    if (table != NULL)
+    {
+#if defined(SUPPORT_FONT_DYNAMIC)
+        // NOTE: Font glyphs, recs and texture are unloaded by UnloadFont()
+        if (table->dynamic != NULL)
+        {
+            FontDynamic *dynamic = table->dynamic;
+
+            for (int i = 0; i < FONT_DYNAMIC_ATLAS_PAGES; i++) RL_FREE(dynamic->pages[i].nodes);
+            RL_FREE(dynamic->slotPages);
+            RL_FREE(dynamic->freeSlots);
+            RL_FREE(dynamic->pixels);
+            UnloadFileData(dynamic->fileData);
+            RL_FREE(dynamic);
+        }
+#endif
+        RL_FREE(table->pages);
+        RL_FREE(table);
+    }
+}
+
+#if defined(SUPPORT_FONT_DYNAMIC)
+// Load dynamic font glyph, rasterized and packed into atlas
+// NOTE: Returns glyph slot index, codepoints not available in font fallback to '?' glyph (not cached),
+// reserved empty glyph (slot 0) is returned if glyph can not be loaded
+static int LoadFontDynamicGlyph(rGlyphTable *table, int codepoint)
+{
+    FontDynamic *dynamic = table->dynamic;
+
+    int tablePage = table->pageIndex[codepoint/GLYPH_TABLE_PAGE_SIZE];
+    if ((tablePage > 0) && (table->pages[(tablePage - 1)*GLYPH_TABLE_PAGE_SIZE + codepoint%GLYPH_TABLE_PAGE_SIZE] >= 0))
+    {
+        return table->pages[(tablePage - 1)*GLYPH_TABLE_PAGE_SIZE + codepoint%GLYPH_TABLE_PAGE_SIZE];
+    }
+
+    if (stbtt_FindGlyphIndex(&dynamic->fontInfo, codepoint) == 0) return (codepoint != 63)? LoadFontDynamicGlyph(table, 63) : 0;
+
+    // Rasterize glyph, metrics computed as LoadFontData()
+    int width = 0, height = 0, offsetX = 0, offsetY = 0, advanceX = 0;
+    unsigned char *bitmap = stbtt_GetCodepointBitmap(&dynamic->fontInfo, dynamic->scaleFactor, dynamic->scaleFactor, codepoint, &width, &height, &offsetX, &offsetY);
+
+    stbtt_GetCodepointHMetrics(&dynamic->fontInfo, codepoint, &advanceX, NULL);
+    advanceX = (int)((float)advanceX*dynamic->scaleFactor);
+
+    if (bitmap != NULL) offsetY += (int)((float)dynamic->ascent*dynamic->scaleFactor);
+    else width = height = 0;
+
+    // Glyph is packed with padding around, uploaded as empty borders
+    int padding = dynamic->padding;
+    stbrp_rect rect = { .w = width + 2*padding, .h = height + 2*padding };
+
+    if ((rect.w > (FONT_DYNAMIC_ATLAS_SIZE - 2*padding)) || (rect.h > (FONT_DYNAMIC_ATLAS_SIZE/FONT_DYNAMIC_ATLAS_PAGES)))
+    {
+        TRACELOG(LOG_WARNING, "FONT: Character [0x%08x] size is bigger than dynamic font atlas page", codepoint);
+        RL_FREE(bitmap);
+        return 0;
+    }
+
+    // Look for atlas space, evicting least recently used page if atlas is full or no glyph slot is free
+    // NOTE: Every eviction frees one page, so all pages could be evicted in the worst case
+    int page = -1;
+
+    for (int attempt = 0; (page < 0) && (attempt <= FONT_DYNAMIC_ATLAS_PAGES); attempt++)
+    {
+        if (dynamic->freeCount > 0)
+        {
+            for (int i = 0; i < FONT_DYNAMIC_ATLAS_PAGES; i++)
+            {
+                rect.was_packed = 0;
+                stbrp_pack_rects(&dynamic->pages[i].packer, &rect, 1);
+
+                if (rect.was_packed)
+                {
+                    page = i;
+                    break;
+                }
+            }
+        }
+
+        if (page < 0)
+        {
+            int evictPage = -1;
+
+            for (int i = 0; i < FONT_DYNAMIC_ATLAS_PAGES; i++)
+            {
+                if ((dynamic->pages[i].glyphCount > 0) && ((evictPage < 0) || (dynamic->pages[i].lastUsed < dynamic->pages[evictPage].lastUsed))) evictPage = i;
+            }
+
+            if (evictPage < 0) break;
+
+            EvictFontDynamicPage(table, evictPage);
+        }
+    }
+
+    if (page < 0)
+    {
+        RL_FREE(bitmap);
+        return 0;
+    }
+
+    // Upload glyph to atlas, converted to GRAY_ALPHA as GenImageFontAtlas()
+    int pixelsSize = rect.w*rect.h*2;
+
+    if (dynamic->pixelsSize < pixelsSize)
+    {
+        dynamic->pixels = (unsigned char *)RL_REALLOC(dynamic->pixels, pixelsSize);
+        dynamic->pixelsSize = pixelsSize;
+    }
+
+    for (int y = 0; y < rect.h; y++)
+    {
+        for (int x = 0; x < rect.w; x++)
+        {
+            int gx = x - padding;
+            int gy = y - padding;
+
+            dynamic->pixels[(y*rect.w + x)*2] = 255;
+            dynamic->pixels[(y*rect.w + x)*2 + 1] = ((gx >= 0) && (gx < width) && (gy >= 0) && (gy < height))? bitmap[gy*width + gx] : 0;
+        }
+    }
+
+    RL_FREE(bitmap);
+
+    Rectangle rec = { (float)rect.x, (float)(dynamic->pages[page].y + rect.y), (float)rect.w, (float)rect.h };
+    UpdateTextureRec(dynamic->texture, rec, dynamic->pixels);
+
+    // Assign glyph slot and map codepoint to it
+    dynamic->freeCount--;
+    int slot = dynamic->freeSlots[dynamic->freeCount];
+
+    dynamic->slotPages[slot] = page;
+    dynamic->pages[page].glyphCount++;
+    dynamic->glyphs[slot] = (GlyphInfo){ .value = codepoint, .offsetX = offsetX, .offsetY = offsetY, .advanceX = advanceX };
+    dynamic->recs[slot] = (Rectangle){ rec.x + padding, rec.y + padding, (float)width, (float)height };
+
+    if (tablePage == 0)
+    {
+        table->pages = (int *)RL_REALLOC(table->pages, (table->pageCount + 1)*GLYPH_TABLE_PAGE_SIZE*sizeof(int));
+        for (int i = 0; i < GLYPH_TABLE_PAGE_SIZE; i++) table->pages[table->pageCount*GLYPH_TABLE_PAGE_SIZE + i] = -1;
+
+        table->pageCount++;
+        table->pageIndex[codepoint/GLYPH_TABLE_PAGE_SIZE] = (unsigned short)table->pageCount;
+        tablePage = table->pageCount;
+    }
+
+    table->pages[(tablePage - 1)*GLYPH_TABLE_PAGE_SIZE + codepoint%GLYPH_TABLE_PAGE_SIZE] = slot;
+
+    return slot;
+}
+
+// Evict dynamic font atlas page, unloading its glyphs
+// NOTE: Render batch is drawn first, pending glyph quads could reference evicted atlas area
+static void EvictFontDynamicPage(rGlyphTable *table, int page)
+{
+    FontDynamic *dynamic = table->dynamic;
+
+    rlDrawRenderBatchActive();
+
+    for (int i = 1; i < MAX_FONT_DYNAMIC_GLYPHS; i++)
+    {
+        if (dynamic->slotPages[i] == page)
+        {
+            int codepoint = dynamic->glyphs[i].value;
+            table->pages[(table->pageIndex[codepoint/GLYPH_TABLE_PAGE_SIZE] - 1)*GLYPH_TABLE_PAGE_SIZE + codepoint%GLYPH_TABLE_PAGE_SIZE] = -1;
+
+            dynamic->slotPages[i] = -1;
+            dynamic->glyphs[i] = (GlyphInfo){ 0 };
+            dynamic->recs[i] = (Rectangle){ 0 };
+            dynamic->freeSlots[dynamic->freeCount] = i;
+            dynamic->freeCount++;
+        }
+    }
+
+    int pageWidth = FONT_DYNAMIC_ATLAS_SIZE - 2*dynamic->padding;
+    stbrp_init_target(&dynamic->pages[page].packer, pageWidth, FONT_DYNAMIC_ATLAS_SIZE/FONT_DYNAMIC_ATLAS_PAGES, dynamic->pages[page].nodes, pageWidth);
+    dynamic->pages[page].glyphCount = 0;
+    dynamic->pages[page].lastUsed = 0;
+    dynamic->version++;
+
+    TRACELOGD("FONT: Dynamic font atlas page %i evicted", page);
+}
+#endif
+
+// Generate text layout glyph quads and size
+// NOTE: Glyph quads match DrawTextEx() drawing and size matches MeasureTextEx() computation,
+// layout arrays must provide space for one glyph quad per text byte
+static void GenTextLayout(Font font, const char *text, int size, float fontSize, float spacing, TextLayout *layout)
+{
+    float textOffsetY = 0.0f;       // Offset between lines (on linebreak '\n')
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
+
+    int tempByteCounter = 0;        // Used to count longer text line num chars
+    int byteCounter = 0;
+    float textWidth = 0.0f;
+    float tempTextWidth = 0.0f;     // Used to count longer text line width
+    float textHeight = fontSize;
+
+    float scaleFactor = fontSize/(float)font.baseSize;     // Character quad scaling factor
+    float width = (font.texture.width > 0)? (float)font.texture.width : 1.0f;
+    float height = (font.texture.height > 0)? (float)font.texture.height : 1.0f;
+    float padding = (float)font.glyphPadding;
+
+    layout->texture = font.texture;
+    layout->glyphCount = 0;
+
+    for (int i = 0; i < size;)
+    {
+        byteCounter++;
+
+        // Get next codepoint from byte string and glyph index in font
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+        int index = GetGlyphIndex(font, codepoint);
+
+        if (codepoint == '\n')
+        {
+            // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+            textOffsetY += (fontSize + textLineSpacing);
+            textOffsetX = 0.0f;
+
+            if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+            byteCounter = 0;
+            textWidth = 0;
+            textHeight += (fontSize + textLineSpacing);
+        }
+        else
+        {
+            if ((codepoint != ' ') && (codepoint != '\t'))
+            {
+                // Glyph destination and source rectangles, considering glyphPadding (as DrawTextCodepoint())
+                Rectangle rec = font.recs[index];
+                float x = textOffsetX + font.glyphs[index].offsetX*scaleFactor - padding*scaleFactor;
+                float y = textOffsetY + font.glyphs[index].offsetY*scaleFactor - padding*scaleFactor;
+                float w = (rec.width + 2.0f*padding)*scaleFactor;
+                float h = (rec.height + 2.0f*padding)*scaleFactor;
+                float u0 = (rec.x - padding)/width;
+                float v0 = (rec.y - padding)/height;
+                float u1 = (rec.x - padding + rec.width + 2.0f*padding)/width;
+                float v1 = (rec.y - padding + rec.height + 2.0f*padding)/height;
+
+                // Quad vertex order: top-left, bottom-left, bottom-right, top-right
+                float *vertices = &layout->vertices[8*layout->glyphCount];
+                float *texcoords = &layout->texcoords[8*layout->glyphCount];
+
+                vertices[0] = x; vertices[1] = y;
+                vertices[2] = x; vertices[3] = y + h;
+                vertices[4] = x + w; vertices[5] = y + h;
+                vertices[6] = x + w; vertices[7] = y;
+
+                texcoords[0] = u0; texcoords[1] = v0;
+                texcoords[2] = u0; texcoords[3] = v1;
+                texcoords[4] = u1; texcoords[5] = v1;
+                texcoords[6] = u1; texcoords[7] = v0;
+
+                layout->glyphCount++;
+            }
+
+            if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+            else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+
+            if (font.glyphs[index].advanceX > 0) textWidth += font.glyphs[index].advanceX;
+            else textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
+        }
+
+        if (tempByteCounter < byteCounter) tempByteCounter = byteCounter;
+
+        i += codepointByteCount;   // Move text bytes counter to next codepoint
+    }
+
+    if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+
+    layout->size.x = tempTextWidth*scaleFactor + (float)((tempByteCounter - 1)*spacing);
+    layout->size.y = textHeight;
+}
+
+#if defined(SUPPORT_TEXT_LAYOUT_CACHE)
+// Get text layout from cache, generated if not available
+// NOTE: Returns NULL if text can not be cached (empty, longer than MAX_TEXT_BUFFER_LENGTH or dynamic font glyphs not fitting atlas),
+// measured layouts match on font, size and spacing only (atlas pages evictions do not change size),
+// cache lock must be held by caller while using returned layout
+static const TextLayout *GetTextLayoutCached(Font font, const char *text, float fontSize, float spacing, bool measure)
+{
+    if ((text == NULL) || (font.glyphs == NULL)) return NULL;
+
+    // Compute text size and hash in a single pass
+    unsigned int hash = 2166136261u;
+    int size = 0;
+
+    while (text[size] != '\0')
+    {
+        if (size >= MAX_TEXT_BUFFER_LENGTH) return NULL;
+
+        hash = (hash ^ (unsigned char)text[size])*16777619u;
+        size++;
+    }
+
+    if (size == 0) return NULL;
+
+    textLayoutCacheTick++;
+
+    unsigned int atlasVersion = 0;
+#if defined(SUPPORT_FONT_DYNAMIC)
+    FontDynamic *dynamic = (font.glyphTable != NULL)? font.glyphTable->dynamic : NULL;
+    if (dynamic != NULL) atlasVersion = dynamic->version;
+#endif
+
+    TextLayoutCacheEntry *entry = NULL;
+
+    for (int i = 0; i < MAX_TEXT_LAYOUT_CACHE; i++)
+    {
+        TextLayoutCacheEntry *current = &textLayoutCache[i];
+
+        if ((current->text != NULL) && (current->hash == hash) && (current->textSize == size) &&
+            (current->glyphs == font.glyphs) && (current->textureId == font.texture.id) &&
+            (current->fontSize == fontSize) && (current->spacing == spacing) &&
+            (current->lineSpacing == textLineSpacing) && (measure || (current->atlasVersion == atlasVersion)) &&
+            (memcmp(current->text, text, size) == 0))
+        {
+            current->lastUsed = textLayoutCacheTick;
+
+#if defined(SUPPORT_FONT_DYNAMIC)
+            // Glyphs are not looked up for cached layouts, layout atlas pages are marked as used (drawing)
+            if ((dynamic != NULL) && !measure)
+            {
+                dynamic->tick++;
+                for (int p = 0; p < FONT_DYNAMIC_ATLAS_PAGES; p++) if (current->atlasPages & (1u << p)) dynamic->pages[p].lastUsed = dynamic->tick;
+            }
+#endif
+            return &current->layout;
+        }
+
+        // Keep track of least recently used entry, free entries first
+        if ((entry == NULL) || ((entry->text != NULL) && ((current->text == NULL) || (current->lastUsed < entry->lastUsed)))) entry = current;
+    }
+
+    // Reuse evicted entry memory, growing it if required
+    if (entry->capacity < size)
+    {
+        entry->text = (char *)RL_REALLOC(entry->text, size + 1);
+        entry->layout.vertices = (float *)RL_REALLOC(entry->layout.vertices, size*8*sizeof(float));
+        entry->layout.texcoords = (float *)RL_REALLOC(entry->layout.texcoords, size*8*sizeof(float));
+        entry->capacity = size;
+    }
+
+    memcpy(entry->text, text, size + 1);
+    entry->hash = hash;
+    entry->textSize = size;
+    entry->glyphs = font.glyphs;
+    entry->textureId = font.texture.id;
+    entry->fontSize = fontSize;
+    entry->spacing = spacing;
+    entry->lineSpacing = textLineSpacing;
+    entry->atlasVersion = atlasVersion;
+    entry->atlasPages = 0;
+    entry->lastUsed = textLayoutCacheTick;
+
+#if defined(SUPPORT_FONT_DYNAMIC)
+    // Dynamic fonts could evict an atlas page while generating the layout, glyph quads generated
+    // before eviction would reference it, so layout is generated again with all its glyphs loaded
+    // NOTE: If page evictions persist, text glyphs do not fit in atlas together, layout is not cached
+    for (int attempt = 0; ; attempt++)
+    {
+        if (dynamic != NULL)
+        {
+            dynamic->usedPages = 0;
+            entry->atlasVersion = dynamic->version;
+        }
+
+        GenTextLayout(font, text, size, fontSize, spacing, &entry->layout);
+
+        if ((dynamic == NULL) || (dynamic->version == entry->atlasVersion)) break;
+
+        if (attempt > 0)
+        {
+            entry->glyphs = NULL;       // Entry is not matched anymore, memory is reused first
+            entry->lastUsed = 0;
+            return NULL;
+        }
+    }
+
+    if (dynamic != NULL) entry->atlasPages = dynamic->usedPages;
+#else
+    GenTextLayout(font, text, size, fontSize, spacing, &entry->layout);
+#endif
+
+    return &entry->layout;
+}
+
+// Unload cached text layouts for font glyphs (NULL for all)
+static void UnloadTextLayoutCache(const GlyphInfo *glyphs)
+{
+#if defined(SUPPORT_JOB_SYSTEM) || defined(SUPPORT_ASYNC_LOADING)
+    pthread_mutex_lock(&textLayoutCacheLock);
+#endif
+    for (int i = 0; i < MAX_TEXT_LAYOUT_CACHE; i++)
+    {
+        TextLayoutCacheEntry *entry = &textLayoutCache[i];
+
+        if ((entry->text != NULL) && ((glyphs == NULL) || (entry->glyphs == glyphs)))
+        {
+            RL_FREE(entry->text);
+            RL_FREE(entry->layout.vertices);
+            RL_FREE(entry->layout.texcoords);
+            *entry = (TextLayoutCacheEntry){ 0 };
+        }
+    }
+#if defined(SUPPORT_JOB_SYSTEM) || defined(SUPPORT_ASYNC_LOADING)
+    pthread_mutex_unlock(&textLayoutCacheLock);
+#endif
+}
+#endif
+
 #if defined(SUPPORT_FILEFORMAT_FNT) || defined(SUPPORT_FILEFORMAT_BDF)
 // Read a line from memory
 // REQUIRES: memcpy()
@@ -2306,6 +3126,8 @@ static Font LoadBMFont(const char *fileName)
     UnloadImage(fullFont);
     UnloadFileText(fileText);
 
+    font.glyphTable = LoadGlyphTable(font.glyphs, font.glyphCount);
+
     if (isGpuReady && (font.texture.id == 0))
     {
         UnloadFont(font);
@@ -2570,4 +3392,126 @@ static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, i
 }
 #endif      // SUPPORT_FILEFORMAT_BDF
 
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Rasterize glyphs group, job system function
+// NOTE: Font info is only read, every job writes its own glyphs range
+static void RasterizeGlyphsJob(void *userData, int job)
+{
+    GlyphRasterBatch *batch = (GlyphRasterBatch *)userData;
+    GlyphInfo *glyphs = batch->glyphs;
+
+    int end = (job + 1)*FONT_GLYPHS_PER_JOB;
+    if (end > batch->codepointCount) end = batch->codepointCount;
+
+    for (int i = job*FONT_GLYPHS_PER_JOB; i < end; i++)
+    {
+        int chw = 0, chh = 0;   // Character width and height (on generation)
+        int ch = batch->codepoints[i];  // Character value to get info for
+        glyphs[i].value = ch;
+
+        //  Render a unicode codepoint to a bitmap
+        //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
+        //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
+        //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+
+        // Check if a glyph is available in the font
+        // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
+        int index = stbtt_FindGlyphIndex(batch->fontInfo, ch);
+
+        if (index > 0)
+        {
+            switch (batch->type)
+            {
+                case FONT_DEFAULT:
+                case FONT_BITMAP: glyphs[i].image.data = stbtt_GetCodepointBitmap(batch->fontInfo, batch->scaleFactor, batch->scaleFactor, ch, &chw, &chh, &glyphs[i].offsetX, &glyphs[i].offsetY); break;
+                case FONT_SDF: if (ch != 32) glyphs[i].image.data = stbtt_GetCodepointSDF(batch->fontInfo, batch->scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &glyphs[i].offsetX, &glyphs[i].offsetY); break;
+                default: break;
+            }
+
+            if (glyphs[i].image.data != NULL)    // Glyph data has been found in the font
+            {
+                stbtt_GetCodepointHMetrics(batch->fontInfo, ch, &glyphs[i].advanceX, NULL);
+                glyphs[i].advanceX = (int)((float)glyphs[i].advanceX*batch->scaleFactor);
+
+                if (chh > batch->fontSize) TRACELOG(LOG_WARNING, "FONT: Character [0x%08x] size is bigger than expected font size", ch);
+
+                // Load characters images
+                glyphs[i].image.width = chw;
+                glyphs[i].image.height = chh;
+                glyphs[i].image.mipmaps = 1;
+                glyphs[i].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+                glyphs[i].offsetY += (int)((float)batch->ascent*batch->scaleFactor);
+            }
+
+            // NOTE: We create an empty image for space character,
+            // it could be further required for atlas packing
+            if (ch == 32)
+            {
+                stbtt_GetCodepointHMetrics(batch->fontInfo, ch, &glyphs[i].advanceX, NULL);
+                glyphs[i].advanceX = (int)((float)glyphs[i].advanceX*batch->scaleFactor);
+
+                Image imSpace = {
+                    .data = RL_CALLOC(glyphs[i].advanceX*batch->fontSize, 2),
+                    .width = glyphs[i].advanceX,
+                    .height = batch->fontSize,
+                    .mipmaps = 1,
+                    .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+                };
+
+                glyphs[i].image = imSpace;
+            }
+
+            if (batch->type == FONT_BITMAP)
+            {
+                // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+                // NOTE: For optimum results, bitmap font should be generated at base pixel size
+                for (int p = 0; p < chw*chh; p++)
+                {
+                    if (((unsigned char *)glyphs[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)glyphs[i].image.data)[p] = 0;
+                    else ((unsigned char *)glyphs[i].image.data)[p] = 255;
+                }
+            }
+        }
+        else
+        {
+            // TODO: Use some fallback glyph for codepoints not found in the font
+        }
+    }
+}
+#endif
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Load font data and atlas (loading thread)
+static bool LoadFontAsyncData(void *data)
+{
+    FontAsyncLoad *load = (FontAsyncLoad *)data;
+
+    load->font = LoadFontEx(load->fileName, load->fontSize, NULL, 0);
+
+    return (load->font.glyphs != NULL);
+}
+
+// Upload font atlas texture (main thread)
+static bool UploadFontAsyncData(void *data, AsyncUploads *uploads)
+{
+    FontAsyncLoad *load = (FontAsyncLoad *)data;
+
+    UploadAsyncTexture(uploads, &load->font.texture);
+
+    return true;
+}
+
+// Unload font async load data not retrieved (main thread)
+static void UnloadFontAsyncData(void *data, bool uploaded)
+{
+    FontAsyncLoad *load = (FontAsyncLoad *)data;
+
+    // Deferred texture was never uploaded, it must not be unloaded
+    if (!uploaded && (load->font.texture.id & ASYNC_DEFERRED_TEXTURE)) load->font.texture.id = 0;
+
+    UnloadFont(load->font);
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RTEXT
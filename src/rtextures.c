@@ -78,6 +78,10 @@
 #include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
 
+#if defined(SUPPORT_JOB_SYSTEM) || defined(SUPPORT_ASYNC_LOADING)
+    #include <pthread.h>        // Required for: pthread_once() [Used in GenImageMipmapsRec()]
+#endif
+
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
     #define STBI_NO_BMP
@@ -225,6 +229,18 @@
     #pragma GCC diagnostic pop
 #endif
 
+// Mipmaps generation SIMD path (RGBA8 box filter): SSE2 on x86/x64, NEON on ARM, scalar fallback otherwise
+// NOTE: Define MIPMAPS_DISABLE_SIMD to force the scalar path
+#if !defined(MIPMAPS_DISABLE_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define MIPMAPS_SSE2
+        #include <emmintrin.h>      // Required for: SSE2 intrinsics [Used in GenMipmapRowsBox()]
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define MIPMAPS_NEON
+        #include <arm_neon.h>       // Required for: NEON intrinsics [Used in GenMipmapRowsBox()]
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -236,15 +252,97 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef IMAGE_JOB_ROWS
+    #define IMAGE_JOB_ROWS           16    // Image rows (or columns) per job on image processing split in bands
+#endif
+#ifndef IMAGE_JOB_RESIZE_SPLITS
+    #define IMAGE_JOB_RESIZE_SPLITS  16    // Maximum ImageResize() splits, every split requires its own scratch memory
+#endif
+
+#define MIPMAP_MAX_LEVELS            32    // Maximum mipmap levels (including base level) for an image size
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Pixel span accessors, convert a span of pixels from/to Color (RGBA - 32bit)
+typedef void (*PixelSpanReader)(const void *src, Color *colors, int count);
+typedef void (*PixelSpanWriter)(void *dst, const Color *colors, int count);
+
+// Pixel format span accessors
+typedef struct PixelSpanFormat {
+    int bytesPerPixel;          // Pixel size in bytes
+    PixelSpanReader read;       // Read pixels span into colors
+    PixelSpanWriter write;      // Write colors span into pixels
+} PixelSpanFormat;
+
+// Image box blur pass data, processed in bands of rows (horizontal) or columns (vertical)
+typedef struct ImageBlurPass {
+    const Vector4 *src;         // Source pixels
+    Vector4 *dst;               // Destination pixels
+    int width;                  // Image width
+    int height;                 // Image height
+    int blurSize;               // Blur window radius
+} ImageBlurPass;
+
+// Image kernel convolution data, processed in bands of rows
+typedef struct ImageConvolution {
+    const Color *pixels;        // Source pixels
+    Vector4 *output;            // Convolution result (normalized)
+    const float *kernel;        // Convolution kernel
+    int kernelWidth;            // Kernel width (square kernel)
+    int width;                  // Image width
+    int height;                 // Image height
+} ImageConvolution;
+
+// Mipmap filter taps, separable filter applied on both axis
+// NOTE: Destination pixel d samples source pixels [2*d + first, 2*d + first + count)
+typedef struct MipmapFilterTaps {
+    int first;                  // First tap offset from 2*d
+    int count;                  // Number of taps
+    float weights[6];           // Taps weights (normalized)
+} MipmapFilterTaps;
+
+// Mipmap filter tables, 8 bit channel values to normalized linear values and back, filters taps
+typedef struct MipmapFilterTables {
+    float decode[2][256];       // Channel decoding: [0] linear, [1] sRGB to linear
+    float srgbThresholds[255];  // Linear values at sRGB encoding rounding boundaries
+    MipmapFilterTaps taps[2];   // Filters taps: [0] box, [1] Kaiser
+} MipmapFilterTables;
+
+// Mipmap level generation data, region of a level generated from previous level, processed in bands of rows
+typedef struct MipmapLevelPass {
+    const unsigned char *src;   // Source level pixels (previous level)
+    unsigned char *dst;         // Destination level pixels
+    int srcWidth;               // Source level width
+    int srcHeight;              // Source level height
+    int dstWidth;               // Destination level width
+    int channels;               // Bytes per pixel (8 bit per channel)
+    int x0, y0;                 // Destination region start
+    int x1, y1;                 // Destination region end (exclusive)
+    bool integerBox;            // Use integer box filter (linear data, source level at least 2x2)
+    int srgbChannels;           // Color channels filtered in linear space (0 if not sRGB)
+    const MipmapFilterTaps *taps;       // Filter taps
+    const MipmapFilterTables *tables;   // Channel decoding tables
+} MipmapLevelPass;
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Texture async load data
+typedef struct TextureAsyncLoad {
+    char *fileName;             // File name, stored after struct
+    Image image;                // Image loaded on loading thread
+    Texture2D texture;          // Texture uploaded on main thread
+} TextureAsyncLoad;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+static MipmapFilterTables mipmapTables = { 0 };        // Mipmap filter tables, built once (InitMipmapFilterTables())
+#if defined(SUPPORT_JOB_SYSTEM) || defined(SUPPORT_ASYNC_LOADING)
+static pthread_once_t mipmapTablesOnce = PTHREAD_ONCE_INIT;
+#else
+static bool mipmapTablesReady = false;
+#endif
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -257,6 +355,53 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static bool ImageFormatDirect(Image *image, int newFormat); // Convert image data to desired format with direct per-channel mapping
+static void RunImageJobs(JobFunction func, void *userData, int count);   // Run image processing jobs, in parallel if enabled
+static void ResizeImageData(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int channels); // Resize 8 bit per channel pixel data
+static void BlurImageRowsJob(void *userData, int index);    // Horizontal box blur of a band of rows
+static void BlurImageColumnsJob(void *userData, int index); // Vertical box blur of a band of columns
+static void ConvolveImageRowsJob(void *userData, int index);    // Kernel convolution of a band of rows
+static float BesselI0(float x);                             // Modified Bessel function of the first kind, order 0
+static void InitMipmapFilterTables(void);                   // Init mipmap filter tables (channel decoding and filters taps)
+static void GenMipmapLevelJob(void *userData, int index);   // Generate a band of rows of a mipmap level region
+static void GenMipmapRowsBox(const MipmapLevelPass *pass, int rowStart, int rowEnd);        // Generate mipmap level rows with integer 2x2 average
+static void GenMipmapRowsFiltered(const MipmapLevelPass *pass, int rowStart, int rowEnd);   // Generate mipmap level rows with separable float filter
+static int GenImageMipmapsRec(Image *image, Rectangle rec, int filter, bool srgb, Rectangle *levelRecs);  // Generate image mipmap levels regions affected by base level rectangle
+static const PixelSpanFormat *GetPixelSpanFormat(int format);  // Get pixel span accessors for an uncompressed pixel format
+static void ReadPixelSpanGrayscale(const void *src, Color *colors, int count);
+static void ReadPixelSpanGrayAlpha(const void *src, Color *colors, int count);
+static void ReadPixelSpanR5G6B5(const void *src, Color *colors, int count);
+static void ReadPixelSpanR8G8B8(const void *src, Color *colors, int count);
+static void ReadPixelSpanR5G5B5A1(const void *src, Color *colors, int count);
+static void ReadPixelSpanR4G4B4A4(const void *src, Color *colors, int count);
+static void ReadPixelSpanR8G8B8A8(const void *src, Color *colors, int count);
+static void ReadPixelSpanR32(const void *src, Color *colors, int count);
+static void ReadPixelSpanR32G32B32(const void *src, Color *colors, int count);
+static void ReadPixelSpanR32G32B32A32(const void *src, Color *colors, int count);
+static void ReadPixelSpanR16(const void *src, Color *colors, int count);
+static void ReadPixelSpanR16G16B16(const void *src, Color *colors, int count);
+static void ReadPixelSpanR16G16B16A16(const void *src, Color *colors, int count);
+static void WritePixelSpanGrayscale(void *dst, const Color *colors, int count);
+static void WritePixelSpanGrayAlpha(void *dst, const Color *colors, int count);
+static void WritePixelSpanR5G6B5(void *dst, const Color *colors, int count);
+static void WritePixelSpanR8G8B8(void *dst, const Color *colors, int count);
+static void WritePixelSpanR5G5B5A1(void *dst, const Color *colors, int count);
+static void WritePixelSpanR4G4B4A4(void *dst, const Color *colors, int count);
+static void WritePixelSpanR8G8B8A8(void *dst, const Color *colors, int count);
+static void WritePixelSpanR32(void *dst, const Color *colors, int count);
+static void WritePixelSpanR32G32B32(void *dst, const Color *colors, int count);
+static void WritePixelSpanR32G32B32A32(void *dst, const Color *colors, int count);
+static void WritePixelSpanR16(void *dst, const Color *colors, int count);
+static void WritePixelSpanR16G16B16(void *dst, const Color *colors, int count);
+static void WritePixelSpanR16G16B16A16(void *dst, const Color *colors, int count);
+#if defined(SUPPORT_FILEFORMAT_DDS)
+static Texture2D LoadTextureFromDDSView(FileView fileView);  // Load texture from compressed DDS file view, with no image data copy
+#endif
+#if defined(SUPPORT_ASYNC_LOADING)
+static bool LoadTextureAsyncData(void *data);               // Load texture image (loading thread)
+static bool UploadTextureAsyncData(void *data, AsyncUploads *uploads);  // Upload texture image (main thread)
+static void UnloadTextureAsyncData(void *data, bool uploaded);  // Unload texture async load data not retrieved (main thread)
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -280,18 +425,16 @@ Image LoadImage(const char *fileName)
     #define STBI_REQUIRED
 #endif
 
-    // Loading file to memory
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // Loading image straight from file view (memory mapped when supported)
+    FileView fileView = LoadFileView(fileName);
 
-    // Loading image from memory data
-    if (fileData != NULL)
+    if ((fileView.data != NULL) && (fileView.size <= 2147483647))
     {
-        image = LoadImageFromMemory(GetFileExtension(fileName), fileData, dataSize);
-
-        UnloadFileData(fileData);
+        image = LoadImageFromMemory(GetFileExtension(fileName), fileView.data, (int)fileView.size);
     }
 
+    UnloadFileView(fileView);
+
     return image;
 }
 
@@ -300,18 +443,18 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
 {
     Image image = { 0 };
 
-    int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    // NOTE: Raw data is copied straight from file view, only once
+    FileView fileView = LoadFileView(fileName);
 
-    if (fileData != NULL)
+    if (fileView.data != NULL)
     {
-        unsigned char *dataPtr = fileData;
+        const unsigned char *dataPtr = fileView.data;
         int size = GetPixelDataSize(width, height, format);
 
-        if (size <= dataSize)   // Security check
+        if (size <= fileView.size)   // Security check
         {
             // Offset file data to expected raw image by header size
-            if ((headerSize > 0) && ((headerSize + size) <= dataSize)) dataPtr += headerSize;
+            if ((headerSize > 0) && ((headerSize + size) <= fileView.size)) dataPtr += headerSize;
 
             image.data = RL_MALLOC(size);      // Allocate required memory in bytes
             memcpy(image.data, dataPtr, size); // Copy required data to image
@@ -321,7 +464,7 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
             image.format = format;
         }
 
-        UnloadFileData(fileData);
+        UnloadFileView(fileView);
     }
 
     return image;
@@ -340,21 +483,21 @@ Image LoadImageAnim(const char *fileName, int *frames)
 #if defined(SUPPORT_FILEFORMAT_GIF)
     if (IsFileExtension(fileName, ".gif"))
     {
-        int dataSize = 0;
-        unsigned char *fileData = LoadFileData(fileName, &dataSize);
+        FileView fileView = LoadFileView(fileName);
 
-        if (fileData != NULL)
+        if ((fileView.data != NULL) && (fileView.size <= 2147483647))
         {
             int comp = 0;
             int *delays = NULL;
-            image.data = stbi_load_gif_from_memory(fileData, dataSize, &delays, &image.width, &image.height, &frameCount, &comp, 4);
+            image.data = stbi_load_gif_from_memory(fileView.data, (int)fileView.size, &delays, &image.width, &image.height, &frameCount, &comp, 4);
 
             image.mipmaps = 1;
             image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
-            UnloadFileData(fileData);
             RL_FREE(delays);        // NOTE: Frames delays are discarded
         }
+
+        UnloadFileView(fileView);
     }
 #else
     if (false) { }
@@ -1260,6 +1403,21 @@ void ImageFormat(Image *image, int newFormat)
     {
         if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
+            // Try direct conversion first, avoids the full image normalized Vector4 intermediate
+            if (ImageFormatDirect(image, newFormat))
+            {
+                // In case original image had mipmaps, generate mipmaps for formatted image
+                if (image->mipmaps > 1)
+                {
+                    image->mipmaps = 1;
+                #if defined(SUPPORT_IMAGE_MANIPULATION)
+                    ImageMipmaps(image);
+                #endif
+                }
+
+                return;
+            }
+
             Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
 
             RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
@@ -1750,6 +1908,7 @@ void ImageResizeNN(Image *image,int newWidth,int newHeight)
 // NOTE: Uses stb default scaling filters (both bicubic):
 // STBIR_DEFAULT_FILTER_UPSAMPLE    STBIR_FILTER_CATMULLROM
 // STBIR_DEFAULT_FILTER_DOWNSAMPLE  STBIR_FILTER_MITCHELL   (high-quality Catmull-Rom)
+// NOTE: If SUPPORT_IMAGE_JOBS is enabled, output rows are split across job system workers
 void ImageResize(Image *image, int newWidth, int newHeight)
 {
     // Security check to avoid program crash
@@ -1765,14 +1924,8 @@ void ImageResize(Image *image, int newWidth, int newHeight)
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
         unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*bytesPerPixel);
 
-        switch (image->format)
-        {
-            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)1); break;
-            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)2); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)3); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)4); break;
-            default: break;
-        }
+        // NOTE: Bytes per pixel match channels count for those formats
+        ResizeImageData((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, bytesPerPixel);
 
         RL_FREE(image->data);
         image->data = output;
@@ -1786,7 +1939,7 @@ void ImageResize(Image *image, int newWidth, int newHeight)
         Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
         // NOTE: Color data is cast to (unsigned char *), there shouldn't been any problem...
-        stbir_resize_uint8_linear((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, (stbir_pixel_layout)4);
+        ResizeImageData((unsigned char *)pixels, image->width, image->height, (unsigned char *)output, newWidth, newHeight, 4);
 
         int format = image->format;
 
@@ -2090,6 +2243,7 @@ void ImageAlphaPremultiply(Image *image)
 }
 
 // Apply box blur to image
+// NOTE: If SUPPORT_IMAGE_JOBS is enabled, blur passes are split across job system workers
 void ImageBlurGaussian(Image *image, int blurSize)
 {
     // Security check to avoid program crash
@@ -2112,94 +2266,14 @@ void ImageBlurGaussian(Image *image, int blurSize)
     }
 
     // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
+    // NOTE: Rows (horizontal) and columns (vertical) are independent, passes are split in bands
+    ImageBlurPass horizontal = { pixelsCopy1, pixelsCopy2, image->width, image->height, blurSize };
+    ImageBlurPass vertical = { pixelsCopy2, pixelsCopy1, image->width, image->height, blurSize };
+
     for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++)
     {
-        // Horizontal motion blur
-        for (int row = 0; row < image->height; row++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
-
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy1[row*image->width + i].x;
-                avgG += pixelsCopy1[row*image->width + i].y;
-                avgB += pixelsCopy1[row*image->width + i].z;
-                avgAlpha += pixelsCopy1[row*image->width + i].w;
-            }
-
-            for (int x = 0; x < image->width; x++)
-            {
-                if (x-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy1[row*image->width + x-blurSize-1].x;
-                    avgG -= pixelsCopy1[row*image->width + x-blurSize-1].y;
-                    avgB -= pixelsCopy1[row*image->width + x-blurSize-1].z;
-                    avgAlpha -= pixelsCopy1[row*image->width + x-blurSize-1].w;
-                    convolutionSize--;
-                }
-
-                if (x+blurSize < image->width)
-                {
-                    avgR += pixelsCopy1[row*image->width + x+blurSize].x;
-                    avgG += pixelsCopy1[row*image->width + x+blurSize].y;
-                    avgB += pixelsCopy1[row*image->width + x+blurSize].z;
-                    avgAlpha += pixelsCopy1[row*image->width + x+blurSize].w;
-                    convolutionSize++;
-                }
-
-                pixelsCopy2[row*image->width + x].x = avgR/convolutionSize;
-                pixelsCopy2[row*image->width + x].y = avgG/convolutionSize;
-                pixelsCopy2[row*image->width + x].z = avgB/convolutionSize;
-                pixelsCopy2[row*image->width + x].w = avgAlpha/convolutionSize;
-            }
-        }
-
-        // Vertical motion blur
-        for (int col = 0; col < image->width; col++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
-
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy2[i*image->width + col].x;
-                avgG += pixelsCopy2[i*image->width + col].y;
-                avgB += pixelsCopy2[i*image->width + col].z;
-                avgAlpha += pixelsCopy2[i*image->width + col].w;
-            }
-
-            for (int y = 0; y < image->height; y++)
-            {
-                if (y-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy2[(y-blurSize-1)*image->width + col].x;
-                    avgG -= pixelsCopy2[(y-blurSize-1)*image->width + col].y;
-                    avgB -= pixelsCopy2[(y-blurSize-1)*image->width + col].z;
-                    avgAlpha -= pixelsCopy2[(y-blurSize-1)*image->width + col].w;
-                    convolutionSize--;
-                }
-                if (y+blurSize < image->height)
-                {
-                    avgR += pixelsCopy2[(y+blurSize)*image->width + col].x;
-                    avgG += pixelsCopy2[(y+blurSize)*image->width + col].y;
-                    avgB += pixelsCopy2[(y+blurSize)*image->width + col].z;
-                    avgAlpha += pixelsCopy2[(y+blurSize)*image->width + col].w;
-                    convolutionSize++;
-                }
-
-                pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
-                pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
-                pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
-                pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
-            }
-        }
+        RunImageJobs(BlurImageRowsJob, &horizontal, (image->height + IMAGE_JOB_ROWS - 1)/IMAGE_JOB_ROWS);     // Horizontal motion blur
+        RunImageJobs(BlurImageColumnsJob, &vertical, (image->width + IMAGE_JOB_ROWS - 1)/IMAGE_JOB_ROWS);     // Vertical motion blur
     }
 
     // Reverse premultiply
@@ -2235,6 +2309,7 @@ void ImageBlurGaussian(Image *image, int blurSize)
 
 // Apply custom square convolution kernel to image
 // NOTE: The convolution kernel matrix is expected to be square
+// NOTE: If SUPPORT_IMAGE_JOBS is enabled, image rows are split across job system workers
 void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
 {
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || kernel == NULL) return;
@@ -2250,98 +2325,10 @@ void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
     Color *pixels = LoadImageColors(*image);
 
     Vector4 *imageCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *temp = RL_MALLOC(kernelSize*sizeof(Vector4));
-
-    for (int i = 0; i < kernelSize; i++)
-    {
-        temp[i].x = 0.0f;
-        temp[i].y = 0.0f;
-        temp[i].z = 0.0f;
-        temp[i].w = 0.0f;
-    }
 
-    float rRes = 0.0f;
-    float gRes = 0.0f;
-    float bRes = 0.0f;
-    float aRes = 0.0f;
-
-    int startRange = 0, endRange = 0;
-
-    if (kernelWidth%2 == 0)
-    {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2;
-    }
-    else
-    {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2 + 1;
-    }
-
-    for (int x = 0; x < image->height; x++)
-    {
-        for (int y = 0; y < image->width; y++)
-        {
-            for (int xk = startRange; xk < endRange; xk++)
-            {
-                for (int yk = startRange; yk < endRange; yk++)
-                {
-                    int xkabs = xk + kernelWidth/2;
-                    int ykabs = yk + kernelWidth/2;
-                    unsigned int imgindex = image->width*(x + xk) + (y + yk);
-
-                    if (imgindex >= (unsigned int)(image->width*image->height))
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].y = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].z = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].w = 0.0f;
-                    }
-                    else
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = ((float)pixels[imgindex].r)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].y = ((float)pixels[imgindex].g)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].z = ((float)pixels[imgindex].b)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].w = ((float)pixels[imgindex].a)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                    }
-                }
-            }
-
-            for (int i = 0; i < kernelSize; i++)
-            {
-                rRes += temp[i].x;
-                gRes += temp[i].y;
-                bRes += temp[i].z;
-                aRes += temp[i].w;
-            }
-
-            if (rRes < 0.0f) rRes = 0.0f;
-            if (gRes < 0.0f) gRes = 0.0f;
-            if (bRes < 0.0f) bRes = 0.0f;
-
-            if (rRes > 1.0f) rRes = 1.0f;
-            if (gRes > 1.0f) gRes = 1.0f;
-            if (bRes > 1.0f) bRes = 1.0f;
-
-            imageCopy2[image->width*x + y].x = rRes;
-            imageCopy2[image->width*x + y].y = gRes;
-            imageCopy2[image->width*x + y].z = bRes;
-            imageCopy2[image->width*x + y].w = aRes;
-
-            rRes = 0.0f;
-            gRes = 0.0f;
-            bRes = 0.0f;
-            aRes = 0.0f;
-
-            for (int i = 0; i < kernelSize; i++)
-            {
-                temp[i].x = 0.0f;
-                temp[i].y = 0.0f;
-                temp[i].z = 0.0f;
-                temp[i].w = 0.0f;
-            }
-        }
-    }
+    // NOTE: Every output pixel only depends on source pixels, rows are split in bands
+    ImageConvolution convolution = { pixels, imageCopy2, kernel, kernelWidth, image->width, image->height };
+    RunImageJobs(ConvolveImageRowsJob, &convolution, (image->height + IMAGE_JOB_ROWS - 1)/IMAGE_JOB_ROWS);
 
     for (int i = 0; i < (image->width*image->height); i++)
     {
@@ -2356,7 +2343,6 @@ void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
     int format = image->format;
     RL_FREE(image->data);
     RL_FREE(imageCopy2);
-    RL_FREE(temp);
 
     image->data = pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
@@ -2367,6 +2353,7 @@ void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
 // NOTE 1: Supports POT and NPOT images
 // NOTE 2: image.data is scaled to include mipmap levels
 // NOTE 3: Mipmaps format is the same as base image
+// NOTE 4: Levels are generated in order, every level resize is split across job system workers (SUPPORT_IMAGE_JOBS)
 void ImageMipmaps(Image *image)
 {
     // Security check to avoid program crash
@@ -2437,6 +2424,71 @@ void ImageMipmaps(Image *image)
     else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps already available");
 }
 
+// Generate all mipmap levels for a provided image with a filter (MipmapFilter)
+// NOTE 1: Supports 8 bit per channel formats (grayscale, gray-alpha, R8G8B8, R8G8B8A8), other formats fallback to ImageMipmaps()
+// NOTE 2: image.data is reallocated once to include all levels, every level is generated in place from previous one
+// NOTE 3: Already available mipmap levels are regenerated, no reallocation required
+// NOTE 4: Color channels are filtered in linear space if srgb requested, alpha is always linear
+void ImageMipmapsEx(Image *image, int filter, bool srgb)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if ((image->format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (image->format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) &&
+        (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Mipmaps filter not supported for pixel format, using default generation");
+        ImageMipmaps(image);
+        return;
+    }
+
+    int mipCount = 1;                   // Required mipmap levels count (including base level)
+    int mipWidth = image->width;        // Base image width
+    int mipHeight = image->height;      // Base image height
+    int mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);  // Image data size (in bytes)
+
+    // Count mipmap levels required
+    while ((mipWidth != 1) || (mipHeight != 1))
+    {
+        if (mipWidth != 1) mipWidth /= 2;
+        if (mipHeight != 1) mipHeight /= 2;
+
+        // Security check for NPOT textures
+        if (mipWidth < 1) mipWidth = 1;
+        if (mipHeight < 1) mipHeight = 1;
+
+        mipCount++;
+        mipSize += GetPixelDataSize(mipWidth, mipHeight, image->format);       // Add mipmap size (in bytes)
+    }
+
+    if (image->mipmaps < mipCount)
+    {
+        void *temp = RL_REALLOC(image->data, mipSize);
+
+        if (temp == NULL)
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+            return;
+        }
+
+        image->data = temp;
+        image->mipmaps = mipCount;
+    }
+
+    GenImageMipmapsRec(image, (Rectangle){ 0, 0, (float)image->width, (float)image->height }, filter, srgb, NULL);
+}
+
+// Regenerate mipmap levels regions affected by a base level rectangle, with a filter (MipmapFilter)
+// NOTE: Only available mipmap levels are regenerated, use ImageMipmapsEx() to generate them first
+void ImageMipmapsRec(Image *image, Rectangle rec, int filter, bool srgb)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->mipmaps <= 1) TRACELOG(LOG_WARNING, "IMAGE: No mipmap levels available to regenerate");
+    else if (GenImageMipmapsRec(image, rec, filter, srgb, NULL) == 0) TRACELOG(LOG_WARNING, "IMAGE: Mipmaps filter not supported for pixel format");
+}
+
 // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
 // NOTE: In case selected bpp do not represent a known 16bit format,
 // dithered data is stored in the LSB part of the unsigned short
@@ -2937,7 +2989,9 @@ Color *LoadImageColors(Image image)
 
     Color *pixels = (Color *)RL_MALLOC(image.width*image.height*sizeof(Color));
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    const PixelSpanFormat *spanFormat = GetPixelSpanFormat(image.format);
+
+    if (spanFormat == NULL) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
     else
     {
         if ((image.format == PIXELFORMAT_UNCOMPRESSED_R32) ||
@@ -2948,132 +3002,8 @@ Color *LoadImageColors(Image image)
             (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) ||
             (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 16bit to 8bit per channel");
 
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
-        {
-            switch (image.format)
-            {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[i];
-                    pixels[i].g = ((unsigned char *)image.data)[i];
-                    pixels[i].b = ((unsigned char *)image.data)[i];
-                    pixels[i].a = 255;
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k];
-                    pixels[i].b = ((unsigned char *)image.data)[k];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
-
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
-                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
-                    pixels[i].a = 255;
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
-                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
-
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
-                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
-
-                    k += 1;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = (unsigned char)(((float *)image.data)[k + 3]*255.0f);
-
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
-
-                    k += 1;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
-                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
-                    pixels[i].a = 255;
-
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
-                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
-                    pixels[i].a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 3])*255.0f);
-
-                    k += 4;
-                } break;
-                default: break;
-            }
-        }
+        // NOTE: Image rows are contiguous, all pixels are converted as a single span
+        spanFormat->read(image.data, pixels, image.width*image.height);
     }
 
     return pixels;
@@ -3195,120 +3125,10 @@ Color GetImageColor(Image image, int x, int y)
 
     if ((x >=0) && (x < image.width) && (y >= 0) && (y < image.height))
     {
-        switch (image.format)
-        {
-            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-            {
-                color.r = ((unsigned char *)image.data)[y*image.width + x];
-                color.g = ((unsigned char *)image.data)[y*image.width + x];
-                color.b = ((unsigned char *)image.data)[y*image.width + x];
-                color.a = 255;
+        const PixelSpanFormat *spanFormat = GetPixelSpanFormat(image.format);
 
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-            {
-                color.r = ((unsigned char *)image.data)[(y*image.width + x)*2];
-                color.g = ((unsigned char *)image.data)[(y*image.width + x)*2];
-                color.b = ((unsigned char *)image.data)[(y*image.width + x)*2];
-                color.a = ((unsigned char *)image.data)[(y*image.width + x)*2 + 1];
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-            {
-                unsigned short pixel = ((unsigned short *)image.data)[y*image.width + x];
-
-                color.r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                color.g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                color.b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                color.a = (unsigned char)((pixel & 0b0000000000000001)*255);
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-            {
-                unsigned short pixel = ((unsigned short *)image.data)[y*image.width + x];
-
-                color.r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                color.g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
-                color.b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
-                color.a = 255;
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-            {
-                unsigned short pixel = ((unsigned short *)image.data)[y*image.width + x];
-
-                color.r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
-                color.g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
-                color.b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
-                color.a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-            {
-                color.r = ((unsigned char *)image.data)[(y*image.width + x)*4];
-                color.g = ((unsigned char *)image.data)[(y*image.width + x)*4 + 1];
-                color.b = ((unsigned char *)image.data)[(y*image.width + x)*4 + 2];
-                color.a = ((unsigned char *)image.data)[(y*image.width + x)*4 + 3];
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-            {
-                color.r = (unsigned char)((unsigned char *)image.data)[(y*image.width + x)*3];
-                color.g = (unsigned char)((unsigned char *)image.data)[(y*image.width + x)*3 + 1];
-                color.b = (unsigned char)((unsigned char *)image.data)[(y*image.width + x)*3 + 2];
-                color.a = 255;
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R32:
-            {
-                color.r = (unsigned char)(((float *)image.data)[y*image.width + x]*255.0f);
-                color.g = 0;
-                color.b = 0;
-                color.a = 255;
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-            {
-                color.r = (unsigned char)(((float *)image.data)[(y*image.width + x)*3]*255.0f);
-                color.g = (unsigned char)(((float *)image.data)[(y*image.width + x)*3 + 1]*255.0f);
-                color.b = (unsigned char)(((float *)image.data)[(y*image.width + x)*3 + 2]*255.0f);
-                color.a = 255;
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-            {
-                color.r = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
-                color.g = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
-                color.b = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
-                color.a = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R16:
-            {
-                color.r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[y*image.width + x])*255.0f);
-                color.g = 0;
-                color.b = 0;
-                color.a = 255;
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-            {
-                color.r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3])*255.0f);
-                color.g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3 + 1])*255.0f);
-                color.b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3 + 2])*255.0f);
-                color.a = 255;
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-            {
-                color.r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
-                color.g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
-                color.b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
-                color.a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
-
-            } break;
-            default: TRACELOG(LOG_WARNING, "Compressed image format does not support color reading"); break;
-        }
+        if (spanFormat != NULL) spanFormat->read((unsigned char *)image.data + (y*image.width + x)*spanFormat->bytesPerPixel, &color, 1);
+        else TRACELOG(LOG_WARNING, "Compressed image format does not support color reading");
     }
     else TRACELOG(LOG_WARNING, "Requested image pixel (%i, %i) out of bounds", x, y);
 
@@ -3344,138 +3164,9 @@ void ImageDrawPixel(Image *dst, int x, int y, Color color)
     // Security check to avoid program crash
     if ((dst->data == NULL) || (x < 0) || (x >= dst->width) || (y < 0) || (y >= dst->height)) return;
 
-    switch (dst->format)
-    {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
-
-            ((unsigned char *)dst->data)[y*dst->width + x] = gray;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
-
-            ((unsigned char *)dst->data)[(y*dst->width + x)*2] = gray;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*2 + 1] = color.a;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        {
-            // NOTE: Calculate R5G6B5 equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*63.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
-
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
-
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*31.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
-            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+    const PixelSpanFormat *spanFormat = GetPixelSpanFormat(dst->format);
 
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
-
-            unsigned char r = (unsigned char)(round(coln.x*15.0f));
-            unsigned char g = (unsigned char)(round(coln.y*15.0f));
-            unsigned char b = (unsigned char)(round(coln.z*15.0f));
-            unsigned char a = (unsigned char)(round(coln.w*15.0f));
-
-            ((unsigned short *)dst->data)[y*dst->width + x] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-        {
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3] = color.r;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 1] = color.g;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*3 + 2] = color.b;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-        {
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4] = color.r;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 1] = color.g;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 2] = color.b;
-            ((unsigned char *)dst->data)[(y*dst->width + x)*4 + 3] = color.a;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32:
-        {
-            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-
-            ((float *)dst->data)[y*dst->width + x] = coln.x*0.299f + coln.y*0.587f + coln.z*0.114f;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-        {
-            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-
-            ((float *)dst->data)[(y*dst->width + x)*3] = coln.x;
-            ((float *)dst->data)[(y*dst->width + x)*3 + 1] = coln.y;
-            ((float *)dst->data)[(y*dst->width + x)*3 + 2] = coln.z;
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-        {
-            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
-
-            ((float *)dst->data)[(y*dst->width + x)*4] = coln.x;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 1] = coln.y;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 2] = coln.z;
-            ((float *)dst->data)[(y*dst->width + x)*4 + 3] = coln.w;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16:
-        {
-            // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-
-            ((unsigned short*)dst->data)[y*dst->width + x] = FloatToHalf(coln.x*0.299f + coln.y*0.587f + coln.z*0.114f);
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-        {
-            // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3] = FloatToHalf(coln.x);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 1] = FloatToHalf(coln.y);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 2] = FloatToHalf(coln.z);
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-        {
-            // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
-
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4] = FloatToHalf(coln.x);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 1] = FloatToHalf(coln.y);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 2] = FloatToHalf(coln.z);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 3] = FloatToHalf(coln.w);
-
-        } break;
-        default: break;
-    }
+    if (spanFormat != NULL) spanFormat->write((unsigned char *)dst->data + (y*dst->width + x)*spanFormat->bytesPerPixel, &color, 1);
 }
 
 // Draw pixel within an image (Vector version)
@@ -3976,11 +3667,11 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
         //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
         //    [-] GetPixelColor(): Get Vector4 instead of Color, easier for ColorAlphaBlend()
-        //    [ ] Support f32bit channels drawing
-
-        // TODO: Support PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 and PIXELFORMAT_UNCOMPRESSED_R1616B16A16
+        //    [x] Convert pixels by rows with span accessors, avoiding per-pixel format switch
+        //    [x] Support f32bit channels drawing
 
-        Color colSrc, colDst, blend;
+        const PixelSpanFormat *spanSrc = GetPixelSpanFormat(srcPtr->format);
+        const PixelSpanFormat *spanDst = GetPixelSpanFormat(dst->format);
         bool blendRequired = true;
 
         // Fast path: Avoid blend if source has no alpha to blend
@@ -4003,35 +3694,42 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
         unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
 
-        for (int y = 0; y < (int)srcRec.height; y++)
+        // Rows of colors to convert source and destination pixels spans
+        int spanWidth = (int)srcRec.width;
+        Color *rowSrc = NULL;
+        Color *rowDst = NULL;
+
+        if ((spanSrc != NULL) && (spanDst != NULL) && (spanWidth > 0))
         {
-            unsigned char *pSrc = pSrcBase;
-            unsigned char *pDst = pDstBase;
+            rowSrc = (Color *)RL_MALLOC(spanWidth*sizeof(Color));
+            rowDst = (Color *)RL_MALLOC(spanWidth*sizeof(Color));
+        }
 
+        for (int y = 0; y < (int)srcRec.height; y++)
+        {
             // Fast path: Avoid moving pixel by pixel if no blend required and same format
-            if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
-            else
+            if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDstBase, pSrcBase, spanWidth*bytesPerPixelSrc);
+            else if ((rowSrc != NULL) && (rowDst != NULL))
             {
-                for (int x = 0; x < (int)srcRec.width; x++)
-                {
-                    colSrc = GetPixelColor(pSrc, srcPtr->format);
-                    colDst = GetPixelColor(pDst, dst->format);
-
-                    // Fast path: Avoid blend if source has no alpha to blend
-                    if (blendRequired) blend = ColorAlphaBlend(colDst, colSrc, tint);
-                    else blend = colSrc;
+                spanSrc->read(pSrcBase, rowSrc, spanWidth);
 
-                    SetPixelColor(pDst, blend, dst->format);
-
-                    pDst += bytesPerPixelDst;
-                    pSrc += bytesPerPixelSrc;
+                // Fast path: Avoid blend if source has no alpha to blend
+                if (blendRequired)
+                {
+                    spanDst->read(pDstBase, rowDst, spanWidth);
+                    for (int x = 0; x < spanWidth; x++) rowDst[x] = ColorAlphaBlend(rowDst[x], rowSrc[x], tint);
+                    spanDst->write(pDstBase, rowDst, spanWidth);
                 }
+                else spanDst->write(pDstBase, rowSrc, spanWidth);
             }
 
             pSrcBase += strideSrc;
             pDstBase += strideDst;
         }
 
+        RL_FREE(rowSrc);
+        RL_FREE(rowDst);
+
         if (useSrcMod) UnloadImage(srcMod);     // Unload source modified image
 
         if ((dst->mipmaps > 1) && (src.mipmaps > 1))
@@ -4100,6 +3798,23 @@ Texture2D LoadTexture(const char *fileName)
 {
     Texture2D texture = { 0 };
 
+#if defined(SUPPORT_FILEFORMAT_DDS)
+    // Compressed DDS data is uploaded straight from file view, no image is loaded
+    // NOTE: Not available on async loading thread, upload is deferred from loaded image
+#if defined(SUPPORT_ASYNC_LOADING)
+    if (IsFileExtension(fileName, ".dds") && (GetAsyncUploads() == NULL))
+#else
+    if (IsFileExtension(fileName, ".dds"))
+#endif
+    {
+        FileView fileView = LoadFileView(fileName);
+        texture = LoadTextureFromDDSView(fileView);
+        UnloadFileView(fileView);
+
+        if (texture.id > 0) return texture;
+    }
+#endif
+
     Image image = LoadImage(fileName);
 
     if (image.data != NULL)
@@ -4111,12 +3826,79 @@ Texture2D LoadTexture(const char *fileName)
     return texture;
 }
 
+// Load texture from file asynchronously, returns async load handle (0 on failure)
+// NOTE: File is loaded and decoded on loading thread, texture is uploaded on main thread (EndDrawing())
+unsigned int LoadTextureAsync(const char *fileName, AsyncLoadCallback callback, void *userData)
+{
+    unsigned int handle = 0;
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    if (fileName == NULL) return 0;
+
+    TextureAsyncLoad *load = (TextureAsyncLoad *)RL_CALLOC(1, sizeof(TextureAsyncLoad) + strlen(fileName) + 1);
+    load->fileName = (char *)(load + 1);
+    strcpy(load->fileName, fileName);
+
+    handle = QueueAsyncLoad(ASYNC_ASSET_TEXTURE, load, LoadTextureAsyncData, UploadTextureAsyncData, UnloadTextureAsyncData, callback, userData);
+    if (handle == 0) RL_FREE(load);
+#else
+    (void)callback;
+    (void)userData;
+    TRACELOG(LOG_WARNING, "TEXTURE: [%s] Async loading not supported", fileName);
+#endif
+
+    return handle;
+}
+
+// Get texture loaded asynchronously, handle is released
+// NOTE: An empty texture is returned if load is not ready (or failed)
+Texture2D GetAsyncTexture(unsigned int handle)
+{
+    Texture2D texture = { 0 };
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    TextureAsyncLoad *load = (TextureAsyncLoad *)TakeAsyncLoadResult(handle, ASYNC_ASSET_TEXTURE);
+
+    if (load != NULL)
+    {
+        texture = load->texture;
+        RL_FREE(load);
+    }
+#else
+    (void)handle;
+#endif
+
+    return texture;
+}
+
 // Load a texture from image data
 // NOTE: image is not unloaded, it must be done manually
 Texture2D LoadTextureFromImage(Image image)
 {
     Texture2D texture = { 0 };
 
+#if defined(SUPPORT_ASYNC_LOADING)
+    // Texture upload is deferred to main thread when loading an asset on async loading thread,
+    // a copy of image is kept and a deferred texture id is returned, resolved by UploadAsyncTexture()
+    AsyncUploads *uploads = GetAsyncUploads();
+
+    if ((uploads != NULL) && (image.width != 0) && (image.height != 0))
+    {
+        uploads->images = (Image *)RL_REALLOC(uploads->images, (uploads->imageCount + 1)*sizeof(Image));
+        uploads->images[uploads->imageCount] = ImageCopy(image);
+
+        texture.id = ASYNC_DEFERRED_TEXTURE | (unsigned int)uploads->imageCount;
+        texture.width = image.width;
+        texture.height = image.height;
+        texture.mipmaps = image.mipmaps;
+        texture.format = image.format;
+
+        uploads->imageCount++;
+
+        return texture;
+    }
+#endif
+
     if ((image.width != 0) && (image.height != 0))
     {
         texture.id = rlLoadTexture(image.data, image.width, image.height, image.format, image.mipmaps);
@@ -4344,6 +4126,71 @@ void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels)
     rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
 }
 
+// Update GPU texture rectangle and its mipmap levels from image, with a filter (MipmapFilter)
+// NOTE 1: image must match texture size and format, image base level rectangle is expected already updated
+// NOTE 2: Only image mipmap levels regions affected by rectangle are regenerated and uploaded
+// NOTE 3: Texture mipmap levels not available on image are not updated
+void UpdateTextureMipmapsRec(Texture2D texture, Image *image, Rectangle rec, int filter, bool srgb)
+{
+    if ((image->data == NULL) || (image->width != texture.width) || (image->height != texture.height) || (image->format != texture.format))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Image does not match texture size or format, mipmaps not updated", texture.id);
+        return;
+    }
+
+    Rectangle levelRecs[MIPMAP_MAX_LEVELS] = { 0 };
+    int bytesPerPixel = GenImageMipmapsRec(image, rec, filter, srgb, levelRecs);
+
+    if (bytesPerPixel == 0)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Mipmaps filter not supported for pixel format", texture.id);
+        return;
+    }
+
+    int levels = (image->mipmaps < texture.mipmaps)? image->mipmaps : texture.mipmaps;
+    if (levels < 1) levels = 1;
+
+    // Regions not covering full level rows are packed before upload
+    int packedSize = 0;
+    for (int i = 0; i < levels; i++)
+    {
+        int size = (int)levelRecs[i].width*(int)levelRecs[i].height*bytesPerPixel;
+        if (size > packedSize) packedSize = size;
+    }
+
+    unsigned char *packed = (unsigned char *)RL_MALLOC(packedSize);
+    unsigned char *level = (unsigned char *)image->data;
+    int width = image->width;
+    int height = image->height;
+
+    for (int i = 0; i < levels; i++)
+    {
+        int x = (int)levelRecs[i].x;
+        int y = (int)levelRecs[i].y;
+        int w = (int)levelRecs[i].width;
+        int h = (int)levelRecs[i].height;
+
+        if ((w > 0) && (h > 0))
+        {
+            const unsigned char *pixels = level + (y*width + x)*bytesPerPixel;
+
+            if (w < width)
+            {
+                for (int row = 0; row < h; row++) memcpy(packed + row*w*bytesPerPixel, pixels + row*width*bytesPerPixel, w*bytesPerPixel);
+                pixels = packed;
+            }
+
+            rlUpdateTextureMipmap(texture.id, i, x, y, w, h, texture.format, pixels);
+        }
+
+        level += width*height*bytesPerPixel;
+        if (width > 1) width /= 2;
+        if (height > 1) height /= 2;
+    }
+
+    RL_FREE(packed);
+}
+
 //------------------------------------------------------------------------------------
 // Texture configuration functions
 //------------------------------------------------------------------------------------
@@ -4611,6 +4458,15 @@ void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2
     }
 }
 
+// Draw multiple sprites of a texture in one instanced draw call (GPU sprite expansion)
+// NOTE: Every sprite works like DrawTexturePro(), only one compact record by sprite is uploaded,
+// if instancing is not supported sprites are added to the render batch
+// WARNING: SpriteInstance memory layout must match rlSpriteInstance
+void DrawTextureInstanced(Texture2D texture, const SpriteInstance *sprites, int spriteCount)
+{
+    if ((texture.id > 0) && (sprites != NULL)) rlDrawSpriteInstances(texture.id, texture.width, texture.height, (const rlSpriteInstance *)sprites, spriteCount);
+}
+
 // Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
 void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint)
 {
@@ -5154,92 +5010,8 @@ Color GetPixelColor(void *srcPtr, int format)
 {
     Color color = { 0 };
 
-    switch (format)
-    {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], 255 }; break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1] }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 5) & 0b0000000000111111)*255/63);
-            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
-            color.a = 255;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 6) & 0b0000000000011111)*255/31);
-            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
-            color.a = (((unsigned short *)srcPtr)[0] & 0b0000000000000001)? 255 : 0;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-        {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 12)*255/15);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 8) & 0b0000000000001111)*255/15);
-            color.b = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 4) & 0b0000000000001111)*255/15);
-            color.a = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000001111)*255/15);
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], ((unsigned char *)srcPtr)[3] }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], 255 }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.a = 255;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
-            color.a = 255;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
-            color.a = (unsigned char)(((float *)srcPtr)[3]*255.0f);
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.a = 255;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
-            color.a = 255;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
-            color.a = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[3])*255.0f);
-
-        } break;
-        default: break;
-    }
+    const PixelSpanFormat *spanFormat = GetPixelSpanFormat(format);
+    if (spanFormat != NULL) spanFormat->read(srcPtr, &color, 1);
 
     return color;
 }
@@ -5247,82 +5019,8 @@ Color GetPixelColor(void *srcPtr, int format)
 // Set pixel color formatted into destination pointer
 void SetPixelColor(void *dstPtr, Color color, int format)
 {
-    switch (format)
-    {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
-
-            ((unsigned char *)dstPtr)[0] = gray;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
-
-            ((unsigned char *)dstPtr)[0] = gray;
-            ((unsigned char *)dstPtr)[1] = color.a;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        {
-            // NOTE: Calculate R5G6B5 equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*63.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
-
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
-
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*31.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
-            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
-
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
-
-            unsigned char r = (unsigned char)(round(coln.x*15.0f));
-            unsigned char g = (unsigned char)(round(coln.y*15.0f));
-            unsigned char b = (unsigned char)(round(coln.z*15.0f));
-            unsigned char a = (unsigned char)(round(coln.w*15.0f));
-
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-        {
-            ((unsigned char *)dstPtr)[0] = color.r;
-            ((unsigned char *)dstPtr)[1] = color.g;
-            ((unsigned char *)dstPtr)[2] = color.b;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-        {
-            ((unsigned char *)dstPtr)[0] = color.r;
-            ((unsigned char *)dstPtr)[1] = color.g;
-            ((unsigned char *)dstPtr)[2] = color.b;
-            ((unsigned char *)dstPtr)[3] = color.a;
-
-        } break;
-        default: break;
-    }
+    const PixelSpanFormat *spanFormat = GetPixelSpanFormat(format);
+    if (spanFormat != NULL) spanFormat->write(dstPtr, &color, 1);
 }
 
 // Get pixel data size in bytes for certain format
@@ -5545,4 +5243,1236 @@ static Vector4 *LoadImageDataNormalized(Image image)
     return pixels;
 }
 
+// Convert image data to desired format with direct per-channel mapping
+// NOTE: Supported for formats up to 8 bit per channel, source channels are unpacked row by row
+// and mapped through lookup tables built from the same normalized values used by
+// LoadImageDataNormalized(), so results match the generic conversion exactly
+static bool ImageFormatDirect(Image *image, int newFormat)
+{
+    int srcFormat = image->format;
+
+    if (((srcFormat != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) &&
+         (srcFormat != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) &&
+         (srcFormat != PIXELFORMAT_UNCOMPRESSED_R5G6B5) &&
+         (srcFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8) &&
+         (srcFormat != PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) &&
+         (srcFormat != PIXELFORMAT_UNCOMPRESSED_R4G4B4A4) &&
+         (srcFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)) ||
+        ((newFormat != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) &&
+         (newFormat != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) &&
+         (newFormat != PIXELFORMAT_UNCOMPRESSED_R5G6B5) &&
+         (newFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8) &&
+         (newFormat != PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) &&
+         (newFormat != PIXELFORMAT_UNCOMPRESSED_R4G4B4A4) &&
+         (newFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))) return false;
+
+    int width = image->width;
+    int height = image->height;
+
+    void *data = RL_MALLOC(GetPixelDataSize(width, height, newFormat));
+    unsigned char *channels = (unsigned char *)RL_MALLOC(width*4*sizeof(unsigned char));   // Row of raw RGBA channel values
+
+    if ((data == NULL) || (channels == NULL))
+    {
+        RL_FREE(data);
+        RL_FREE(channels);
+        return false;
+    }
+
+    // Source raw channel values normalization, same values as LoadImageDataNormalized()
+    // NOTE: Channels not available in source format (alpha) use raw value 0, normalized to 1.0f
+    float norm[4][256] = { 0 };
+    int levels[4] = { 256, 256, 256, 1 };
+
+    switch (srcFormat)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: levels[3] = 256; break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5: levels[0] = 32; levels[1] = 64; levels[2] = 32; break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: levels[0] = 32; levels[1] = 32; levels[2] = 32; levels[3] = 2; break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: levels[0] = 16; levels[1] = 16; levels[2] = 16; levels[3] = 16; break;
+        default: break;
+    }
+
+    for (int c = 0; c < 4; c++)
+    {
+        for (int i = 0; i < levels[c]; i++)
+        {
+            switch (levels[c])
+            {
+                case 256: norm[c][i] = (float)i/255.0f; break;
+                case 64: norm[c][i] = (float)i*(1.0f/63); break;
+                case 32: norm[c][i] = (float)i*(1.0f/31); break;
+                case 16: norm[c][i] = (float)i*(1.0f/15); break;
+                case 2: norm[c][i] = (i == 0)? 0.0f : 1.0f; break;
+                default: norm[c][i] = 1.0f; break;
+            }
+        }
+    }
+
+    // Destination channel values for every source raw channel value, same operations as ImageFormat()
+    // NOTE: 16 bit per pixel formats store channel values already shifted into place
+    unsigned short lut[4][256] = { 0 };
+
+    for (int c = 0; c < 4; c++)
+    {
+        for (int i = 0; i < levels[c]; i++)
+        {
+            float value = norm[c][i];
+
+            switch (newFormat)
+            {
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                {
+                    if (c == 0) lut[c][i] = (unsigned short)((unsigned char)(round(value*31.0f))) << 11;
+                    else if (c == 1) lut[c][i] = (unsigned short)((unsigned char)(round(value*63.0f))) << 5;
+                    else if (c == 2) lut[c][i] = (unsigned short)((unsigned char)(round(value*31.0f)));
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                {
+                    if (c == 3) lut[c][i] = (value > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+                    else lut[c][i] = (unsigned short)((unsigned char)(round(value*31.0f))) << (11 - c*5);
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: lut[c][i] = (unsigned short)((unsigned char)(round(value*15.0f))) << (12 - c*4); break;
+                default: lut[c][i] = (unsigned char)(value*255.0f); break;
+            }
+        }
+    }
+
+    for (int y = 0; y < height; y++)
+    {
+        // Unpack source row into raw channel values
+        if (srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) memcpy(channels, (unsigned char *)image->data + y*width*4, width*4);
+        else if ((srcFormat == PIXELFORMAT_UNCOMPRESSED_R5G6B5) ||
+                 (srcFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) ||
+                 (srcFormat == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4))
+        {
+            const unsigned short *src = (const unsigned short *)image->data + y*width;
+
+            if (srcFormat == PIXELFORMAT_UNCOMPRESSED_R5G6B5)
+            {
+                for (int x = 0; x < width; x++)
+                {
+                    channels[x*4] = (unsigned char)(src[x] >> 11);
+                    channels[x*4 + 1] = (unsigned char)((src[x] >> 5) & 0x3f);
+                    channels[x*4 + 2] = (unsigned char)(src[x] & 0x1f);
+                    channels[x*4 + 3] = 0;
+                }
+            }
+            else if (srcFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+            {
+                for (int x = 0; x < width; x++)
+                {
+                    channels[x*4] = (unsigned char)(src[x] >> 11);
+                    channels[x*4 + 1] = (unsigned char)((src[x] >> 6) & 0x1f);
+                    channels[x*4 + 2] = (unsigned char)((src[x] >> 1) & 0x1f);
+                    channels[x*4 + 3] = (unsigned char)(src[x] & 0x1);
+                }
+            }
+            else
+            {
+                for (int x = 0; x < width; x++)
+                {
+                    channels[x*4] = (unsigned char)(src[x] >> 12);
+                    channels[x*4 + 1] = (unsigned char)((src[x] >> 8) & 0xf);
+                    channels[x*4 + 2] = (unsigned char)((src[x] >> 4) & 0xf);
+                    channels[x*4 + 3] = (unsigned char)(src[x] & 0xf);
+                }
+            }
+        }
+        else
+        {
+            // 8 bit per channel formats: grayscale (1), gray-alpha (2) and RGB (3) bytes per pixel
+            int bytesPerPixel = (srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8)? 3 : ((srcFormat == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)? 2 : 1);
+            const unsigned char *src = (const unsigned char *)image->data + y*width*bytesPerPixel;
+
+            if (bytesPerPixel == 3)
+            {
+                for (int x = 0; x < width; x++)
+                {
+                    channels[x*4] = src[x*3];
+                    channels[x*4 + 1] = src[x*3 + 1];
+                    channels[x*4 + 2] = src[x*3 + 2];
+                    channels[x*4 + 3] = 0;
+                }
+            }
+            else
+            {
+                for (int x = 0; x < width; x++)
+                {
+                    unsigned char gray = src[x*bytesPerPixel];
+
+                    channels[x*4] = gray;
+                    channels[x*4 + 1] = gray;
+                    channels[x*4 + 2] = gray;
+                    channels[x*4 + 3] = (bytesPerPixel == 2)? src[x*2 + 1] : 0;
+                }
+            }
+        }
+
+        // Pack raw channel values into destination row
+        switch (newFormat)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            {
+                int bytesPerPixel = (newFormat == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)? 2 : 1;
+                unsigned char *dst = (unsigned char *)data + y*width*bytesPerPixel;
+
+                for (int x = 0; x < width; x++)
+                {
+                    const unsigned char *ch = channels + x*4;
+
+                    dst[x*bytesPerPixel] = (unsigned char)((norm[0][ch[0]]*0.299f + norm[1][ch[1]]*0.587f + norm[2][ch[2]]*0.114f)*255.0f);
+                    if (bytesPerPixel == 2) dst[x*2 + 1] = (unsigned char)lut[3][ch[3]];
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            {
+                unsigned char *dst = (unsigned char *)data + y*width*3;
+
+                for (int x = 0; x < width; x++)
+                {
+                    dst[x*3] = (unsigned char)lut[0][channels[x*4]];
+                    dst[x*3 + 1] = (unsigned char)lut[1][channels[x*4 + 1]];
+                    dst[x*3 + 2] = (unsigned char)lut[2][channels[x*4 + 2]];
+                }
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+            {
+                unsigned char *dst = (unsigned char *)data + y*width*4;
+
+                for (int x = 0; x < width*4; x += 4)
+                {
+                    dst[x] = (unsigned char)lut[0][channels[x]];
+                    dst[x + 1] = (unsigned char)lut[1][channels[x + 1]];
+                    dst[x + 2] = (unsigned char)lut[2][channels[x + 2]];
+                    dst[x + 3] = (unsigned char)lut[3][channels[x + 3]];
+                }
+            } break;
+            default:    // 16 bit per pixel formats: R5G6B5, R5G5B5A1, R4G4B4A4
+            {
+                unsigned short *dst = (unsigned short *)data + y*width;
+
+                for (int x = 0; x < width; x++)
+                {
+                    dst[x] = lut[0][channels[x*4]] | lut[1][channels[x*4 + 1]] | lut[2][channels[x*4 + 2]] | lut[3][channels[x*4 + 3]];
+                }
+            } break;
+        }
+    }
+
+    RL_FREE(channels);
+
+    RL_FREE(image->data);
+    image->data = data;
+    image->format = newFormat;
+
+    return true;
+}
+
+// Run image processing jobs, split across job system workers if enabled (SUPPORT_IMAGE_JOBS)
+// NOTE: Jobs must write disjoint data, results are the same as running them sequentially
+static void RunImageJobs(JobFunction func, void *userData, int count)
+{
+#if defined(SUPPORT_IMAGE_JOBS)
+    RunJobs(func, userData, count);
+#else
+    for (int i = 0; i < count; i++) func(userData, i);
+#endif
+}
+
+#if defined(SUPPORT_IMAGE_JOBS)
+// Resize a split (band of output rows) of pixel data
+static void ResizeImageSplitJob(void *userData, int index)
+{
+    stbir_resize_extended_split((STBIR_RESIZE *)userData, index, 1);
+}
+#endif
+
+// Resize 8 bit per channel pixel data (1 to 4 channels), using stb default scaling filters
+// NOTE: If SUPPORT_IMAGE_JOBS is enabled, output rows are split across job system workers,
+// stb resize splits produce the same output than a single threaded resize
+static void ResizeImageData(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int channels)
+{
+#if defined(SUPPORT_IMAGE_JOBS)
+    STBIR_RESIZE resize = { 0 };
+    stbir_resize_init(&resize, input, width, height, width*channels, output, newWidth, newHeight, newWidth*channels, (stbir_pixel_layout)channels, STBIR_TYPE_UINT8);
+
+    int splits = (newHeight + IMAGE_JOB_ROWS - 1)/IMAGE_JOB_ROWS;
+    if (splits > IMAGE_JOB_RESIZE_SPLITS) splits = IMAGE_JOB_RESIZE_SPLITS;
+
+    // NOTE: Returned splits count could be lower than requested
+    splits = stbir_build_samplers_with_splits(&resize, splits);
+
+    if (splits > 0)
+    {
+        RunJobs(ResizeImageSplitJob, &resize, splits);
+        stbir_free_samplers(&resize);
+    }
+    else TRACELOG(LOG_WARNING, "IMAGE: Failed to resize image data");
+#else
+    stbir_resize_uint8_linear(input, width, height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)channels);
+#endif
+}
+
+// Horizontal box blur of a band of rows
+static void BlurImageRowsJob(void *userData, int index)
+{
+    ImageBlurPass *pass = (ImageBlurPass *)userData;
+    const Vector4 *src = pass->src;
+    Vector4 *dst = pass->dst;
+    int width = pass->width;
+    int blurSize = pass->blurSize;
+
+    int rowEnd = (index + 1)*IMAGE_JOB_ROWS;
+    if (rowEnd > pass->height) rowEnd = pass->height;
+
+    for (int row = index*IMAGE_JOB_ROWS; row < rowEnd; row++)
+    {
+        float avgR = 0.0f;
+        float avgG = 0.0f;
+        float avgB = 0.0f;
+        float avgAlpha = 0.0f;
+        int convolutionSize = blurSize;
+
+        for (int i = 0; i < blurSize; i++)
+        {
+            avgR += src[row*width + i].x;
+            avgG += src[row*width + i].y;
+            avgB += src[row*width + i].z;
+            avgAlpha += src[row*width + i].w;
+        }
+
+        for (int x = 0; x < width; x++)
+        {
+            if (x-blurSize-1 >= 0)
+            {
+                avgR -= src[row*width + x-blurSize-1].x;
+                avgG -= src[row*width + x-blurSize-1].y;
+                avgB -= src[row*width + x-blurSize-1].z;
+                avgAlpha -= src[row*width + x-blurSize-1].w;
+                convolutionSize--;
+            }
+
+            if (x+blurSize < width)
+            {
+                avgR += src[row*width + x+blurSize].x;
+                avgG += src[row*width + x+blurSize].y;
+                avgB += src[row*width + x+blurSize].z;
+                avgAlpha += src[row*width + x+blurSize].w;
+                convolutionSize++;
+            }
+
+            dst[row*width + x].x = avgR/convolutionSize;
+            dst[row*width + x].y = avgG/convolutionSize;
+            dst[row*width + x].z = avgB/convolutionSize;
+            dst[row*width + x].w = avgAlpha/convolutionSize;
+        }
+    }
+}
+
+// Vertical box blur of a band of columns
+// NOTE: Result channels are truncated to [0..255] integer values
+static void BlurImageColumnsJob(void *userData, int index)
+{
+    ImageBlurPass *pass = (ImageBlurPass *)userData;
+    const Vector4 *src = pass->src;
+    Vector4 *dst = pass->dst;
+    int width = pass->width;
+    int height = pass->height;
+    int blurSize = pass->blurSize;
+
+    int colEnd = (index + 1)*IMAGE_JOB_ROWS;
+    if (colEnd > width) colEnd = width;
+
+    for (int col = index*IMAGE_JOB_ROWS; col < colEnd; col++)
+    {
+        float avgR = 0.0f;
+        float avgG = 0.0f;
+        float avgB = 0.0f;
+        float avgAlpha = 0.0f;
+        int convolutionSize = blurSize;
+
+        for (int i = 0; i < blurSize; i++)
+        {
+            avgR += src[i*width + col].x;
+            avgG += src[i*width + col].y;
+            avgB += src[i*width + col].z;
+            avgAlpha += src[i*width + col].w;
+        }
+
+        for (int y = 0; y < height; y++)
+        {
+            if (y-blurSize-1 >= 0)
+            {
+                avgR -= src[(y-blurSize-1)*width + col].x;
+                avgG -= src[(y-blurSize-1)*width + col].y;
+                avgB -= src[(y-blurSize-1)*width + col].z;
+                avgAlpha -= src[(y-blurSize-1)*width + col].w;
+                convolutionSize--;
+            }
+            if (y+blurSize < height)
+            {
+                avgR += src[(y+blurSize)*width + col].x;
+                avgG += src[(y+blurSize)*width + col].y;
+                avgB += src[(y+blurSize)*width + col].z;
+                avgAlpha += src[(y+blurSize)*width + col].w;
+                convolutionSize++;
+            }
+
+            dst[y*width + col].x = (unsigned char) (avgR/convolutionSize);
+            dst[y*width + col].y = (unsigned char) (avgG/convolutionSize);
+            dst[y*width + col].z = (unsigned char) (avgB/convolutionSize);
+            dst[y*width + col].w = (unsigned char) (avgAlpha/convolutionSize);
+        }
+    }
+}
+
+// Kernel convolution of a band of rows
+// NOTE: Kernel samples out of image data are zero, samples out of row bounds wrap to adjacent rows
+static void ConvolveImageRowsJob(void *userData, int index)
+{
+    ImageConvolution *convolution = (ImageConvolution *)userData;
+    const Color *pixels = convolution->pixels;
+    const float *kernel = convolution->kernel;
+    int kernelWidth = convolution->kernelWidth;
+    int kernelSize = kernelWidth*kernelWidth;
+    int width = convolution->width;
+    int height = convolution->height;
+
+    Vector4 *temp = RL_CALLOC(kernelSize, sizeof(Vector4));
+
+    float rRes = 0.0f;
+    float gRes = 0.0f;
+    float bRes = 0.0f;
+    float aRes = 0.0f;
+
+    int startRange = -kernelWidth/2;
+    int endRange = (kernelWidth%2 == 0)? kernelWidth/2 : kernelWidth/2 + 1;
+
+    int rowEnd = (index + 1)*IMAGE_JOB_ROWS;
+    if (rowEnd > height) rowEnd = height;
+
+    for (int x = index*IMAGE_JOB_ROWS; x < rowEnd; x++)
+    {
+        for (int y = 0; y < width; y++)
+        {
+            for (int xk = startRange; xk < endRange; xk++)
+            {
+                for (int yk = startRange; yk < endRange; yk++)
+                {
+                    int xkabs = xk + kernelWidth/2;
+                    int ykabs = yk + kernelWidth/2;
+                    unsigned int imgindex = width*(x + xk) + (y + yk);
+
+                    if (imgindex >= (unsigned int)(width*height))
+                    {
+                        temp[kernelWidth*xkabs + ykabs].x = 0.0f;
+                        temp[kernelWidth*xkabs + ykabs].y = 0.0f;
+                        temp[kernelWidth*xkabs + ykabs].z = 0.0f;
+                        temp[kernelWidth*xkabs + ykabs].w = 0.0f;
+                    }
+                    else
+                    {
+                        temp[kernelWidth*xkabs + ykabs].x = ((float)pixels[imgindex].r)/255.0f*kernel[kernelWidth*xkabs + ykabs];
+                        temp[kernelWidth*xkabs + ykabs].y = ((float)pixels[imgindex].g)/255.0f*kernel[kernelWidth*xkabs + ykabs];
+                        temp[kernelWidth*xkabs + ykabs].z = ((float)pixels[imgindex].b)/255.0f*kernel[kernelWidth*xkabs + ykabs];
+                        temp[kernelWidth*xkabs + ykabs].w = ((float)pixels[imgindex].a)/255.0f*kernel[kernelWidth*xkabs + ykabs];
+                    }
+                }
+            }
+
+            for (int i = 0; i < kernelSize; i++)
+            {
+                rRes += temp[i].x;
+                gRes += temp[i].y;
+                bRes += temp[i].z;
+                aRes += temp[i].w;
+            }
+
+            if (rRes < 0.0f) rRes = 0.0f;
+            if (gRes < 0.0f) gRes = 0.0f;
+            if (bRes < 0.0f) bRes = 0.0f;
+
+            if (rRes > 1.0f) rRes = 1.0f;
+            if (gRes > 1.0f) gRes = 1.0f;
+            if (bRes > 1.0f) bRes = 1.0f;
+
+            convolution->output[width*x + y].x = rRes;
+            convolution->output[width*x + y].y = gRes;
+            convolution->output[width*x + y].z = bRes;
+            convolution->output[width*x + y].w = aRes;
+
+            rRes = 0.0f;
+            gRes = 0.0f;
+            bRes = 0.0f;
+            aRes = 0.0f;
+        }
+    }
+
+    RL_FREE(temp);
+}
+
+// Modified Bessel function of the first kind, order 0 (power series)
+static float BesselI0(float x)
+{
+    float result = 1.0f;
+    float term = 1.0f;
+
+    for (int k = 1; k < 20; k++)
+    {
+        term *= (x/(2.0f*k))*(x/(2.0f*k));
+        result += term;
+    }
+
+    return result;
+}
+
+// Init mipmap filter tables: channel decoding tables (alpha is always linear) and filters taps
+// NOTE: Kaiser filter is a windowed sinc (cutoff at half source frequency) over 6 source pixels,
+// box filter averages 2 source pixels, both are applied on both axis
+static void InitMipmapFilterTables(void)
+{
+    MipmapFilterTables *tables = &mipmapTables;
+
+    for (int i = 0; i < 256; i++)
+    {
+        float value = (float)i/255.0f;
+        tables->decode[0][i] = value;
+        tables->decode[1][i] = (value <= 0.04045f)? value/12.92f : powf((value + 0.055f)/1.055f, 2.4f);
+
+        if (i < 255)
+        {
+            value = ((float)i + 0.5f)/255.0f;
+            tables->srgbThresholds[i] = (value <= 0.04045f)? value/12.92f : powf((value + 0.055f)/1.055f, 2.4f);
+        }
+    }
+
+    MipmapFilterTaps *box = &tables->taps[0];
+    box->first = 0;
+    box->count = 2;
+    box->weights[0] = 0.5f;
+    box->weights[1] = 0.5f;
+
+    const float alpha = 4.0f;       // Kaiser window shape, higher values reduce ringing
+    const float radius = 3.0f;      // Kaiser window radius (in source pixels)
+
+    MipmapFilterTaps *kaiser = &tables->taps[1];
+    kaiser->first = -2;
+    kaiser->count = 6;
+
+    float sum = 0.0f;
+    for (int i = 0; i < kaiser->count; i++)
+    {
+        // Source pixel center distance to destination pixel center (in source pixels)
+        float t = (float)(kaiser->first + i) - 0.5f;
+        float x = PI*t*0.5f;
+        float r = t/radius;
+
+        kaiser->weights[i] = (sinf(x)/x)*BesselI0(alpha*sqrtf(1.0f - r*r))/BesselI0(alpha);
+        sum += kaiser->weights[i];
+    }
+
+    for (int i = 0; i < kaiser->count; i++) kaiser->weights[i] /= sum;
+}
+
+// Generate a band of rows of a mipmap level region
+static void GenMipmapLevelJob(void *userData, int index)
+{
+    const MipmapLevelPass *pass = (const MipmapLevelPass *)userData;
+
+    int rowStart = pass->y0 + index*IMAGE_JOB_ROWS;
+    int rowEnd = rowStart + IMAGE_JOB_ROWS;
+    if (rowEnd > pass->y1) rowEnd = pass->y1;
+
+    if (pass->integerBox) GenMipmapRowsBox(pass, rowStart, rowEnd);
+    else GenMipmapRowsFiltered(pass, rowStart, rowEnd);
+}
+
+// Generate mipmap level rows with an exact integer 2x2 average, SIMD accelerated for RGBA8
+// NOTE: Source level must be at least 2x2, so every destination pixel has a complete 2x2 source block
+static void GenMipmapRowsBox(const MipmapLevelPass *pass, int rowStart, int rowEnd)
+{
+    int channels = pass->channels;
+    int srcPitch = pass->srcWidth*channels;
+    int count = pass->x1 - pass->x0;
+
+    for (int y = rowStart; y < rowEnd; y++)
+    {
+        const unsigned char *row0 = pass->src + 2*y*srcPitch + 2*pass->x0*channels;
+        const unsigned char *row1 = row0 + srcPitch;
+        unsigned char *out = pass->dst + (y*pass->dstWidth + pass->x0)*channels;
+        int x = 0;
+
+        if (channels == 4)
+        {
+#if defined(MIPMAPS_SSE2)
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i round = _mm_set1_epi16(2);
+
+            // Two destination pixels per iteration, 16 bit channel sums
+            for (; (x + 2) <= count; x += 2)
+            {
+                __m128i a = _mm_loadu_si128((const __m128i *)(row0 + x*8));
+                __m128i b = _mm_loadu_si128((const __m128i *)(row1 + x*8));
+                __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));    // Source pixels 0, 1
+                __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));    // Source pixels 2, 3
+                __m128i sum = _mm_unpacklo_epi64(_mm_add_epi16(lo, _mm_srli_si128(lo, 8)), _mm_add_epi16(hi, _mm_srli_si128(hi, 8)));
+
+                sum = _mm_srli_epi16(_mm_add_epi16(sum, round), 2);
+                _mm_storel_epi64((__m128i *)(out + x*4), _mm_packus_epi16(sum, sum));
+            }
+#elif defined(MIPMAPS_NEON)
+            // Two destination pixels per iteration, 16 bit channel sums
+            for (; (x + 2) <= count; x += 2)
+            {
+                uint8x16_t a = vld1q_u8(row0 + x*8);
+                uint8x16_t b = vld1q_u8(row1 + x*8);
+                uint16x8_t lo = vaddl_u8(vget_low_u8(a), vget_low_u8(b));      // Source pixels 0, 1
+                uint16x8_t hi = vaddl_u8(vget_high_u8(a), vget_high_u8(b));    // Source pixels 2, 3
+                uint16x8_t sum = vcombine_u16(vadd_u16(vget_low_u16(lo), vget_high_u16(lo)), vadd_u16(vget_low_u16(hi), vget_high_u16(hi)));
+
+                vst1_u8(out + x*4, vrshrn_n_u16(sum, 2));
+            }
+#endif
+        }
+
+        for (; x < count; x++)
+        {
+            for (int c = 0; c < channels; c++)
+            {
+                int i = 2*x*channels + c;
+                out[x*channels + c] = (unsigned char)((row0[i] + row0[i + channels] + row1[i] + row1[i + channels] + 2) >> 2);
+            }
+        }
+    }
+}
+
+// Generate mipmap level rows with a separable filter, filtering in float
+// NOTE: Source pixels out of level bounds are clamped to edge, color channels are filtered in linear space if sRGB
+static void GenMipmapRowsFiltered(const MipmapLevelPass *pass, int rowStart, int rowEnd)
+{
+    const MipmapFilterTaps *taps = pass->taps;
+    const MipmapFilterTables *tables = pass->tables;
+    int channels = pass->channels;
+    int cols = (pass->x1 - pass->x0)*channels;
+    int srcRowStart = 2*rowStart + taps->first;
+    int srcRowCount = 2*(rowEnd - 1 - rowStart) + taps->count;
+
+    float *filtered = (float *)RL_MALLOC(srcRowCount*cols*sizeof(float));
+
+    // Horizontal pass, every source row sampled by the band of rows
+    for (int r = 0; r < srcRowCount; r++)
+    {
+        int sy = srcRowStart + r;
+        if (sy < 0) sy = 0;
+        else if (sy > (pass->srcHeight - 1)) sy = pass->srcHeight - 1;
+
+        const unsigned char *srcRow = pass->src + sy*pass->srcWidth*channels;
+        float *out = filtered + r*cols;
+
+        for (int x = pass->x0; x < pass->x1; x++)
+        {
+            for (int c = 0; c < channels; c++)
+            {
+                const float *decode = tables->decode[(c < pass->srgbChannels)? 1 : 0];
+                float sum = 0.0f;
+
+                for (int t = 0; t < taps->count; t++)
+                {
+                    int sx = 2*x + taps->first + t;
+                    if (sx < 0) sx = 0;
+                    else if (sx > (pass->srcWidth - 1)) sx = pass->srcWidth - 1;
+
+                    sum += taps->weights[t]*decode[srcRow[sx*channels + c]];
+                }
+
+                *out++ = sum;
+            }
+        }
+    }
+
+    // Vertical pass, encode filtered values
+    for (int y = rowStart; y < rowEnd; y++)
+    {
+        const float *in = filtered + 2*(y - rowStart)*cols;
+        unsigned char *out = pass->dst + (y*pass->dstWidth + pass->x0)*channels;
+
+        for (int i = 0; i < cols; i++)
+        {
+            float sum = 0.0f;
+            for (int t = 0; t < taps->count; t++) sum += taps->weights[t]*in[t*cols + i];
+
+            if ((i%channels) < pass->srgbChannels)
+            {
+                // Search nearest sRGB value, rounding boundaries are sorted
+                int low = 0;
+                int high = 255;
+
+                while (low < high)
+                {
+                    int mid = (low + high)/2;
+                    if (sum > tables->srgbThresholds[mid]) low = mid + 1;
+                    else high = mid;
+                }
+
+                out[i] = (unsigned char)low;
+            }
+            else
+            {
+                sum = sum*255.0f + 0.5f;
+                out[i] = (sum <= 0.0f)? 0 : ((sum >= 255.0f)? 255 : (unsigned char)sum);
+            }
+        }
+    }
+
+    RL_FREE(filtered);
+}
+
+// Generate image mipmap levels regions affected by a base level rectangle, every level from previous one
+// NOTE: Returns bytes per pixel (0 if format not supported), levelRecs (optional) gets the region updated on every level
+static int GenImageMipmapsRec(Image *image, Rectangle rec, int filter, bool srgb, Rectangle *levelRecs)
+{
+    int channels = 0;
+
+    switch (image->format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: channels = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: channels = 2; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: channels = 3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: channels = 4; break;
+        default: return 0;
+    }
+
+    // Filter tables are built once, on first call, jobs only read them
+#if defined(SUPPORT_JOB_SYSTEM) || defined(SUPPORT_ASYNC_LOADING)
+    pthread_once(&mipmapTablesOnce, InitMipmapFilterTables);
+#else
+    if (!mipmapTablesReady)
+    {
+        InitMipmapFilterTables();
+        mipmapTablesReady = true;
+    }
+#endif
+
+    const MipmapFilterTaps *taps = &mipmapTables.taps[(filter == MIPMAP_FILTER_KAISER)? 1 : 0];
+    int tapLast = taps->first + taps->count - 1;
+    int srgbChannels = srgb? ((channels >= 3)? 3 : 1) : 0;    // Alpha is always linear
+
+    // Base level region, clamped to image bounds
+    int x0 = (rec.x > 0)? (int)rec.x : 0;
+    int y0 = (rec.y > 0)? (int)rec.y : 0;
+    int x1 = (int)(rec.x + rec.width);
+    int y1 = (int)(rec.y + rec.height);
+    if (x1 > image->width) x1 = image->width;
+    if (y1 > image->height) y1 = image->height;
+    if (x1 < x0) x1 = x0;
+    if (y1 < y0) y1 = y0;
+
+    if (levelRecs != NULL) levelRecs[0] = (Rectangle){ (float)x0, (float)y0, (float)(x1 - x0), (float)(y1 - y0) };
+
+    unsigned char *src = (unsigned char *)image->data;
+    int srcWidth = image->width;
+    int srcHeight = image->height;
+
+    for (int i = 1; i < image->mipmaps; i++)
+    {
+        int dstWidth = (srcWidth > 1)? srcWidth/2 : 1;
+        int dstHeight = (srcHeight > 1)? srcHeight/2 : 1;
+        unsigned char *dst = src + srcWidth*srcHeight*channels;
+
+        if ((x1 > x0) && (y1 > y0))
+        {
+            // Destination pixels sampling any source pixel of the region
+            x0 = (x0 > tapLast)? (x0 - tapLast + 1)/2 : 0;
+            y0 = (y0 > tapLast)? (y0 - tapLast + 1)/2 : 0;
+            x1 = (x1 - 1 - taps->first)/2 + 1;
+            y1 = (y1 - 1 - taps->first)/2 + 1;
+            if (x1 > dstWidth) x1 = dstWidth;
+            if (y1 > dstHeight) y1 = dstHeight;
+
+            // NOTE: Last row/column of odd sized levels could be sampled by no destination pixel
+            if (x1 < x0) x1 = x0;
+            if (y1 < y0) y1 = y0;
+
+            MipmapLevelPass pass = { 0 };
+            pass.src = src;
+            pass.dst = dst;
+            pass.srcWidth = srcWidth;
+            pass.srcHeight = srcHeight;
+            pass.dstWidth = dstWidth;
+            pass.channels = channels;
+            pass.x0 = x0;
+            pass.y0 = y0;
+            pass.x1 = x1;
+            pass.y1 = y1;
+            pass.integerBox = (filter != MIPMAP_FILTER_KAISER) && !srgb && (srcWidth >= 2) && (srcHeight >= 2);
+            pass.srgbChannels = srgbChannels;
+            pass.taps = taps;
+            pass.tables = &mipmapTables;
+
+            RunImageJobs(GenMipmapLevelJob, &pass, (y1 - y0 + IMAGE_JOB_ROWS - 1)/IMAGE_JOB_ROWS);
+        }
+
+        if (levelRecs != NULL) levelRecs[i] = (Rectangle){ (float)x0, (float)y0, (float)(x1 - x0), (float)(y1 - y0) };
+
+        src = dst;
+        srcWidth = dstWidth;
+        srcHeight = dstHeight;
+    }
+
+    return channels;
+}
+
+// Get pixel span accessors for an uncompressed pixel format, NULL if not supported
+// NOTE: Accessors are picked once per operation and convert a whole span (row) per call
+static const PixelSpanFormat *GetPixelSpanFormat(int format)
+{
+    // Span accessors indexed by PixelFormat, uncompressed formats start at 1
+    static const PixelSpanFormat spanFormats[] = {
+        { 1, ReadPixelSpanGrayscale, WritePixelSpanGrayscale },
+        { 2, ReadPixelSpanGrayAlpha, WritePixelSpanGrayAlpha },
+        { 2, ReadPixelSpanR5G6B5, WritePixelSpanR5G6B5 },
+        { 3, ReadPixelSpanR8G8B8, WritePixelSpanR8G8B8 },
+        { 2, ReadPixelSpanR5G5B5A1, WritePixelSpanR5G5B5A1 },
+        { 2, ReadPixelSpanR4G4B4A4, WritePixelSpanR4G4B4A4 },
+        { 4, ReadPixelSpanR8G8B8A8, WritePixelSpanR8G8B8A8 },
+        { 4, ReadPixelSpanR32, WritePixelSpanR32 },
+        { 12, ReadPixelSpanR32G32B32, WritePixelSpanR32G32B32 },
+        { 16, ReadPixelSpanR32G32B32A32, WritePixelSpanR32G32B32A32 },
+        { 2, ReadPixelSpanR16, WritePixelSpanR16 },
+        { 6, ReadPixelSpanR16G16B16, WritePixelSpanR16G16B16 },
+        { 8, ReadPixelSpanR16G16B16A16, WritePixelSpanR16G16B16A16 }
+    };
+
+    if ((format < PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (format > PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) return NULL;
+
+    return &spanFormats[format - PIXELFORMAT_UNCOMPRESSED_GRAYSCALE];
+}
+
+// Read pixels span: PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+static void ReadPixelSpanGrayscale(const void *src, Color *colors, int count)
+{
+    const unsigned char *pixels = (const unsigned char *)src;
+
+    for (int i = 0; i < count; i++) colors[i] = (Color){ pixels[i], pixels[i], pixels[i], 255 };
+}
+
+// Read pixels span: PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
+static void ReadPixelSpanGrayAlpha(const void *src, Color *colors, int count)
+{
+    const unsigned char *pixels = (const unsigned char *)src;
+
+    for (int i = 0; i < count; i++) colors[i] = (Color){ pixels[i*2], pixels[i*2], pixels[i*2], pixels[i*2 + 1] };
+}
+
+// Read pixels span: PIXELFORMAT_UNCOMPRESSED_R5G6B5
+static void ReadPixelSpanR5G6B5(const void *src, Color *colors, int count)
+{
+    const unsigned short *pixels = (const unsigned short *)src;
+
+    for (int i = 0; i < count; i++)
+    {
+        colors[i].r = (unsigned char)((pixels[i] >> 11)*255/31);
+        colors[i].g = (unsigned char)(((pixels[i] >> 5) & 0x3f)*255/63);
+        colors[i].b = (unsigned char)((pixels[i] & 0x1f)*255/31);
+        colors[i].a = 255;
+    }
+}
+
+// Read pixels span: PIXELFORMAT_UNCOMPRESSED_R8G8B8
+static void ReadPixelSpanR8G8B8(const void *src, Color *colors, int count)
+{
+    const unsigned char *pixels = (const unsigned char *)src;
+
+    for (int i = 0; i < count; i++) colors[i] = (Color){ pixels[i*3], pixels[i*3 + 1], pixels[i*3 + 2], 255 };
+}
+
+// Read pixels span: PIXELFORMAT_UNCOMPRESSED_R5G5B5A1
+static void ReadPixelSpanR5G5B5A1(const void *src, Color *colors, int count)
+{
+    const unsigned short *pixels = (const unsigned short *)src;
+
+    for (int i = 0; i < count; i++)
+    {
+        colors[i].r = (unsigned char)((pixels[i] >> 11)*255/31);
+        colors[i].g = (unsigned char)(((pixels[i] >> 6) & 0x1f)*255/31);
+        colors[i].b = (unsigned char)(((pixels[i] >> 1) & 0x1f)*255/31);
+        colors[i].a = (pixels[i] & 0x1)? 255 : 0;
+    }
+}
+
+// Read pixels span: PIXELFORMAT_UNCOMPRESSED_R4G4B4A4
+static void ReadPixelSpanR4G4B4A4(const void *src, Color *colors, int count)
+{
+    const unsigned short *pixels = (const unsigned short *)src;
+
+    for (int i = 0; i < count; i++)
+    {
+        colors[i].r = (unsigned char)((pixels[i] >> 12)*255/15);
+        colors[i].g = (unsigned char)(((pixels[i] >> 8) & 0xf)*255/15);
+        colors[i].b = (unsigned char)(((pixels[i] >> 4) & 0xf)*255/15);
+        colors[i].a = (unsigned char)((pixels[i] & 0xf)*255/15);
+    }
+}
+
+// Read pixels span: PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+static void ReadPixelSpanR8G8B8A8(const void *src, Color *colors, int count)
+{
+    memcpy(colors, src, count*sizeof(Color));
+}
+
+// Read pixels span: PIXELFORMAT_UNCOMPRESSED_R32
+// NOTE: Pixel normalized float value is converted to [0..255], grayscale equivalent
+static void ReadPixelSpanR32(const void *src, Color *colors, int count)
+{
+    const float *pixels = (const float *)src;
+
+    for (int i = 0; i < count; i++)
+    {
+        unsigned char value = (unsigned char)(pixels[i]*255.0f);
+        colors[i] = (Color){ value, value, value, 255 };
+    }
+}
+
+// Read pixels span: PIXELFORMAT_UNCOMPRESSED_R32G32B32
+static void ReadPixelSpanR32G32B32(const void *src, Color *colors, int count)
+{
+    const float *pixels = (const float *)src;
+
+    for (int i = 0; i < count; i++)
+    {
+        colors[i].r = (unsigned char)(pixels[i*3]*255.0f);
+        colors[i].g = (unsigned char)(pixels[i*3 + 1]*255.0f);
+        colors[i].b = (unsigned char)(pixels[i*3 + 2]*255.0f);
+        colors[i].a = 255;
+    }
+}
+
+// Read pixels span: PIXELFORMAT_UNCOMPRESSED_R32G32B32A32
+static void ReadPixelSpanR32G32B32A32(const void *src, Color *colors, int count)
+{
+    const float *pixels = (const float *)src;
+
+    for (int i = 0; i < count; i++)
+    {
+        colors[i].r = (unsigned char)(pixels[i*4]*255.0f);
+        colors[i].g = (unsigned char)(pixels[i*4 + 1]*255.0f);
+        colors[i].b = (unsigned char)(pixels[i*4 + 2]*255.0f);
+        colors[i].a = (unsigned char)(pixels[i*4 + 3]*255.0f);
+    }
+}
+
+// Read pixels span: PIXELFORMAT_UNCOMPRESSED_R16
+// NOTE: Pixel normalized half-float value is converted to [0..255], grayscale equivalent
+static void ReadPixelSpanR16(const void *src, Color *colors, int count)
+{
+    const unsigned short *pixels = (const unsigned short *)src;
+
+    for (int i = 0; i < count; i++)
+    {
+        unsigned char value = (unsigned char)(HalfToFloat(pixels[i])*255.0f);
+        colors[i] = (Color){ value, value, value, 255 };
+    }
+}
+
+// Read pixels span: PIXELFORMAT_UNCOMPRESSED_R16G16B16
+static void ReadPixelSpanR16G16B16(const void *src, Color *colors, int count)
+{
+    const unsigned short *pixels = (const unsigned short *)src;
+
+    for (int i = 0; i < count; i++)
+    {
+        colors[i].r = (unsigned char)(HalfToFloat(pixels[i*3])*255.0f);
+        colors[i].g = (unsigned char)(HalfToFloat(pixels[i*3 + 1])*255.0f);
+        colors[i].b = (unsigned char)(HalfToFloat(pixels[i*3 + 2])*255.0f);
+        colors[i].a = 255;
+    }
+}
+
+// Read pixels span: PIXELFORMAT_UNCOMPRESSED_R16G16B16A16
+static void ReadPixelSpanR16G16B16A16(const void *src, Color *colors, int count)
+{
+    const unsigned short *pixels = (const unsigned short *)src;
+
+    for (int i = 0; i < count; i++)
+    {
+        colors[i].r = (unsigned char)(HalfToFloat(pixels[i*4])*255.0f);
+        colors[i].g = (unsigned char)(HalfToFloat(pixels[i*4 + 1])*255.0f);
+        colors[i].b = (unsigned char)(HalfToFloat(pixels[i*4 + 2])*255.0f);
+        colors[i].a = (unsigned char)(HalfToFloat(pixels[i*4 + 3])*255.0f);
+    }
+}
+
+// Write pixels span: PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+// NOTE: Grayscale equivalent color is calculated
+static void WritePixelSpanGrayscale(void *dst, const Color *colors, int count)
+{
+    unsigned char *pixels = (unsigned char *)dst;
+
+    for (int i = 0; i < count; i++)
+    {
+        Vector3 coln = { (float)colors[i].r/255.0f, (float)colors[i].g/255.0f, (float)colors[i].b/255.0f };
+        pixels[i] = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+    }
+}
+
+// Write pixels span: PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
+static void WritePixelSpanGrayAlpha(void *dst, const Color *colors, int count)
+{
+    unsigned char *pixels = (unsigned char *)dst;
+
+    for (int i = 0; i < count; i++)
+    {
+        Vector3 coln = { (float)colors[i].r/255.0f, (float)colors[i].g/255.0f, (float)colors[i].b/255.0f };
+        pixels[i*2] = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+        pixels[i*2 + 1] = colors[i].a;
+    }
+}
+
+// Write pixels span: PIXELFORMAT_UNCOMPRESSED_R5G6B5
+static void WritePixelSpanR5G6B5(void *dst, const Color *colors, int count)
+{
+    unsigned short *pixels = (unsigned short *)dst;
+
+    for (int i = 0; i < count; i++)
+    {
+        Vector3 coln = { (float)colors[i].r/255.0f, (float)colors[i].g/255.0f, (float)colors[i].b/255.0f };
+
+        unsigned char r = (unsigned char)(round(coln.x*31.0f));
+        unsigned char g = (unsigned char)(round(coln.y*63.0f));
+        unsigned char b = (unsigned char)(round(coln.z*31.0f));
+
+        pixels[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+    }
+}
+
+// Write pixels span: PIXELFORMAT_UNCOMPRESSED_R8G8B8
+static void WritePixelSpanR8G8B8(void *dst, const Color *colors, int count)
+{
+    unsigned char *pixels = (unsigned char *)dst;
+
+    for (int i = 0; i < count; i++)
+    {
+        pixels[i*3] = colors[i].r;
+        pixels[i*3 + 1] = colors[i].g;
+        pixels[i*3 + 2] = colors[i].b;
+    }
+}
+
+// Write pixels span: PIXELFORMAT_UNCOMPRESSED_R5G5B5A1
+static void WritePixelSpanR5G5B5A1(void *dst, const Color *colors, int count)
+{
+    unsigned short *pixels = (unsigned short *)dst;
+
+    for (int i = 0; i < count; i++)
+    {
+        Vector4 coln = { (float)colors[i].r/255.0f, (float)colors[i].g/255.0f, (float)colors[i].b/255.0f, (float)colors[i].a/255.0f };
+
+        unsigned char r = (unsigned char)(round(coln.x*31.0f));
+        unsigned char g = (unsigned char)(round(coln.y*31.0f));
+        unsigned char b = (unsigned char)(round(coln.z*31.0f));
+        unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+
+        pixels[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+    }
+}
+
+// Write pixels span: PIXELFORMAT_UNCOMPRESSED_R4G4B4A4
+static void WritePixelSpanR4G4B4A4(void *dst, const Color *colors, int count)
+{
+    unsigned short *pixels = (unsigned short *)dst;
+
+    for (int i = 0; i < count; i++)
+    {
+        Vector4 coln = { (float)colors[i].r/255.0f, (float)colors[i].g/255.0f, (float)colors[i].b/255.0f, (float)colors[i].a/255.0f };
+
+        unsigned char r = (unsigned char)(round(coln.x*15.0f));
+        unsigned char g = (unsigned char)(round(coln.y*15.0f));
+        unsigned char b = (unsigned char)(round(coln.z*15.0f));
+        unsigned char a = (unsigned char)(round(coln.w*15.0f));
+
+        pixels[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+    }
+}
+
+// Write pixels span: PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+static void WritePixelSpanR8G8B8A8(void *dst, const Color *colors, int count)
+{
+    memcpy(dst, colors, count*sizeof(Color));
+}
+
+// Write pixels span: PIXELFORMAT_UNCOMPRESSED_R32
+// NOTE: Grayscale equivalent color is calculated (normalized to 32bit)
+static void WritePixelSpanR32(void *dst, const Color *colors, int count)
+{
+    float *pixels = (float *)dst;
+
+    for (int i = 0; i < count; i++)
+    {
+        Vector3 coln = { (float)colors[i].r/255.0f, (float)colors[i].g/255.0f, (float)colors[i].b/255.0f };
+        pixels[i] = coln.x*0.299f + coln.y*0.587f + coln.z*0.114f;
+    }
+}
+
+// Write pixels span: PIXELFORMAT_UNCOMPRESSED_R32G32B32
+static void WritePixelSpanR32G32B32(void *dst, const Color *colors, int count)
+{
+    float *pixels = (float *)dst;
+
+    for (int i = 0; i < count; i++)
+    {
+        pixels[i*3] = (float)colors[i].r/255.0f;
+        pixels[i*3 + 1] = (float)colors[i].g/255.0f;
+        pixels[i*3 + 2] = (float)colors[i].b/255.0f;
+    }
+}
+
+// Write pixels span: PIXELFORMAT_UNCOMPRESSED_R32G32B32A32
+static void WritePixelSpanR32G32B32A32(void *dst, const Color *colors, int count)
+{
+    float *pixels = (float *)dst;
+
+    for (int i = 0; i < count; i++)
+    {
+        pixels[i*4] = (float)colors[i].r/255.0f;
+        pixels[i*4 + 1] = (float)colors[i].g/255.0f;
+        pixels[i*4 + 2] = (float)colors[i].b/255.0f;
+        pixels[i*4 + 3] = (float)colors[i].a/255.0f;
+    }
+}
+
+// Write pixels span: PIXELFORMAT_UNCOMPRESSED_R16
+// NOTE: Grayscale equivalent color is calculated (normalized to 16bit half-float)
+static void WritePixelSpanR16(void *dst, const Color *colors, int count)
+{
+    unsigned short *pixels = (unsigned short *)dst;
+
+    for (int i = 0; i < count; i++)
+    {
+        Vector3 coln = { (float)colors[i].r/255.0f, (float)colors[i].g/255.0f, (float)colors[i].b/255.0f };
+        pixels[i] = FloatToHalf(coln.x*0.299f + coln.y*0.587f + coln.z*0.114f);
+    }
+}
+
+// Write pixels span: PIXELFORMAT_UNCOMPRESSED_R16G16B16
+static void WritePixelSpanR16G16B16(void *dst, const Color *colors, int count)
+{
+    unsigned short *pixels = (unsigned short *)dst;
+
+    for (int i = 0; i < count; i++)
+    {
+        pixels[i*3] = FloatToHalf((float)colors[i].r/255.0f);
+        pixels[i*3 + 1] = FloatToHalf((float)colors[i].g/255.0f);
+        pixels[i*3 + 2] = FloatToHalf((float)colors[i].b/255.0f);
+    }
+}
+
+// Write pixels span: PIXELFORMAT_UNCOMPRESSED_R16G16B16A16
+static void WritePixelSpanR16G16B16A16(void *dst, const Color *colors, int count)
+{
+    unsigned short *pixels = (unsigned short *)dst;
+
+    for (int i = 0; i < count; i++)
+    {
+        pixels[i*4] = FloatToHalf((float)colors[i].r/255.0f);
+        pixels[i*4 + 1] = FloatToHalf((float)colors[i].g/255.0f);
+        pixels[i*4 + 2] = FloatToHalf((float)colors[i].b/255.0f);
+        pixels[i*4 + 3] = FloatToHalf((float)colors[i].a/255.0f);
+    }
+}
+
+#if defined(SUPPORT_FILEFORMAT_DDS)
+// Load texture from compressed DDS file view, with no image data copy
+// NOTE: Only block compressed formats (DXT1, DXT3, DXT5) are uploaded directly,
+// an empty texture is returned otherwise and data must be loaded as image
+static Texture2D LoadTextureFromDDSView(FileView fileView)
+{
+    Texture2D texture = { 0 };
+
+    // DDS data: "DDS " identifier + header (124 bytes) + pixel data (including mipmaps)
+    if ((fileView.data == NULL) || (fileView.size < 128) || (memcmp(fileView.data, "DDS ", 4) != 0)) return texture;
+
+    unsigned int header[31] = { 0 };
+    memcpy(header, fileView.data + 4, sizeof(header));
+
+    unsigned int height = header[2];
+    unsigned int width = header[3];
+    unsigned int linearSize = header[4];
+    unsigned int mipmapCount = header[6];
+    unsigned int formatFlags = header[19];
+    unsigned int formatFourCC = header[20];
+
+    if ((formatFlags != 0x04) && (formatFlags != 0x05)) return texture;
+
+    int format = 0;
+    switch (formatFourCC)
+    {
+        case 0x31545844: format = (formatFlags == 0x04)? PIXELFORMAT_COMPRESSED_DXT1_RGB : PIXELFORMAT_COMPRESSED_DXT1_RGBA; break;  // "DXT1"
+        case 0x33545844: format = PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;     // "DXT3"
+        case 0x35545844: format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;     // "DXT5"
+        default: return texture;
+    }
+
+    // Data size including all mipmaps, computed as rl_load_dds_from_memory()
+    long long dataSize = (mipmapCount > 1)? (linearSize + linearSize/3) : linearSize;
+    if ((dataSize == 0) || ((128 + dataSize) > fileView.size)) return texture;
+
+    texture.id = rlLoadTexture(fileView.data + 128, width, height, format, (mipmapCount == 0)? 1 : mipmapCount);
+    texture.width = width;
+    texture.height = height;
+    texture.mipmaps = (mipmapCount == 0)? 1 : mipmapCount;
+    texture.format = format;
+
+    return texture;
+}
+#endif
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Upload texture deferred on async loading thread (main thread)
+// NOTE: Texture is left unchanged if it was not deferred
+void UploadAsyncTexture(AsyncUploads *uploads, Texture2D *texture)
+{
+    if (!(texture->id & ASYNC_DEFERRED_TEXTURE)) return;
+
+    int index = (int)(texture->id & ~ASYNC_DEFERRED_TEXTURE);
+
+    if ((uploads != NULL) && (index < uploads->imageCount)) *texture = LoadTextureFromImage(uploads->images[index]);
+    else texture->id = 0;
+}
+
+// Load texture image (loading thread)
+static bool LoadTextureAsyncData(void *data)
+{
+    TextureAsyncLoad *load = (TextureAsyncLoad *)data;
+
+    load->image = LoadImage(load->fileName);
+
+    return (load->image.data != NULL);
+}
+
+// Upload texture image (main thread)
+static bool UploadTextureAsyncData(void *data, AsyncUploads *uploads)
+{
+    TextureAsyncLoad *load = (TextureAsyncLoad *)data;
+    (void)uploads;
+
+    load->texture = LoadTextureFromImage(load->image);
+    UnloadImage(load->image);
+    load->image = (Image){ 0 };
+
+    return (load->texture.id > 0);
+}
+
+// Unload texture async load data not retrieved (main thread)
+static void UnloadTextureAsyncData(void *data, bool uploaded)
+{
+    TextureAsyncLoad *load = (TextureAsyncLoad *)data;
+
+    if (uploaded) UnloadTexture(load->texture);
+    else UnloadImage(load->image);
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RTEXTURES
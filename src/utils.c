@@ -7,6 +7,10 @@
 *           Show TraceLog() output messages
 *           NOTE: By default LOG_DEBUG traces not shown
 *
+*       #define SUPPORT_ASSET_PACK
+*           Support mounting asset packs (.rpak), file loading functions read packed files transparently
+*           NOTE: Compressed entries require SUPPORT_COMPRESSION_API (DEFLATE implementation in rcore)
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -29,6 +33,13 @@
 *
 **********************************************************************************************/
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE                 // Required for: fseeko(), ftello(), mmap() if compiled with c99 without gnu ext.
+#endif
+#if !defined(_FILE_OFFSET_BITS)
+    #define _FILE_OFFSET_BITS 64        // Required for: files bigger than 2GB on 32bit platforms
+#endif
+
 #include "raylib.h"                     // WARNING: Required for: LogType enum
 
 // Check if config flags have been externally provided on compilation line
@@ -49,6 +60,27 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+#if defined(SUPPORT_JOB_SYSTEM) || defined(SUPPORT_ASSET_PACK) || defined(SUPPORT_ASYNC_LOADING)
+    #include <pthread.h>                // Required for: pthread_create(), pthread_join(), pthread_mutex_*(), pthread_cond_*()
+#endif
+
+// File views are memory mapped on POSIX systems, file data is loaded into memory otherwise
+#if defined(SUPPORT_STANDARD_FILEIO) && (defined(__linux__) || defined(__APPLE__) || defined(__FreeBSD__)) && !defined(PLATFORM_ANDROID)
+    #define FILE_VIEW_MMAP
+    #include <sys/mman.h>               // Required for: mmap(), munmap()
+    #include <sys/stat.h>               // Required for: fstat()
+    #include <fcntl.h>                  // Required for: open()
+    #include <unistd.h>                 // Required for: close()
+#endif
+
+#if defined(SUPPORT_ASSET_PACK)
+    #if defined(SUPPORT_COMPRESSION_API)
+        #define ASSET_PACK_COMPRESSION
+        #include "external/sinfl.h"     // Required for: sinflate() (implementation in rcore)
+        #include "external/sdefl.h"     // Required for: sdeflate(), sdefl_bound() (implementation in rcore)
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -56,6 +88,43 @@
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
 
+// File offsets and sizes are 64bit, files bigger than 2GB are supported
+#if defined(_WIN32)
+    #define FILE_SEEK64(file, offset, origin)   _fseeki64(file, offset, origin)
+    #define FILE_TELL64(file)                   _ftelli64(file)
+#elif defined(__linux__) || defined(__APPLE__) || defined(__FreeBSD__)
+    #define FILE_SEEK64(file, offset, origin)   fseeko(file, offset, origin)
+    #define FILE_TELL64(file)                   ftello(file)
+#else
+    #define FILE_SEEK64(file, offset, origin)   fseek(file, offset, origin)
+    #define FILE_TELL64(file)                   ftell(file)
+#endif
+
+#if defined(SUPPORT_ASSET_PACK)
+    #ifndef MAX_ASSET_PACKS
+        #define MAX_ASSET_PACKS                 8       // Maximum number of asset packs mounted at the same time
+    #endif
+    #ifndef ASSET_PACK_ALIGNMENT
+        #define ASSET_PACK_ALIGNMENT           64       // Uncompressed entries data alignment in asset pack file
+    #endif
+    #ifndef MAX_FILEPATH_LENGTH
+        #define MAX_FILEPATH_LENGTH          4096       // Maximum length for filepaths
+    #endif
+
+    #define ASSET_PACK_VERSION                  1       // Asset pack file format version
+    #define ASSET_PACK_ENTRY_COMPRESSED         1       // Asset pack entry flag: data is compressed (DEFLATE)
+    #define ASSET_PACK_COMPRESSION_LEVEL        8       // Asset pack entries compression level, same as CompressData()
+#endif
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    #ifndef MAX_ASYNC_LOADS
+        #define MAX_ASYNC_LOADS                64       // Maximum number of async loads in progress (or not retrieved)
+    #endif
+    #ifndef ASYNC_UPLOAD_BUDGET
+        #define ASYNC_UPLOAD_BUDGET          2.0f       // Default per-frame time budget for async loads GPU uploads (milliseconds)
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -81,6 +150,136 @@ static AAssetManager *assetManager = NULL;          // Android assets manager po
 static const char *internalDataPath = NULL;         // Android internal data path
 #endif
 
+#if defined(SUPPORT_ASSET_PACK)
+// Asset pack file header (32 bytes)
+// NOTE: Pack file layout: header + entries data + entries index (sorted by name hash) + entries names,
+// all values are stored little-endian
+typedef struct AssetPackHeader {
+    char id[4];                     // Pack file identifier: "rPAK"
+    unsigned int version;           // Pack file format version
+    unsigned int entryCount;        // Number of entries in the index
+    unsigned int alignment;         // Uncompressed entries data alignment
+    unsigned long long indexOffset; // Entries index offset in file
+    unsigned long long namesOffset; // Entries names offset in file, names are '\0' terminated, up to end of file
+} AssetPackHeader;
+
+// Asset pack index entry (40 bytes)
+typedef struct AssetPackEntry {
+    unsigned long long hash;        // Entry name hash (FNV-1a 64bit)
+    unsigned long long offset;      // Entry data offset in file
+    unsigned long long size;        // Entry data size (uncompressed)
+    unsigned long long packedSize;  // Entry data size stored in file
+    unsigned int nameOffset;        // Entry name offset in names table
+    unsigned int flags;             // Entry flags: ASSET_PACK_ENTRY_COMPRESSED
+} AssetPackEntry;
+
+// Asset pack mounted
+typedef struct AssetPack {
+    char *mountPath;                // Path packed files are accessed from, "" for working directory
+    int mountLength;                // Mount path length
+    AssetPackEntry *entries;        // Entries index (sorted by name hash)
+    unsigned int entryCount;        // Entries count
+    char *names;                    // Entries names table
+    unsigned int namesSize;         // Entries names table size
+    FILE *file;                     // Pack file, kept open to read entries data (not memory mapped)
+    const unsigned char *mapData;   // Pack file memory mapped data
+    long long mapSize;              // Pack file memory mapped size
+} AssetPack;
+
+static AssetPack assetPacks[MAX_ASSET_PACKS] = { 0 };   // Asset packs mounted, last mounted is searched first
+static int assetPackCount = 0;                          // Asset packs mounted count
+static pthread_mutex_t assetPackLock = PTHREAD_MUTEX_INITIALIZER;  // Asset pack file read lock (not memory mapped)
+static pthread_rwlock_t assetPackMountLock = PTHREAD_RWLOCK_INITIALIZER;   // Mounted asset packs lock: lookups/reads shared, mount/unmount exclusive
+#endif
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Async load phase
+typedef enum {
+    ASYNC_PHASE_FREE = 0,           // Load slot not used
+    ASYNC_PHASE_QUEUED,             // Waiting for loading thread
+    ASYNC_PHASE_LOADING,            // Loading on loading thread (or processing on main thread)
+    ASYNC_PHASE_LOADED,             // Loaded, waiting for main thread processing (upload)
+    ASYNC_PHASE_READY,              // Uploaded, waiting for result retrieval
+    ASYNC_PHASE_FAILED              // Failed, waiting for handle release
+} AsyncLoadPhase;
+
+// Async load
+typedef struct AsyncLoad {
+    unsigned int handle;            // Load handle, returned to user
+    int type;                       // Asset type (AsyncAssetType)
+    int phase;                      // Load phase (AsyncLoadPhase)
+    bool success;                   // Load function result
+    bool cancelled;                 // Load cancelled while loading, data is unloaded once loaded
+    void *data;                     // Asset load data (module specific)
+    AsyncLoadFunction load;         // Asset loading function (loading thread)
+    AsyncUploadFunction upload;     // Asset upload function (main thread)
+    AsyncUnloadFunction unload;     // Asset unload function (main thread)
+    AsyncLoadCallback callback;     // User callback, called on main thread once finished
+    void *userData;                 // User callback data
+    AsyncUploads uploads;           // GPU uploads deferred while loading
+} AsyncLoad;
+
+// Async loader state
+typedef struct AsyncLoader {
+    bool ready;                     // Loading thread running
+    bool quit;                      // Loading thread requested to exit
+    pthread_t thread;               // Loading thread
+
+    pthread_mutex_t lock;           // Async loader state lock
+    pthread_cond_t wake;            // Loading thread wake up signal: new loads queued or quit
+    pthread_cond_t loaded;          // Main thread signal: one load finished loading
+
+    unsigned int handleCounter;     // Last handle returned
+    float uploadBudget;             // Per-frame time budget for uploads (milliseconds)
+    AsyncLoad *current;             // Load in progress on loading thread
+    AsyncLoad loads[MAX_ASYNC_LOADS];   // Loads in progress (or not retrieved)
+} AsyncLoader;
+
+static AsyncLoader asyncLoader = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .wake = PTHREAD_COND_INITIALIZER,
+    .loaded = PTHREAD_COND_INITIALIZER,
+    .uploadBudget = ASYNC_UPLOAD_BUDGET
+};
+#endif
+
+#if defined(SUPPORT_JOB_SYSTEM)
+// Job range owned by one participant (worker thread or calling thread)
+// NOTE: Owner takes jobs from range begin, thieves steal the upper half of the range
+typedef struct JobRange {
+    pthread_mutex_t lock;           // Range access lock
+    int begin;                      // First job index not taken
+    int end;                        // Last job index (not included)
+} JobRange;
+
+// Job system state
+typedef struct JobSystem {
+    bool ready;                     // Worker threads running
+    bool quit;                      // Worker threads requested to exit
+    int workerCount;                // Worker threads count (calling thread not included)
+    int requestedCount;             // Worker threads count requested by user (-1 for default)
+    pthread_t workers[MAX_JOB_WORKERS];     // Worker threads
+
+    pthread_mutex_t lock;           // Job system state lock
+    pthread_cond_t wake;            // Workers wake up signal: new jobs available or quit
+    pthread_cond_t done;            // Calling thread signal: all jobs done
+
+    bool active;                    // Jobs batch in progress
+    unsigned int generation;        // Jobs batch counter, workers join every batch once
+    JobFunction func;               // Current batch job function
+    void *userData;                 // Current batch job function data
+    int pending;                    // Current batch jobs not completed
+    int busy;                       // Workers processing current batch
+
+    JobRange ranges[MAX_JOB_WORKERS + 1];   // Job ranges, one per participant (0 for calling thread)
+} JobSystem;
+
+static JobSystem jobs = { .requestedCount = -1 };
+static pthread_mutex_t jobsInitLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t jobsIdle = PTHREAD_COND_INITIALIZER;     // Signaled when no RunJobs() call is in flight
+static int jobsRunning = 0;                                     // RunJobs() calls in flight, guarded by jobsInitLock
+#endif
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
@@ -94,6 +293,27 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+#if defined(SUPPORT_ASSET_PACK)
+static unsigned long long HashAssetPackName(const char *name);  // Compute asset pack entry name hash (FNV-1a 64bit)
+static const AssetPackEntry *FindAssetPackEntry(const char *fileName, AssetPack **pack);   // Find file entry in mounted asset packs
+static unsigned char *LoadAssetPackEntry(AssetPack *pack, const AssetPackEntry *entry, int padding);   // Load entry data from asset pack, padding bytes are zeroed
+static int CompareAssetPackEntries(const void *a, const void *b);  // Compare asset pack entries by name hash (qsort callback)
+#endif
+
+#if defined(SUPPORT_ASYNC_LOADING)
+static void *AsyncLoadThread(void *arg);            // Async loading thread, loads are processed in queue order
+static AsyncLoad *FindAsyncLoad(unsigned int handle);   // Find async load by handle
+static AsyncLoad *FindOldestAsyncLoad(int phase);   // Find oldest async load in a phase
+static void ProcessAsyncLoad(AsyncLoad *load);      // Process async load finished by loading thread (main thread)
+#endif
+
+#if defined(SUPPORT_JOB_SYSTEM)
+static void InitJobSystem(void);                    // Init job system, worker threads are created
+static int TakeJob(int participant);                // Take next job for participant (own range or stolen)
+static int ProcessJobs(int participant, JobFunction func, void *userData); // Process jobs until no jobs are left
+static void *JobWorkerThread(void *arg);            // Job system worker thread
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
 //----------------------------------------------------------------------------------
@@ -189,7 +409,54 @@ void MemFree(void *ptr)
     RL_FREE(ptr);
 }
 
+#if defined(SUPPORT_STANDARD_FILEIO)
+// Read data from file into a buffer, maxSize limits the file size accepted (0 for no limit)
+static unsigned char *ReadFileData(const char *fileName, long long *dataSize, long long maxSize)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
+
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        // WARNING: On binary streams SEEK_END could not be found,
+        // using fseek() and ftell() could not work in some (rare) cases
+        FILE_SEEK64(file, 0, SEEK_END);
+        long long size = (long long)FILE_TELL64(file);
+        FILE_SEEK64(file, 0, SEEK_SET);
+
+        if ((maxSize > 0) && (size > maxSize))
+        {
+            TRACELOG(LOG_WARNING, "FILEIO: [%s] File is bigger than %lli bytes, use LoadFileView()", fileName, maxSize);
+        }
+        else if ((size > 0) && ((unsigned long long)size <= (size_t)-1))
+        {
+            data = (unsigned char *)RL_MALLOC((size_t)size*sizeof(unsigned char));
+
+            if (data != NULL)
+            {
+                // NOTE: fread() returns number of read elements instead of bytes, so we read [1 byte, size elements]
+                size_t count = fread(data, sizeof(unsigned char), (size_t)size, file);
+                *dataSize = (long long)count;
+
+                if ((*dataSize) != size) TRACELOG(LOG_WARNING, "FILEIO: [%s] File partially loaded (%lli bytes out of %lli)", fileName, *dataSize, size);
+                else TRACELOG(LOG_INFO, "FILEIO: [%s] File loaded successfully", fileName);
+            }
+            else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to allocated memory for file reading", fileName);
+        }
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file", fileName);
+
+        fclose(file);
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+
+    return data;
+}
+#endif
+
 // Load data from file into a buffer
+// NOTE: dataSize is an int, files bigger than 2147483647 bytes must be accessed with LoadFileView()
 unsigned char *LoadFileData(const char *fileName, int *dataSize)
 {
     unsigned char *data = NULL;
@@ -197,68 +464,146 @@ unsigned char *LoadFileData(const char *fileName, int *dataSize)
 
     if (fileName != NULL)
     {
+#if defined(SUPPORT_ASSET_PACK)
+        AssetPack *pack = NULL;
+
+        pthread_rwlock_rdlock(&assetPackMountLock);
+        const AssetPackEntry *entry = FindAssetPackEntry(fileName, &pack);
+
+        if (entry != NULL)
+        {
+            if (entry->size > 2147483647) TRACELOG(LOG_WARNING, "FILEIO: [%s] File is bigger than 2147483647 bytes, use LoadFileView()", fileName);
+            else
+            {
+                data = LoadAssetPackEntry(pack, entry, 0);
+                if (data != NULL) *dataSize = (int)entry->size;
+            }
+        }
+        pthread_rwlock_unlock(&assetPackMountLock);
+
+        if (entry != NULL) return data;
+#endif
         if (loadFileData)
         {
             data = loadFileData(fileName, dataSize);
             return data;
         }
 #if defined(SUPPORT_STANDARD_FILEIO)
-        FILE *file = fopen(fileName, "rb");
+        long long size = 0;
+        data = ReadFileData(fileName, &size, 2147483647);
+        *dataSize = (int)size;
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, use custom file callback");
+#endif
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
 
-        if (file != NULL)
+    return data;
+}
+
+// Unload file data allocated by LoadFileData()
+void UnloadFileData(unsigned char *data)
+{
+    RL_FREE(data);
+}
+
+// Load read-only view of file data
+// NOTE: File is memory mapped when supported, data pages are read on access with no copy,
+// otherwise (or using a custom file data loader) file data is loaded into memory
+// WARNING: Views of uncompressed files in a memory mapped asset pack point to pack data,
+// they must be unloaded before the asset pack is unmounted
+FileView LoadFileView(const char *fileName)
+{
+    FileView view = { 0 };
+
+    if (fileName != NULL)
+    {
+#if defined(SUPPORT_ASSET_PACK)
+        AssetPack *pack = NULL;
+
+        pthread_rwlock_rdlock(&assetPackMountLock);
+        const AssetPackEntry *entry = FindAssetPackEntry(fileName, &pack);
+
+        if (entry != NULL)
         {
-            // WARNING: On binary streams SEEK_END could not be found,
-            // using fseek() and ftell() could not work in some (rare) cases
-            fseek(file, 0, SEEK_END);
-            int size = ftell(file);     // WARNING: ftell() returns 'long int', maximum size returned is INT_MAX (2147483647 bytes)
-            fseek(file, 0, SEEK_SET);
+            if ((pack->mapData != NULL) && !(entry->flags & ASSET_PACK_ENTRY_COMPRESSED)) view.data = pack->mapData + entry->offset;
+            else view.data = LoadAssetPackEntry(pack, entry, 0);
 
-            if (size > 0)
+            if (view.data != NULL) view.size = (long long)entry->size;
+        }
+        pthread_rwlock_unlock(&assetPackMountLock);
+
+        if (entry != NULL) return view;
+#endif
+        if (loadFileData)
+        {
+            int dataSize = 0;
+            view.data = loadFileData(fileName, &dataSize);
+            view.size = dataSize;
+            return view;
+        }
+#if defined(FILE_VIEW_MMAP)
+        int fd = open(fileName, O_RDONLY);
+
+        if (fd >= 0)
+        {
+            struct stat info = { 0 };
+
+            if ((fstat(fd, &info) == 0) && (info.st_size > 0) && ((unsigned long long)info.st_size <= (size_t)-1))
             {
-                data = (unsigned char *)RL_MALLOC(size*sizeof(unsigned char));
+                void *data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
 
-                if (data != NULL)
+                if (data != MAP_FAILED)
                 {
-                    // NOTE: fread() returns number of read elements instead of bytes, so we read [1 byte, size elements]
-                    size_t count = fread(data, sizeof(unsigned char), size, file);
-
-                    // WARNING: fread() returns a size_t value, usually 'unsigned int' (32bit compilation) and 'unsigned long long' (64bit compilation)
-                    // dataSize is unified along raylib as a 'int' type, so, for file-sizes > INT_MAX (2147483647 bytes) we have a limitation
-                    if (count > 2147483647)
-                    {
-                        TRACELOG(LOG_WARNING, "FILEIO: [%s] File is bigger than 2147483647 bytes, avoid using LoadFileData()", fileName);
-
-                        RL_FREE(data);
-                        data = NULL;
-                    }
-                    else
-                    {
-                        *dataSize = (int)count;
-
-                        if ((*dataSize) != size) TRACELOG(LOG_WARNING, "FILEIO: [%s] File partially loaded (%i bytes out of %i)", fileName, dataSize, count);
-                        else TRACELOG(LOG_INFO, "FILEIO: [%s] File loaded successfully", fileName);
-                    }
+                    view.data = (const unsigned char *)data;
+                    view.size = (long long)info.st_size;
+                    view.mapped = true;
+
+                    TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully", fileName);
                 }
-                else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to allocated memory for file reading", fileName);
+                else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to map file", fileName);
             }
             else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file", fileName);
 
-            fclose(file);
+            close(fd);      // NOTE: Mapping is kept after closing the file
         }
         else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+#elif defined(SUPPORT_STANDARD_FILEIO)
+        view.data = ReadFileData(fileName, &view.size, 0);
 #else
     TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, use custom file callback");
 #endif
     }
     else TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
 
-    return data;
+    return view;
 }
 
-// Unload file data allocated by LoadFileData()
-void UnloadFileData(unsigned char *data)
+// Unload file data view
+void UnloadFileView(FileView view)
 {
-    RL_FREE(data);
+#if defined(SUPPORT_ASSET_PACK)
+    // Views pointing to memory mapped asset pack data are not owned
+    bool packed = false;
+
+    pthread_rwlock_rdlock(&assetPackMountLock);
+    for (int i = 0; (i < assetPackCount) && !packed; i++)
+    {
+        if ((assetPacks[i].mapData != NULL) && (view.data >= assetPacks[i].mapData) &&
+            (view.data < (assetPacks[i].mapData + assetPacks[i].mapSize))) packed = true;
+    }
+    pthread_rwlock_unlock(&assetPackMountLock);
+
+    if (packed) return;
+#endif
+#if defined(FILE_VIEW_MMAP)
+    if (view.mapped)
+    {
+        munmap((void *)view.data, (size_t)view.size);
+        return;
+    }
+#endif
+    RL_FREE((void *)view.data);
 }
 
 // Save data to file from buffer
@@ -359,6 +704,17 @@ char *LoadFileText(const char *fileName)
 
     if (fileName != NULL)
     {
+#if defined(SUPPORT_ASSET_PACK)
+        AssetPack *pack = NULL;
+
+        // NOTE: Packed text is returned as stored, no line endings translation is done
+        pthread_rwlock_rdlock(&assetPackMountLock);
+        const AssetPackEntry *entry = FindAssetPackEntry(fileName, &pack);
+        if (entry != NULL) text = (char *)LoadAssetPackEntry(pack, entry, 1);
+        pthread_rwlock_unlock(&assetPackMountLock);
+
+        if (entry != NULL) return text;
+#endif
         if (loadFileText)
         {
             text = loadFileText(fileName);
@@ -449,61 +805,799 @@ bool SaveFileText(const char *fileName, char *text)
     return success;
 }
 
-#if defined(PLATFORM_ANDROID)
-// Initialize asset manager from android app
-void InitAssetManager(AAssetManager *manager, const char *dataPath)
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Asset packs
+//----------------------------------------------------------------------------------
+
+// Mount asset pack, packed files are accessed as files in mountPath (NULL or "" for working directory)
+// NOTE: Only pack index is loaded, pack file is memory mapped when supported or kept open otherwise,
+// so packed files are loaded with no additional file open
+bool MountAssetPack(const char *fileName, const char *mountPath)
 {
-    assetManager = manager;
-    internalDataPath = dataPath;
+    bool success = false;
+
+#if defined(SUPPORT_ASSET_PACK) && defined(SUPPORT_STANDARD_FILEIO)
+    pthread_rwlock_rdlock(&assetPackMountLock);
+    bool full = (assetPackCount >= MAX_ASSET_PACKS);
+    pthread_rwlock_unlock(&assetPackMountLock);
+
+    if (full)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Asset pack could not be mounted, MAX_ASSET_PACKS reached", fileName);
+        return false;
+    }
+
+    FILE *file = fopen(fileName, "rb");
+
+    if (file == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open asset pack", fileName);
+        return false;
+    }
+
+    AssetPack pack = { 0 };
+    AssetPackHeader header = { 0 };
+
+    FILE_SEEK64(file, 0, SEEK_END);
+    long long fileSize = (long long)FILE_TELL64(file);
+    FILE_SEEK64(file, 0, SEEK_SET);
+
+    if ((fread(&header, sizeof(AssetPackHeader), 1, file) != 1) || (memcmp(header.id, "rPAK", 4) != 0) || (header.version != ASSET_PACK_VERSION) ||
+        (header.indexOffset + (unsigned long long)header.entryCount*sizeof(AssetPackEntry) > header.namesOffset) ||
+        (header.namesOffset > (unsigned long long)fileSize) || ((unsigned long long)fileSize - header.namesOffset > 0xffffffff))
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Asset pack file not valid", fileName);
+        fclose(file);
+        return false;
+    }
+
+    // Load entries index and names table
+    pack.entryCount = header.entryCount;
+    pack.namesSize = (unsigned int)((unsigned long long)fileSize - header.namesOffset);
+    pack.entries = (AssetPackEntry *)RL_MALLOC((pack.entryCount + 1)*sizeof(AssetPackEntry));
+    pack.names = (char *)RL_MALLOC(pack.namesSize + 1);
+
+    bool valid = (pack.entries != NULL) && (pack.names != NULL);
+
+    if (valid)
+    {
+        FILE_SEEK64(file, (long long)header.indexOffset, SEEK_SET);
+        valid = (fread(pack.entries, sizeof(AssetPackEntry), pack.entryCount, file) == pack.entryCount);
+        FILE_SEEK64(file, (long long)header.namesOffset, SEEK_SET);
+        valid = valid && (fread(pack.names, 1, pack.namesSize, file) == pack.namesSize);
+        pack.names[pack.namesSize] = '\0';
+    }
+
+    // Security check: entries data and names must be inside pack file
+    for (unsigned int i = 0; valid && (i < pack.entryCount); i++)
+    {
+        const AssetPackEntry *entry = &pack.entries[i];
+
+        if ((entry->nameOffset >= pack.namesSize) || (entry->offset > (unsigned long long)fileSize) ||
+            (entry->packedSize > (unsigned long long)fileSize - entry->offset) ||
+            (!(entry->flags & ASSET_PACK_ENTRY_COMPRESSED) && (entry->packedSize != entry->size))) valid = false;
+    }
+
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Asset pack index not valid", fileName);
+        RL_FREE(pack.entries);
+        RL_FREE(pack.names);
+        fclose(file);
+        return false;
+    }
+
+#if defined(FILE_VIEW_MMAP)
+    if ((fileSize > 0) && ((unsigned long long)fileSize <= (size_t)-1))
+    {
+        void *data = mmap(NULL, (size_t)fileSize, PROT_READ, MAP_PRIVATE, fileno(file), 0);
+
+        if (data != MAP_FAILED)
+        {
+            pack.mapData = (const unsigned char *)data;
+            pack.mapSize = fileSize;
+        }
+    }
+#endif
+    if (pack.mapData != NULL) fclose(file);     // NOTE: Mapping is kept after closing the file
+    else pack.file = file;
+
+    // Mount path is stored normalized: no leading "./", no trailing separator
+    if (mountPath == NULL) mountPath = "";
+    while ((mountPath[0] == '.') && ((mountPath[1] == '/') || (mountPath[1] == '\\'))) mountPath += 2;
+
+    pack.mountLength = (int)strlen(mountPath);
+    pack.mountPath = (char *)RL_CALLOC(pack.mountLength + 1, 1);
+    for (int i = 0; i < pack.mountLength; i++) pack.mountPath[i] = (mountPath[i] == '\\')? '/' : mountPath[i];
+    while ((pack.mountLength > 0) && (pack.mountPath[pack.mountLength - 1] == '/')) pack.mountPath[--pack.mountLength] = '\0';
+    if ((pack.mountLength == 1) && (pack.mountPath[0] == '.')) pack.mountPath[--pack.mountLength] = '\0';
+
+    // NOTE: Mount table is only modified with exclusive access, loads in flight on other threads (async loading) are completed first
+    pthread_rwlock_wrlock(&assetPackMountLock);
+    if (assetPackCount < MAX_ASSET_PACKS)
+    {
+        assetPacks[assetPackCount] = pack;
+        assetPackCount++;
+        success = true;
+    }
+    pthread_rwlock_unlock(&assetPackMountLock);
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Asset pack mounted successfully (%u entries, %s)", fileName, pack.entryCount, (pack.mapData != NULL)? "mapped" : "streamed");
+    else
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Asset pack could not be mounted, MAX_ASSET_PACKS reached", fileName);
+#if defined(FILE_VIEW_MMAP)
+        if (pack.mapData != NULL) munmap((void *)pack.mapData, (size_t)pack.mapSize);
+#endif
+        if (pack.file != NULL) fclose(pack.file);
+        RL_FREE(pack.mountPath);
+        RL_FREE(pack.entries);
+        RL_FREE(pack.names);
+    }
+#else
+    (void)mountPath;
+    TRACELOG(LOG_WARNING, "FILEIO: [%s] Asset packs not supported", fileName);
+#endif
+
+    return success;
 }
 
-// Replacement for fopen()
-// Ref: https://developer.android.com/ndk/reference/group/asset
-FILE *android_fopen(const char *fileName, const char *mode)
+// Unmount all asset packs
+// NOTE: Waits for asset pack reads in flight on other threads (i.e. async loading)
+// WARNING: File views loaded from asset packs must be unloaded before
+void UnmountAssetPacks(void)
 {
-    if (mode[0] == 'w')
+#if defined(SUPPORT_ASSET_PACK)
+    pthread_rwlock_wrlock(&assetPackMountLock);
+
+    for (int i = 0; i < assetPackCount; i++)
     {
-        // fopen() is mapped to android_fopen() that only grants read access to
-        // assets directory through AAssetManager but we want to also be able to
-        // write data when required using the standard stdio FILE access functions
-        // Ref: https://stackoverflow.com/questions/11294487/android-writing-saving-files-from-native-code-only
-        #undef fopen
-        return fopen(TextFormat("%s/%s", internalDataPath, fileName), mode);
-        #define fopen(name, mode) android_fopen(name, mode)
+        AssetPack *pack = &assetPacks[i];
+
+#if defined(FILE_VIEW_MMAP)
+        if (pack->mapData != NULL) munmap((void *)pack->mapData, (size_t)pack->mapSize);
+#endif
+        if (pack->file != NULL) fclose(pack->file);
+
+        RL_FREE(pack->mountPath);
+        RL_FREE(pack->entries);
+        RL_FREE(pack->names);
+        memset(pack, 0, sizeof(AssetPack));
     }
-    else
+
+    assetPackCount = 0;
+
+    pthread_rwlock_unlock(&assetPackMountLock);
+#endif
+}
+
+// Export asset pack from all files in base path (recursive), returns true on success
+// NOTE: Files are stored with their path relative to basePath, compressed if requested and it reduces
+// file size, uncompressed files are aligned to ASSET_PACK_ALIGNMENT to be accessed directly when mapped
+bool ExportAssetPack(const char *fileName, const char *basePath, bool compress)
+{
+    bool success = false;
+
+#if defined(SUPPORT_ASSET_PACK) && defined(SUPPORT_STANDARD_FILEIO)
+    FilePathList files = LoadDirectoryFilesEx(basePath, NULL, true);
+
+    AssetPackEntry *entries = (AssetPackEntry *)RL_CALLOC(files.count + 1, sizeof(AssetPackEntry));
+    unsigned int entryCount = 0;
+
+    // Names table, computed from path lengths (upper bound)
+    unsigned long long namesCapacity = 1;
+    for (unsigned int i = 0; i < files.count; i++) namesCapacity += strlen(files.paths[i]) + 1;
+    char *names = (char *)RL_CALLOC((size_t)namesCapacity, 1);
+    unsigned int namesSize = 0;
+
+    FILE *file = fopen(fileName, "wb");
+
+    if ((file == NULL) || (entries == NULL) || (names == NULL) || (namesCapacity > 0xffffffff))
     {
-        // NOTE: AAsset provides access to read-only asset
-        AAsset *asset = AAssetManager_open(assetManager, fileName, AASSET_MODE_UNKNOWN);
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to create asset pack", fileName);
+        if (file != NULL) fclose(file);
+        RL_FREE(entries);
+        RL_FREE(names);
+        UnloadDirectoryFiles(files);
+        return false;
+    }
 
-        if (asset != NULL)
+#if defined(ASSET_PACK_COMPRESSION)
+    struct sdefl *sdefl = compress? (struct sdefl *)RL_CALLOC(1, sizeof(struct sdefl)) : NULL;   // WARNING: struct sdefl is almost 1MB
+#else
+    if (compress) TRACELOG(LOG_WARNING, "FILEIO: [%s] Asset pack compression not supported, files stored uncompressed", fileName);
+#endif
+
+    const unsigned char padding[ASSET_PACK_ALIGNMENT] = { 0 };
+    AssetPackHeader header = { .id = { 'r', 'P', 'A', 'K' }, .version = ASSET_PACK_VERSION, .alignment = ASSET_PACK_ALIGNMENT };
+    unsigned long long offset = sizeof(AssetPackHeader);
+    bool valid = (fwrite(&header, sizeof(AssetPackHeader), 1, file) == 1);
+
+    int baseLength = (int)strlen(basePath);
+
+    for (unsigned int i = 0; valid && (i < files.count); i++)
+    {
+        // Entry name: path relative to basePath, using '/' as separator
+        const char *name = files.paths[i] + baseLength;
+        while ((name[0] == '/') || (name[0] == '\\')) name++;
+
+        if (strcmp(files.paths[i], fileName) == 0) continue;    // Pack file could be exported into base path
+
+        FileView view = LoadFileView(files.paths[i]);
+
+        if (view.data == NULL)
         {
-            // Get pointer to file in the assets
-            return funopen(asset, android_read, android_write, android_seek, android_close);
+            TRACELOG(LOG_WARNING, "FILEIO: [%s] File not added to asset pack", files.paths[i]);
+            continue;
         }
-        else
+
+        AssetPackEntry *entry = &entries[entryCount];
+        entry->nameOffset = namesSize;
+        for (int c = 0; name[c] != '\0'; c++) names[namesSize++] = (name[c] == '\\')? '/' : name[c];
+        names[namesSize++] = '\0';
+        entry->hash = HashAssetPackName(names + entry->nameOffset);
+        entry->size = (unsigned long long)view.size;
+
+#if defined(ASSET_PACK_COMPRESSION)
+        if ((sdefl != NULL) && (view.size <= 2147483647/2))
         {
-            #undef fopen
-            // Just do a regular open if file is not found in the assets
-            return fopen(TextFormat("%s/%s", internalDataPath, fileName), mode);
-            #define fopen(name, mode) android_fopen(name, mode)
+            unsigned char *compData = (unsigned char *)RL_MALLOC(sdefl_bound((int)view.size));
+
+            if (compData != NULL)
+            {
+                int compSize = sdeflate(sdefl, compData, view.data, (int)view.size, ASSET_PACK_COMPRESSION_LEVEL);
+
+                // Only keep compressed data when it actually reduces entry size
+                if ((compSize > 0) && (compSize < view.size))
+                {
+                    entry->offset = offset;
+                    entry->packedSize = (unsigned long long)compSize;
+                    entry->flags = ASSET_PACK_ENTRY_COMPRESSED;
+                    valid = (fwrite(compData, 1, compSize, file) == (size_t)compSize);
+                }
+
+                RL_FREE(compData);
+            }
+        }
+#endif
+        if (!(entry->flags & ASSET_PACK_ENTRY_COMPRESSED))
+        {
+            unsigned int paddingSize = (unsigned int)((ASSET_PACK_ALIGNMENT - (offset%ASSET_PACK_ALIGNMENT))%ASSET_PACK_ALIGNMENT);
+            valid = (fwrite(padding, 1, paddingSize, file) == paddingSize);
+            offset += paddingSize;
+
+            entry->offset = offset;
+            entry->packedSize = entry->size;
+            valid = valid && (fwrite(view.data, 1, (size_t)view.size, file) == (size_t)view.size);
         }
+
+        offset += entry->packedSize;
+        entryCount++;
+
+        UnloadFileView(view);
     }
+
+#if defined(ASSET_PACK_COMPRESSION)
+    RL_FREE(sdefl);
+#endif
+
+    // Entries index sorted by name hash, for binary search on lookup
+    qsort(entries, entryCount, sizeof(AssetPackEntry), CompareAssetPackEntries);
+
+    unsigned int paddingSize = (unsigned int)((8 - (offset%8))%8);
+    valid = valid && (fwrite(padding, 1, paddingSize, file) == paddingSize);
+    offset += paddingSize;
+
+    header.entryCount = entryCount;
+    header.indexOffset = offset;
+    header.namesOffset = offset + (unsigned long long)entryCount*sizeof(AssetPackEntry);
+
+    valid = valid && (fwrite(entries, sizeof(AssetPackEntry), entryCount, file) == entryCount);
+    valid = valid && (fwrite(names, 1, namesSize, file) == namesSize);
+
+    FILE_SEEK64(file, 0, SEEK_SET);
+    valid = valid && (fwrite(&header, sizeof(AssetPackHeader), 1, file) == 1);
+
+    if ((fclose(file) == 0) && valid) success = true;
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Asset pack exported successfully (%u entries)", fileName, entryCount);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to write asset pack", fileName);
+
+    RL_FREE(entries);
+    RL_FREE(names);
+    UnloadDirectoryFiles(files);
+#else
+    (void)basePath;
+    (void)compress;
+    TRACELOG(LOG_WARNING, "FILEIO: [%s] Asset packs not supported", fileName);
+#endif
+
+    return success;
 }
-#endif  // PLATFORM_ANDROID
+
+#if defined(SUPPORT_ASSET_PACK)
+// Check if file is stored in a mounted asset pack, file size is returned (if not NULL)
+bool IsAssetPackFile(const char *fileName, long long *size)
+{
+    AssetPack *pack = NULL;
+
+    pthread_rwlock_rdlock(&assetPackMountLock);
+    const AssetPackEntry *entry = FindAssetPackEntry(fileName, &pack);
+    if ((entry != NULL) && (size != NULL)) *size = (long long)entry->size;
+    pthread_rwlock_unlock(&assetPackMountLock);
+
+    return (entry != NULL);
+}
+#endif
 
 //----------------------------------------------------------------------------------
-// Module specific Functions Definition
+// Module Functions Definition - Async loading
 //----------------------------------------------------------------------------------
-#if defined(PLATFORM_ANDROID)
-static int android_read(void *cookie, char *data, int dataSize)
+
+// Set per-frame time budget for async loads GPU uploads
+// NOTE: At least one load is uploaded per frame, even if it takes longer than budget
+void SetAsyncUploadBudget(float milliseconds)
 {
-    return AAsset_read((AAsset *)cookie, data, dataSize);
+#if defined(SUPPORT_ASYNC_LOADING)
+    pthread_mutex_lock(&asyncLoader.lock);
+    asyncLoader.uploadBudget = (milliseconds > 0.0f)? milliseconds : 0.0f;
+    pthread_mutex_unlock(&asyncLoader.lock);
+#else
+    (void)milliseconds;
+#endif
 }
 
-static int android_write(void *cookie, const char *data, int dataSize)
+// Process async loads waiting for upload, oldest first, within upload budget
+// NOTE: Must be called from main thread (OpenGL context), called by EndDrawing()
+void UpdateAsyncLoading(void)
 {
-    TRACELOG(LOG_WARNING, "ANDROID: Failed to provide write access to APK");
+#if defined(SUPPORT_ASYNC_LOADING)
+    double startTime = GetTime();
+
+    pthread_mutex_lock(&asyncLoader.lock);
+
+    while (true)
+    {
+        AsyncLoad *load = FindOldestAsyncLoad(ASYNC_PHASE_LOADED);
+        if (load == NULL) break;
+
+        ProcessAsyncLoad(load);
+
+        if ((GetTime() - startTime)*1000.0 >= asyncLoader.uploadBudget) break;
+    }
+
+    pthread_mutex_unlock(&asyncLoader.lock);
+#endif
+}
+
+// Get async load state (AsyncLoadState)
+int GetAsyncLoadState(unsigned int handle)
+{
+    int state = ASYNC_LOAD_NONE;
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    pthread_mutex_lock(&asyncLoader.lock);
+
+    AsyncLoad *load = FindAsyncLoad(handle);
+
+    if (load != NULL)
+    {
+        if (load->phase == ASYNC_PHASE_READY) state = ASYNC_LOAD_READY;
+        else if (load->phase == ASYNC_PHASE_FAILED) state = ASYNC_LOAD_FAILED;
+        else state = ASYNC_LOAD_PENDING;
+    }
+
+    pthread_mutex_unlock(&asyncLoader.lock);
+#else
+    (void)handle;
+#endif
+
+    return state;
+}
+
+// Wait for async load to finish (blocking)
+// NOTE: Must be called from main thread, requested load is uploaded as soon as it is loaded
+void WaitAsyncLoad(unsigned int handle)
+{
+#if defined(SUPPORT_ASYNC_LOADING)
+    pthread_mutex_lock(&asyncLoader.lock);
+
+    while (true)
+    {
+        AsyncLoad *load = FindAsyncLoad(handle);
+
+        if ((load == NULL) || (load->phase == ASYNC_PHASE_READY) || (load->phase == ASYNC_PHASE_FAILED)) break;
+
+        if (load->phase == ASYNC_PHASE_LOADED) ProcessAsyncLoad(load);
+        else if (asyncLoader.ready) pthread_cond_wait(&asyncLoader.loaded, &asyncLoader.lock);
+        else break;
+    }
+
+    pthread_mutex_unlock(&asyncLoader.lock);
+#else
+    (void)handle;
+#endif
+}
+
+// Cancel async load, loaded data not retrieved is unloaded and handle is released
+// NOTE: Failed loads handles must also be released with this function
+void CancelAsyncLoad(unsigned int handle)
+{
+#if defined(SUPPORT_ASYNC_LOADING)
+    pthread_mutex_lock(&asyncLoader.lock);
+
+    AsyncLoad *load = FindAsyncLoad(handle);
+
+    if (load != NULL)
+    {
+        switch (load->phase)
+        {
+            case ASYNC_PHASE_QUEUED:
+            case ASYNC_PHASE_FAILED:
+            {
+                RL_FREE(load->data);
+                memset(load, 0, sizeof(AsyncLoad));
+            } break;
+            case ASYNC_PHASE_LOADING: load->cancelled = true; break;     // Data is unloaded once loading ends
+            case ASYNC_PHASE_LOADED:
+            {
+                load->cancelled = true;
+                ProcessAsyncLoad(load);
+            } break;
+            case ASYNC_PHASE_READY:
+            {
+                void *data = load->data;
+                AsyncUnloadFunction unload = load->unload;
+                memset(load, 0, sizeof(AsyncLoad));
+
+                pthread_mutex_unlock(&asyncLoader.lock);
+                if (unload != NULL) unload(data, true);
+                RL_FREE(data);
+                pthread_mutex_lock(&asyncLoader.lock);
+            } break;
+            default: break;
+        }
+    }
+
+    pthread_mutex_unlock(&asyncLoader.lock);
+#else
+    (void)handle;
+#endif
+}
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Queue async load, loading thread is started on first load
+// NOTE: If a handle is returned, data is owned by async loader until retrieved with TakeAsyncLoadResult(),
+// if loading fails, load function must release data contents (data is freed by async loader)
+unsigned int QueueAsyncLoad(int type, void *data, AsyncLoadFunction load, AsyncUploadFunction upload, AsyncUnloadFunction unload,
+                            AsyncLoadCallback callback, void *userData)
+{
+    unsigned int handle = 0;
+
+    pthread_mutex_lock(&asyncLoader.lock);
+
+    if (!asyncLoader.ready)
+    {
+        asyncLoader.quit = false;
+
+        // NOTE: Thread is created while holding the lock, so thread id is set before loading thread reads it
+        if (pthread_create(&asyncLoader.thread, NULL, AsyncLoadThread, NULL) == 0)
+        {
+            asyncLoader.ready = true;
+            TRACELOG(LOG_INFO, "ASYNC: Loading thread started successfully");
+        }
+        else TRACELOG(LOG_WARNING, "ASYNC: Failed to create loading thread");
+    }
+
+    if (asyncLoader.ready)
+    {
+        AsyncLoad *slot = NULL;
+
+        for (int i = 0; i < MAX_ASYNC_LOADS; i++)
+        {
+            if (asyncLoader.loads[i].phase == ASYNC_PHASE_FREE)
+            {
+                slot = &asyncLoader.loads[i];
+                break;
+            }
+        }
+
+        if (slot != NULL)
+        {
+            asyncLoader.handleCounter++;
+            if (asyncLoader.handleCounter == 0) asyncLoader.handleCounter++;    // Handle 0 is not valid
+
+            handle = asyncLoader.handleCounter;
+
+            memset(slot, 0, sizeof(AsyncLoad));
+            slot->handle = handle;
+            slot->type = type;
+            slot->phase = ASYNC_PHASE_QUEUED;
+            slot->data = data;
+            slot->load = load;
+            slot->upload = upload;
+            slot->unload = unload;
+            slot->callback = callback;
+            slot->userData = userData;
+
+            pthread_cond_signal(&asyncLoader.wake);
+        }
+        else TRACELOG(LOG_WARNING, "ASYNC: Load could not be queued, MAX_ASYNC_LOADS reached");
+    }
+
+    pthread_mutex_unlock(&asyncLoader.lock);
+
+    return handle;
+}
+
+// Take async load data if ready, handle is released
+// NOTE: Returned data must be freed by caller
+void *TakeAsyncLoadResult(unsigned int handle, int type)
+{
+    void *data = NULL;
+
+    pthread_mutex_lock(&asyncLoader.lock);
+
+    AsyncLoad *load = FindAsyncLoad(handle);
+
+    if ((load != NULL) && (load->phase == ASYNC_PHASE_READY))
+    {
+        if (load->type == type)
+        {
+            data = load->data;
+            memset(load, 0, sizeof(AsyncLoad));
+        }
+        else TRACELOG(LOG_WARNING, "ASYNC: [ID %u] Load result requested for a different asset type", handle);
+    }
+
+    pthread_mutex_unlock(&asyncLoader.lock);
+
+    return data;
+}
+
+// Get deferred GPU uploads list of the asset being loaded, only on loading thread (NULL otherwise)
+AsyncUploads *GetAsyncUploads(void)
+{
+    AsyncUploads *uploads = NULL;
+
+    pthread_mutex_lock(&asyncLoader.lock);
+    if (asyncLoader.ready && (asyncLoader.current != NULL) && pthread_equal(pthread_self(), asyncLoader.thread)) uploads = &asyncLoader.current->uploads;
+    pthread_mutex_unlock(&asyncLoader.lock);
+
+    return uploads;
+}
+
+// Close async loading, pending loads are cancelled and loaded data not retrieved is unloaded
+// NOTE: Must be called from main thread, before closing OpenGL context
+void CloseAsyncLoading(void)
+{
+    pthread_mutex_lock(&asyncLoader.lock);
+
+    if (!asyncLoader.ready)
+    {
+        pthread_mutex_unlock(&asyncLoader.lock);
+        return;
+    }
+
+    for (int i = 0; i < MAX_ASYNC_LOADS; i++)
+    {
+        AsyncLoad *load = &asyncLoader.loads[i];
+
+        if (load->phase == ASYNC_PHASE_QUEUED)
+        {
+            RL_FREE(load->data);
+            memset(load, 0, sizeof(AsyncLoad));
+        }
+        else load->cancelled = true;
+    }
+
+    asyncLoader.quit = true;
+    pthread_cond_broadcast(&asyncLoader.wake);
+    pthread_mutex_unlock(&asyncLoader.lock);
+
+    pthread_join(asyncLoader.thread, NULL);
+
+    pthread_mutex_lock(&asyncLoader.lock);
+    asyncLoader.ready = false;
+    pthread_mutex_unlock(&asyncLoader.lock);
+
+    // Loading thread stopped, remaining loads are unloaded
+    for (int i = 0; i < MAX_ASYNC_LOADS; i++)
+    {
+        if (asyncLoader.loads[i].phase != ASYNC_PHASE_FREE) CancelAsyncLoad(asyncLoader.loads[i].handle);
+    }
+
+    TRACELOG(LOG_INFO, "ASYNC: Loading thread stopped");
+}
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Job system
+//----------------------------------------------------------------------------------
+
+// Set job system worker threads count
+// NOTE: Worker threads are (re)started on next jobs run, jobs in flight on other threads are completed first
+void SetJobWorkerCount(int count)
+{
+#if defined(SUPPORT_JOB_SYSTEM)
+    if (count < 0) count = 0;
+    if (count > MAX_JOB_WORKERS) count = MAX_JOB_WORKERS;
+
+    pthread_mutex_lock(&jobsInitLock);
+    jobs.requestedCount = count;
+    pthread_mutex_unlock(&jobsInitLock);
+
+    CloseJobSystem();
+#else
+    (void)count;
+#endif
+}
+
+// Run jobs [0..count-1] in parallel, returns when all jobs are done
+// NOTE: Calling thread also processes jobs, if job system is busy (nested or concurrent calls)
+// or not supported, jobs are just run sequentially on calling thread
+void RunJobs(JobFunction func, void *userData, int count)
+{
+    if ((func == NULL) || (count <= 0)) return;
+
+#if defined(SUPPORT_JOB_SYSTEM)
+    if (count > 1)
+    {
+        // NOTE: Calls in flight are counted, so CloseJobSystem() waits for them before tear down
+        pthread_mutex_lock(&jobsInitLock);
+        if (!jobs.ready) InitJobSystem();
+        jobsRunning++;
+        pthread_mutex_unlock(&jobsInitLock);
+    }
+
+    bool parallel = false;
+
+    if ((count > 1) && (jobs.workerCount > 0))
+    {
+        pthread_mutex_lock(&jobs.lock);
+
+        if (!jobs.active)
+        {
+            // Split jobs in contiguous ranges, one per participant
+            int participants = jobs.workerCount + 1;
+            if (participants > count) participants = count;
+
+            for (int i = 0; i <= jobs.workerCount; i++)
+            {
+                pthread_mutex_lock(&jobs.ranges[i].lock);
+                jobs.ranges[i].begin = (i < participants)? (int)((long long)count*i/participants) : 0;
+                jobs.ranges[i].end = (i < participants)? (int)((long long)count*(i + 1)/participants) : 0;
+                pthread_mutex_unlock(&jobs.ranges[i].lock);
+            }
+
+            jobs.func = func;
+            jobs.userData = userData;
+            jobs.pending = count;
+            jobs.active = true;
+            jobs.generation++;
+            parallel = true;
+
+            pthread_cond_broadcast(&jobs.wake);
+        }
+
+        pthread_mutex_unlock(&jobs.lock);
+    }
+
+    if (parallel)
+    {
+        int completed = ProcessJobs(0, func, userData);
+
+        pthread_mutex_lock(&jobs.lock);
+        jobs.pending -= completed;
+        while ((jobs.pending > 0) || (jobs.busy > 0)) pthread_cond_wait(&jobs.done, &jobs.lock);
+        jobs.active = false;
+        pthread_mutex_unlock(&jobs.lock);
+    }
+    else
+#endif
+    {
+        for (int i = 0; i < count; i++) func(userData, i);
+    }
+
+#if defined(SUPPORT_JOB_SYSTEM)
+    if (count > 1)
+    {
+        pthread_mutex_lock(&jobsInitLock);
+        jobsRunning--;
+        if (jobsRunning == 0) pthread_cond_broadcast(&jobsIdle);
+        pthread_mutex_unlock(&jobsInitLock);
+    }
+#endif
+}
+
+// Close job system, worker threads are stopped
+// NOTE: Waits for RunJobs() calls in flight on other threads (i.e. async loading), must not be called from a job function
+void CloseJobSystem(void)
+{
+#if defined(SUPPORT_JOB_SYSTEM)
+    pthread_mutex_lock(&jobsInitLock);
+    while (jobsRunning > 0) pthread_cond_wait(&jobsIdle, &jobsInitLock);
+
+    if (jobs.ready)
+    {
+        pthread_mutex_lock(&jobs.lock);
+        jobs.quit = true;
+        pthread_cond_broadcast(&jobs.wake);
+        pthread_mutex_unlock(&jobs.lock);
+
+        for (int i = 0; i < jobs.workerCount; i++) pthread_join(jobs.workers[i], NULL);
+        for (int i = 0; i <= MAX_JOB_WORKERS; i++) pthread_mutex_destroy(&jobs.ranges[i].lock);
+
+        pthread_cond_destroy(&jobs.wake);
+        pthread_cond_destroy(&jobs.done);
+        pthread_mutex_destroy(&jobs.lock);
+
+        TRACELOG(LOG_INFO, "JOBS: Job system closed successfully");
+
+        int requestedCount = jobs.requestedCount;
+        memset(&jobs, 0, sizeof(JobSystem));
+        jobs.requestedCount = requestedCount;
+    }
+
+    pthread_mutex_unlock(&jobsInitLock);
+#endif
+}
+
+#if defined(PLATFORM_ANDROID)
+// Initialize asset manager from android app
+void InitAssetManager(AAssetManager *manager, const char *dataPath)
+{
+    assetManager = manager;
+    internalDataPath = dataPath;
+}
+
+// Replacement for fopen()
+// Ref: https://developer.android.com/ndk/reference/group/asset
+FILE *android_fopen(const char *fileName, const char *mode)
+{
+    if (mode[0] == 'w')
+    {
+        // fopen() is mapped to android_fopen() that only grants read access to
+        // assets directory through AAssetManager but we want to also be able to
+        // write data when required using the standard stdio FILE access functions
+        // Ref: https://stackoverflow.com/questions/11294487/android-writing-saving-files-from-native-code-only
+        #undef fopen
+        return fopen(TextFormat("%s/%s", internalDataPath, fileName), mode);
+        #define fopen(name, mode) android_fopen(name, mode)
+    }
+    else
+    {
+        // NOTE: AAsset provides access to read-only asset
+        AAsset *asset = AAssetManager_open(assetManager, fileName, AASSET_MODE_UNKNOWN);
+
+        if (asset != NULL)
+        {
+            // Get pointer to file in the assets
+            return funopen(asset, android_read, android_write, android_seek, android_close);
+        }
+        else
+        {
+            #undef fopen
+            // Just do a regular open if file is not found in the assets
+            return fopen(TextFormat("%s/%s", internalDataPath, fileName), mode);
+            #define fopen(name, mode) android_fopen(name, mode)
+        }
+    }
+}
+#endif  // PLATFORM_ANDROID
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+#if defined(PLATFORM_ANDROID)
+static int android_read(void *cookie, char *data, int dataSize)
+{
+    return AAsset_read((AAsset *)cookie, data, dataSize);
+}
+
+static int android_write(void *cookie, const char *data, int dataSize)
+{
+    TRACELOG(LOG_WARNING, "ANDROID: Failed to provide write access to APK");
 
     return EACCES;
 }
@@ -519,3 +1613,396 @@ static int android_close(void *cookie)
     return 0;
 }
 #endif  // PLATFORM_ANDROID
+
+#if defined(SUPPORT_ASSET_PACK)
+// Compute asset pack entry name hash (FNV-1a 64bit)
+static unsigned long long HashAssetPackName(const char *name)
+{
+    unsigned long long hash = 14695981039346656037ULL;
+
+    for (int i = 0; name[i] != '\0'; i++)
+    {
+        hash ^= (unsigned char)name[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+// Find file entry in mounted asset packs, last mounted pack is searched first
+static const AssetPackEntry *FindAssetPackEntry(const char *fileName, AssetPack **pack)
+{
+    if ((fileName == NULL) || (assetPackCount == 0)) return NULL;
+
+    // Normalize file path: no leading "./", '/' as separator
+    char path[MAX_FILEPATH_LENGTH] = { 0 };
+    while ((fileName[0] == '.') && ((fileName[1] == '/') || (fileName[1] == '\\'))) fileName += 2;
+
+    for (int i = 0; (fileName[i] != '\0') && (i < (MAX_FILEPATH_LENGTH - 1)); i++) path[i] = (fileName[i] == '\\')? '/' : fileName[i];
+
+    for (int p = assetPackCount - 1; p >= 0; p--)
+    {
+        AssetPack *current = &assetPacks[p];
+        const char *name = path;
+
+        if (current->mountLength > 0)
+        {
+            if ((strncmp(path, current->mountPath, current->mountLength) != 0) || (path[current->mountLength] != '/')) continue;
+            name = path + current->mountLength + 1;
+        }
+
+        unsigned long long hash = HashAssetPackName(name);
+
+        // Binary search first entry with name hash
+        unsigned int first = 0;
+        unsigned int last = current->entryCount;
+
+        while (first < last)
+        {
+            unsigned int middle = first + (last - first)/2;
+
+            if (current->entries[middle].hash < hash) first = middle + 1;
+            else last = middle;
+        }
+
+        // Compare names on all entries with same hash (collisions)
+        for (unsigned int i = first; (i < current->entryCount) && (current->entries[i].hash == hash); i++)
+        {
+            if (strcmp(current->names + current->entries[i].nameOffset, name) == 0)
+            {
+                *pack = current;
+                return &current->entries[i];
+            }
+        }
+    }
+
+    return NULL;
+}
+
+// Load entry data from asset pack, padding bytes are zeroed after entry data
+// NOTE: Compressed entries are decompressed straight from mapped data when available
+static unsigned char *LoadAssetPackEntry(AssetPack *pack, const AssetPackEntry *entry, int padding)
+{
+    const char *name = pack->names + entry->nameOffset;
+
+    if ((entry->size == 0) || (entry->size + padding > (size_t)-1))
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read packed file", name);
+        return NULL;
+    }
+
+    unsigned char *data = (unsigned char *)RL_MALLOC((size_t)entry->size + padding);
+
+    if (data == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to allocated memory for packed file reading", name);
+        return NULL;
+    }
+
+    const unsigned char *packedData = NULL;
+    unsigned char *packedBuffer = NULL;
+
+    if (pack->mapData != NULL) packedData = pack->mapData + entry->offset;
+    else
+    {
+        // Uncompressed data is read straight to output buffer
+        packedBuffer = (entry->flags & ASSET_PACK_ENTRY_COMPRESSED)? (unsigned char *)RL_MALLOC((size_t)entry->packedSize) : data;
+
+        if (packedBuffer != NULL)
+        {
+            // NOTE: Pack file is shared, reads can be requested from multiple threads
+            pthread_mutex_lock(&assetPackLock);
+            FILE_SEEK64(pack->file, (long long)entry->offset, SEEK_SET);
+            if (fread(packedBuffer, 1, (size_t)entry->packedSize, pack->file) == entry->packedSize) packedData = packedBuffer;
+            pthread_mutex_unlock(&assetPackLock);
+        }
+    }
+
+    bool valid = (packedData != NULL);
+
+    if (valid)
+    {
+        if (entry->flags & ASSET_PACK_ENTRY_COMPRESSED)
+        {
+#if defined(ASSET_PACK_COMPRESSION)
+            valid = (entry->size <= 2147483647) && (entry->packedSize <= 2147483647) &&
+                    (sinflate(data, (int)entry->size, packedData, (int)entry->packedSize) == (int)entry->size);
+#else
+            TRACELOG(LOG_WARNING, "FILEIO: [%s] Packed file is compressed, compression not supported", name);
+            valid = false;
+#endif
+        }
+        else if (packedData != data) memcpy(data, packedData, (size_t)entry->size);
+    }
+
+    if (packedBuffer != data) RL_FREE(packedBuffer);
+
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read packed file", name);
+        RL_FREE(data);
+        return NULL;
+    }
+
+    if (padding > 0) memset(data + entry->size, 0, padding);
+
+    TRACELOGD("FILEIO: [%s] Packed file loaded successfully", name);
+
+    return data;
+}
+
+// Compare asset pack entries by name hash (qsort callback)
+static int CompareAssetPackEntries(const void *a, const void *b)
+{
+    const AssetPackEntry *entryA = (const AssetPackEntry *)a;
+    const AssetPackEntry *entryB = (const AssetPackEntry *)b;
+
+    if (entryA->hash < entryB->hash) return -1;
+    if (entryA->hash > entryB->hash) return 1;
+
+    return (entryA->nameOffset < entryB->nameOffset)? -1 : (entryA->nameOffset > entryB->nameOffset);
+}
+#endif  // SUPPORT_ASSET_PACK
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Async loading thread, loads are processed in queue order
+static void *AsyncLoadThread(void *arg)
+{
+    (void)arg;
+
+    pthread_mutex_lock(&asyncLoader.lock);
+
+    while (true)
+    {
+        AsyncLoad *load = FindOldestAsyncLoad(ASYNC_PHASE_QUEUED);
+
+        if (load == NULL)
+        {
+            if (asyncLoader.quit) break;
+
+            pthread_cond_wait(&asyncLoader.wake, &asyncLoader.lock);
+            continue;
+        }
+
+        load->phase = ASYNC_PHASE_LOADING;
+        asyncLoader.current = load;
+        pthread_mutex_unlock(&asyncLoader.lock);
+
+        // File loading and decoding, GPU uploads are deferred to main thread
+        bool success = load->load(load->data);
+
+        pthread_mutex_lock(&asyncLoader.lock);
+        asyncLoader.current = NULL;
+        load->success = success;
+        load->phase = ASYNC_PHASE_LOADED;
+
+        pthread_cond_broadcast(&asyncLoader.loaded);
+    }
+
+    pthread_mutex_unlock(&asyncLoader.lock);
+
+    return NULL;
+}
+
+// Find async load by handle
+// NOTE: Async loader lock must be held by caller
+static AsyncLoad *FindAsyncLoad(unsigned int handle)
+{
+    if (handle == 0) return NULL;
+
+    for (int i = 0; i < MAX_ASYNC_LOADS; i++)
+    {
+        if ((asyncLoader.loads[i].phase != ASYNC_PHASE_FREE) && (asyncLoader.loads[i].handle == handle)) return &asyncLoader.loads[i];
+    }
+
+    return NULL;
+}
+
+// Find oldest async load in a phase (lowest handle, considering handle counter wrap)
+// NOTE: Async loader lock must be held by caller
+static AsyncLoad *FindOldestAsyncLoad(int phase)
+{
+    AsyncLoad *oldest = NULL;
+
+    for (int i = 0; i < MAX_ASYNC_LOADS; i++)
+    {
+        AsyncLoad *load = &asyncLoader.loads[i];
+
+        if ((load->phase == phase) && ((oldest == NULL) || ((int)(load->handle - oldest->handle) < 0))) oldest = load;
+    }
+
+    return oldest;
+}
+
+// Process async load finished by loading thread (main thread): upload, unload if cancelled, callback
+// NOTE: Async loader lock must be held by caller, it is released while processing
+static void ProcessAsyncLoad(AsyncLoad *load)
+{
+    // Load is moved out of loaded phase, so it is not processed again (i.e. from callback)
+    load->phase = ASYNC_PHASE_LOADING;
+    pthread_mutex_unlock(&asyncLoader.lock);
+
+    bool success = load->success;
+
+    if (load->cancelled)
+    {
+        if (success && (load->unload != NULL)) load->unload(load->data, false);
+        success = false;
+    }
+    else if (success) success = load->upload(load->data, &load->uploads);
+
+    // Deferred uploads data is not required anymore
+    for (int i = 0; i < load->uploads.imageCount; i++) RL_FREE(load->uploads.images[i].data);
+    RL_FREE(load->uploads.images);
+    RL_FREE(load->uploads.meshes);
+    memset(&load->uploads, 0, sizeof(AsyncUploads));
+
+    if (!success)
+    {
+        RL_FREE(load->data);
+        load->data = NULL;
+    }
+
+    unsigned int handle = load->handle;
+    AsyncLoadCallback callback = load->callback;
+    void *userData = load->userData;
+    bool cancelled = load->cancelled;
+
+    pthread_mutex_lock(&asyncLoader.lock);
+
+    if (cancelled) memset(load, 0, sizeof(AsyncLoad));
+    else
+    {
+        load->phase = success? ASYNC_PHASE_READY : ASYNC_PHASE_FAILED;
+
+        if (!success) TRACELOG(LOG_WARNING, "ASYNC: [ID %u] Failed to load asset", handle);
+
+        if (callback != NULL)
+        {
+            pthread_mutex_unlock(&asyncLoader.lock);
+            callback(handle, success, userData);
+            pthread_mutex_lock(&asyncLoader.lock);
+        }
+    }
+}
+#endif  // SUPPORT_ASYNC_LOADING
+
+#if defined(SUPPORT_JOB_SYSTEM)
+// Init job system, worker threads are created
+// NOTE: jobsInitLock must be held by caller
+static void InitJobSystem(void)
+{
+    int count = (jobs.requestedCount >= 0)? jobs.requestedCount : DEFAULT_JOB_WORKERS;
+    if (count > MAX_JOB_WORKERS) count = MAX_JOB_WORKERS;
+
+    pthread_mutex_init(&jobs.lock, NULL);
+    pthread_cond_init(&jobs.wake, NULL);
+    pthread_cond_init(&jobs.done, NULL);
+    for (int i = 0; i <= MAX_JOB_WORKERS; i++) pthread_mutex_init(&jobs.ranges[i].lock, NULL);
+
+    jobs.quit = false;
+    jobs.workerCount = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        // NOTE: Worker index is passed as pointer value, participant 0 is the calling thread
+        if (pthread_create(&jobs.workers[jobs.workerCount], NULL, JobWorkerThread, (void *)(size_t)(jobs.workerCount + 1)) != 0)
+        {
+            TRACELOG(LOG_WARNING, "JOBS: Failed to create worker thread %i", i);
+            break;
+        }
+
+        jobs.workerCount++;
+    }
+
+    jobs.ready = true;
+
+    TRACELOG(LOG_INFO, "JOBS: Job system initialized successfully (%i worker threads)", jobs.workerCount);
+}
+
+// Take next job for participant, own range first, then steal half of another participant range
+// Returns -1 when no jobs are left
+static int TakeJob(int participant)
+{
+    int index = -1;
+    JobRange *own = &jobs.ranges[participant];
+
+    pthread_mutex_lock(&own->lock);
+    if (own->begin < own->end) index = own->begin++;
+    pthread_mutex_unlock(&own->lock);
+
+    for (int i = 1; (index < 0) && (i <= jobs.workerCount); i++)
+    {
+        JobRange *victim = &jobs.ranges[(participant + i)%(jobs.workerCount + 1)];
+        int begin = 0, end = 0;
+
+        pthread_mutex_lock(&victim->lock);
+        int available = victim->end - victim->begin;
+        if (available > 0)
+        {
+            end = victim->end;
+            begin = end - (available + 1)/2;
+            victim->end = begin;
+        }
+        pthread_mutex_unlock(&victim->lock);
+
+        if (begin < end)
+        {
+            index = begin;
+
+            pthread_mutex_lock(&own->lock);
+            own->begin = begin + 1;
+            own->end = end;
+            pthread_mutex_unlock(&own->lock);
+        }
+    }
+
+    return index;
+}
+
+// Process jobs until no jobs are left, returns number of jobs processed
+static int ProcessJobs(int participant, JobFunction func, void *userData)
+{
+    int completed = 0;
+
+    for (int index = TakeJob(participant); index >= 0; index = TakeJob(participant))
+    {
+        func(userData, index);
+        completed++;
+    }
+
+    return completed;
+}
+
+// Job system worker thread
+static void *JobWorkerThread(void *arg)
+{
+    int participant = (int)(size_t)arg;
+    unsigned int generation = 0;
+
+    pthread_mutex_lock(&jobs.lock);
+
+    while (true)
+    {
+        while (!jobs.quit && (!jobs.active || (jobs.generation == generation))) pthread_cond_wait(&jobs.wake, &jobs.lock);
+        if (jobs.quit) break;
+
+        generation = jobs.generation;
+        JobFunction func = jobs.func;
+        void *userData = jobs.userData;
+        jobs.busy++;
+        pthread_mutex_unlock(&jobs.lock);
+
+        int completed = ProcessJobs(participant, func, userData);
+
+        pthread_mutex_lock(&jobs.lock);
+        jobs.pending -= completed;
+        jobs.busy--;
+        if ((jobs.pending == 0) && (jobs.busy == 0)) pthread_cond_signal(&jobs.done);
+    }
+
+    pthread_mutex_unlock(&jobs.lock);
+
+    return NULL;
+}
+#endif  // SUPPORT_JOB_SYSTEM
@@ -55,7 +55,39 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Job function, called once per job index
+typedef void (*JobFunction)(void *userData, int index);
+
+#if defined(SUPPORT_ASYNC_LOADING)
+#define ASYNC_DEFERRED_TEXTURE  0x80000000      // Deferred texture id flag, lower bits are the deferred image index
+
+// Async load asset type
+typedef enum {
+    ASYNC_ASSET_TEXTURE = 1,
+    ASYNC_ASSET_MODEL,
+    ASYNC_ASSET_FONT,
+    ASYNC_ASSET_SOUND
+} AsyncAssetType;
+
+// Mesh GPU upload deferred
+typedef struct AsyncMeshUpload {
+    Mesh *mesh;                 // Mesh to upload, pointing to asset data
+    bool dynamic;               // Mesh buffers dynamic usage
+} AsyncMeshUpload;
+
+// GPU uploads deferred while loading an asset on async loading thread,
+// LoadTextureFromImage() and UploadMesh() record them to be processed on main thread
+typedef struct AsyncUploads {
+    Image *images;              // Images to be loaded as textures, texture id: ASYNC_DEFERRED_TEXTURE | index
+    int imageCount;             // Images count
+    AsyncMeshUpload *meshes;    // Meshes to be uploaded
+    int meshCount;              // Meshes count
+} AsyncUploads;
+
+typedef bool (*AsyncLoadFunction)(void *data);                              // Asset loading function (loading thread): file read and decoding
+typedef bool (*AsyncUploadFunction)(void *data, AsyncUploads *uploads);     // Asset upload function (main thread): deferred GPU uploads
+typedef void (*AsyncUnloadFunction)(void *data, bool uploaded);             // Asset unload function (main thread): result not retrieved
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -69,6 +101,23 @@
 extern "C" {            // Prevents name mangling of functions
 #endif
 
+// Job system: jobs are split across worker threads and calling thread (work-stealing)
+void RunJobs(JobFunction func, void *userData, int count);            // Run jobs [0..count-1] in parallel, returns when all jobs are done
+void CloseJobSystem(void);                                            // Close job system, worker threads are stopped
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Async loading: assets loaded on loading thread, uploaded on main thread
+unsigned int QueueAsyncLoad(int type, void *data, AsyncLoadFunction load, AsyncUploadFunction upload, AsyncUnloadFunction unload,
+                            AsyncLoadCallback callback, void *userData);   // Queue async load, data is owned by async loader until retrieved
+void *TakeAsyncLoadResult(unsigned int handle, int type);             // Take async load data if ready (handle is released), data must be freed by caller
+AsyncUploads *GetAsyncUploads(void);                                  // Get deferred GPU uploads list, only while loading an asset on loading thread (NULL otherwise)
+void CloseAsyncLoading(void);                                         // Close async loading, pending loads are cancelled and loading thread stopped
+#endif
+
+#if defined(SUPPORT_ASSET_PACK)
+bool IsAssetPackFile(const char *fileName, long long *size);          // Check if file is stored in a mounted asset pack, file size is returned (if not NULL)
+#endif
+
 #if defined(PLATFORM_ANDROID)
 void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initialize asset manager from android app
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!